@@ -4,6 +4,7 @@
 #include "AudioCommon/Mixer.h"
 
 #include <algorithm>
+#include <bit>
 #include <cmath>
 #include <cstring>
 
@@ -39,6 +40,22 @@ Mixer::Mixer(unsigned int BackendSampleRate)
   m_config_changed_callback_id = Config::AddConfigChangedCallback([this] { RefreshConfig(); });
   RefreshConfig();
 
+  // The FIFOs are sized once here, as the audio thread may read from them at any time afterwards.
+  // Leave room for four times the target latency at 48 kHz, the highest input sample rate, so that
+  // the emulated side running ahead in bursts doesn't immediately overflow them.
+  if (m_config_buffer_latency > 0)
+  {
+    m_fifo_capacity =
+        std::max(MAX_SAMPLES, std::bit_ceil(static_cast<u32>(m_config_buffer_latency) * 48 * 4));
+  }
+  m_dma_mixer.SetCapacity(m_fifo_capacity);
+  m_streaming_mixer.SetCapacity(m_fifo_capacity);
+  m_wiimote_speaker_mixer.SetCapacity(m_fifo_capacity);
+  m_skylander_portal_mixer.SetCapacity(m_fifo_capacity);
+  for (auto& mixer : m_gba_mixers)
+    mixer.SetCapacity(m_fifo_capacity);
+  m_scratch_buffer.resize(m_fifo_capacity * 2);
+
   INFO_LOG_FMT(AUDIO_INTERFACE, "Mixer is initialized");
 }
 
@@ -57,13 +74,17 @@ void Mixer::DoState(PointerWrap& p)
     mixer.DoState(p);
 }
 
+s16 Mixer::MixerFifo::ReadBuffer(u32 index) const
+{
+  const short sample = m_buffer[index & m_index_mask];
+  return m_little_endian ? sample : Common::swap16(sample);
+}
+
 // Executed from sound stream thread
 unsigned int Mixer::MixerFifo::Mix(short* samples, unsigned int numSamples,
                                    bool consider_framelimit, float emulationspeed,
-                                   int timing_variance)
+                                   int target_latency)
 {
-  unsigned int currentSample = 0;
-
   // Cache access in non-volatile variable
   // This is the only function changing the read value, so it's safe to
   // cache it locally although it's written here.
@@ -78,15 +99,16 @@ unsigned int Mixer::MixerFifo::Mix(short* samples, unsigned int numSamples,
   // advance indexR with sample position
   // remember fractional offset
 
-  float aid_sample_rate =
+  const float nominal_sample_rate =
       FIXED_SAMPLE_RATE_DIVIDEND / static_cast<float>(m_input_sample_rate_divisor);
+  float aid_sample_rate = nominal_sample_rate;
   if (consider_framelimit && emulationspeed > 0.0f)
   {
-    float numLeft = static_cast<float>(((indexW - indexR) & INDEX_MASK) / 2);
+    float numLeft = static_cast<float>(((indexW - indexR) & m_index_mask) / 2);
 
-    u32 low_watermark = (FIXED_SAMPLE_RATE_DIVIDEND * timing_variance) /
+    u32 low_watermark = (FIXED_SAMPLE_RATE_DIVIDEND * target_latency) /
                         (static_cast<u64>(m_input_sample_rate_divisor) * 1000);
-    low_watermark = std::min(low_watermark, MAX_SAMPLES / 2);
+    low_watermark = std::min(low_watermark, m_capacity / 2);
 
     m_numLeftI = (numLeft + m_numLeftI * (CONTROL_AVG - 1)) / CONTROL_AVG;
     float offset = (m_numLeftI - low_watermark) * CONTROL_FACTOR;
@@ -103,24 +125,62 @@ unsigned int Mixer::MixerFifo::Mix(short* samples, unsigned int numSamples,
   s32 lvolume = m_LVolume.load();
   s32 rvolume = m_RVolume.load();
 
-  const auto read_buffer = [this](auto index) {
-    return m_little_endian ? m_buffer[index] : Common::swap16(m_buffer[index]);
-  };
+  unsigned int currentSample;
+  if (m_mixer->m_config_sinc_resampling)
+  {
+    m_resampler.SetRatio(m_mixer->m_sampleRate / static_cast<double>(nominal_sample_rate));
+    currentSample = MixSinc(samples, numSamples, indexR, indexW, ratio, lvolume, rvolume);
+  }
+  else
+  {
+    currentSample = MixLinear(samples, numSamples, indexR, indexW, ratio, lvolume, rvolume);
+  }
+
+  // Actual number of samples written to the buffer without padding.
+  unsigned int actual_sample_count = currentSample / 2;
+  if (actual_sample_count < numSamples)
+    m_underruns.fetch_add(1, std::memory_order_relaxed);
+
+  // Padding
+  short s[2];
+  s[0] = ReadBuffer(indexR - 1);
+  s[1] = ReadBuffer(indexR - 2);
+  s[0] = (s[0] * rvolume) >> 8;
+  s[1] = (s[1] * lvolume) >> 8;
+  for (; currentSample < numSamples * 2; currentSample += 2)
+  {
+    int sampleR = std::clamp(s[0] + samples[currentSample + 0], -32767, 32767);
+    int sampleL = std::clamp(s[1] + samples[currentSample + 1], -32767, 32767);
+
+    samples[currentSample + 0] = sampleR;
+    samples[currentSample + 1] = sampleL;
+  }
+
+  // Flush cached variable
+  m_indexR.store(indexR);
+
+  return actual_sample_count;
+}
 
-  // TODO: consider a higher-quality resampling algorithm.
-  for (; currentSample < numSamples * 2 && ((indexW - indexR) & INDEX_MASK) > 2; currentSample += 2)
+// Returns the index in samples[] one past the last sample written.
+unsigned int Mixer::MixerFifo::MixLinear(short* samples, unsigned int numSamples, u32& indexR,
+                                         u32 indexW, u32 ratio, s32 lvolume, s32 rvolume)
+{
+  unsigned int currentSample = 0;
+  for (; currentSample < numSamples * 2 && ((indexW - indexR) & m_index_mask) > 2;
+       currentSample += 2)
   {
     u32 indexR2 = indexR + 2;  // next sample
 
-    s16 l1 = read_buffer(indexR & INDEX_MASK);   // current
-    s16 l2 = read_buffer(indexR2 & INDEX_MASK);  // next
+    s16 l1 = ReadBuffer(indexR);   // current
+    s16 l2 = ReadBuffer(indexR2);  // next
     int sampleL = ((l1 << 16) + (l2 - l1) * (u16)m_frac) >> 16;
     sampleL = (sampleL * lvolume) >> 8;
     sampleL += samples[currentSample + 1];
     samples[currentSample + 1] = std::clamp(sampleL, -32767, 32767);
 
-    s16 r1 = read_buffer((indexR + 1) & INDEX_MASK);   // current
-    s16 r2 = read_buffer((indexR2 + 1) & INDEX_MASK);  // next
+    s16 r1 = ReadBuffer(indexR + 1);   // current
+    s16 r2 = ReadBuffer(indexR2 + 1);  // next
     int sampleR = ((r1 << 16) + (r2 - r1) * (u16)m_frac) >> 16;
     sampleR = (sampleR * rvolume) >> 8;
     sampleR += samples[currentSample];
@@ -130,29 +190,57 @@ unsigned int Mixer::MixerFifo::Mix(short* samples, unsigned int numSamples,
     indexR += 2 * (u16)(m_frac >> 16);
     m_frac &= 0xffff;
   }
+  return currentSample;
+}
 
-  // Actual number of samples written to the buffer without padding.
-  unsigned int actual_sample_count = currentSample / 2;
+unsigned int Mixer::MixerFifo::MixSinc(short* samples, unsigned int numSamples, u32& indexR,
+                                       u32 indexW, u32 ratio, s32 lvolume, s32 rvolume)
+{
+  using AudioCommon::SincResampler;
 
-  // Padding
-  short s[2];
-  s[0] = read_buffer((indexR - 1) & INDEX_MASK);
-  s[1] = read_buffer((indexR - 2) & INDEX_MASK);
-  s[0] = (s[0] * rvolume) >> 8;
-  s[1] = (s[1] * lvolume) >> 8;
-  for (; currentSample < numSamples * 2; currentSample += 2)
+  const u32 available = ((indexW - indexR) & m_index_mask) / 2;
+  if (available <= SincResampler::TAPS_AFTER)
+    return 0;
+
+  // Every output sample reads TAPS_BEFORE input samples behind and TAPS_AFTER samples ahead of
+  // the read position. Unpack that whole window once into contiguous native-endian buffers, one
+  // per channel, so that the filter can load its taps directly.
+  const u64 needed = ((m_frac + u64{numSamples} * ratio) >> 16) + SincResampler::TAPS_AFTER + 1;
+  const u32 count = static_cast<u32>(std::min<u64>(available, needed));
+  u32 index = indexR - SincResampler::TAPS_BEFORE * 2;
+  for (u32 i = 0; i < count + SincResampler::TAPS_BEFORE; ++i, index += 2)
   {
-    int sampleR = std::clamp(s[0] + samples[currentSample + 0], -32767, 32767);
-    int sampleL = std::clamp(s[1] + samples[currentSample + 1], -32767, 32767);
+    m_sinc_input_l[i] = ReadBuffer(index);
+    m_sinc_input_r[i] = ReadBuffer(index + 1);
+  }
 
-    samples[currentSample + 0] = sampleR;
-    samples[currentSample + 1] = sampleL;
+  unsigned int currentSample = 0;
+  u32 position = 0;
+  for (; currentSample < numSamples * 2 && position + SincResampler::TAPS_AFTER < count;
+       currentSample += 2)
+  {
+    int sampleL = m_resampler.Interpolate(&m_sinc_input_l[position], m_frac);
+    sampleL = (sampleL * lvolume) >> 8;
+    sampleL += samples[currentSample + 1];
+    samples[currentSample + 1] = std::clamp(sampleL, -32767, 32767);
+
+    int sampleR = m_resampler.Interpolate(&m_sinc_input_r[position], m_frac);
+    sampleR = (sampleR * rvolume) >> 8;
+    sampleR += samples[currentSample];
+    samples[currentSample] = std::clamp(sampleR, -32767, 32767);
+
+    m_frac += ratio;
+    position += m_frac >> 16;
+    m_frac &= 0xffff;
   }
 
-  // Flush cached variable
-  m_indexR.store(indexR);
+  indexR += std::min(position, available) * 2;
+  return currentSample;
+}
 
-  return actual_sample_count;
+Mixer::FifoStatistics Mixer::GetDMAStatistics() const
+{
+  return m_dma_mixer.GetStatistics();
 }
 
 unsigned int Mixer::Mix(short* samples, unsigned int num_samples)
@@ -165,31 +253,32 @@ unsigned int Mixer::Mix(short* samples, unsigned int num_samples)
   // TODO: Determine how emulation speed will be used in audio
   // const float emulation_speed = g_perf_metrics.GetSpeed();
   const float emulation_speed = m_config_emulation_speed;
-  const int timing_variance = m_config_timing_variance;
+  const int target_latency =
+      m_config_buffer_latency > 0 ? m_config_buffer_latency : m_config_timing_variance;
   if (m_config_audio_stretch)
   {
     unsigned int available_samples =
         std::min(m_dma_mixer.AvailableSamples(), m_streaming_mixer.AvailableSamples());
 
-    ASSERT_MSG(AUDIO, available_samples <= MAX_SAMPLES,
+    ASSERT_MSG(AUDIO, available_samples <= m_fifo_capacity,
                "Audio stretching would overflow m_scratch_buffer: min({}, {}) -> {} > {} ({})",
                m_dma_mixer.AvailableSamples(), m_streaming_mixer.AvailableSamples(),
-               available_samples, MAX_SAMPLES, num_samples);
+               available_samples, m_fifo_capacity, num_samples);
 
-    m_scratch_buffer.fill(0);
+    std::ranges::fill(m_scratch_buffer, 0);
 
     m_dma_mixer.Mix(m_scratch_buffer.data(), available_samples, false, emulation_speed,
-                    timing_variance);
+                    target_latency);
     m_streaming_mixer.Mix(m_scratch_buffer.data(), available_samples, false, emulation_speed,
-                          timing_variance);
+                          target_latency);
     m_wiimote_speaker_mixer.Mix(m_scratch_buffer.data(), available_samples, false, emulation_speed,
-                                timing_variance);
+                                target_latency);
     m_skylander_portal_mixer.Mix(m_scratch_buffer.data(), available_samples, false, emulation_speed,
-                                 timing_variance);
+                                 target_latency);
     for (auto& mixer : m_gba_mixers)
     {
       mixer.Mix(m_scratch_buffer.data(), available_samples, false, emulation_speed,
-                timing_variance);
+                target_latency);
     }
 
     if (!m_is_stretching)
@@ -202,12 +291,12 @@ unsigned int Mixer::Mix(short* samples, unsigned int num_samples)
   }
   else
   {
-    m_dma_mixer.Mix(samples, num_samples, true, emulation_speed, timing_variance);
-    m_streaming_mixer.Mix(samples, num_samples, true, emulation_speed, timing_variance);
-    m_wiimote_speaker_mixer.Mix(samples, num_samples, true, emulation_speed, timing_variance);
-    m_skylander_portal_mixer.Mix(samples, num_samples, true, emulation_speed, timing_variance);
+    m_dma_mixer.Mix(samples, num_samples, true, emulation_speed, target_latency);
+    m_streaming_mixer.Mix(samples, num_samples, true, emulation_speed, target_latency);
+    m_wiimote_speaker_mixer.Mix(samples, num_samples, true, emulation_speed, target_latency);
+    m_skylander_portal_mixer.Mix(samples, num_samples, true, emulation_speed, target_latency);
     for (auto& mixer : m_gba_mixers)
-      mixer.Mix(samples, num_samples, true, emulation_speed, timing_variance);
+      mixer.Mix(samples, num_samples, true, emulation_speed, target_latency);
     m_is_stretching = false;
   }
 
@@ -225,9 +314,9 @@ unsigned int Mixer::MixSurround(float* samples, unsigned int num_samples)
 
   // Mix() may also use m_scratch_buffer internally, but is safe because it alternates reads
   // and writes.
-  ASSERT_MSG(AUDIO, needed_frames <= MAX_SAMPLES,
+  ASSERT_MSG(AUDIO, needed_frames <= m_fifo_capacity,
              "needed_frames would overflow m_scratch_buffer: {} -> {} > {}", num_samples,
-             needed_frames, MAX_SAMPLES);
+             needed_frames, m_fifo_capacity);
   size_t available_frames = Mix(m_scratch_buffer.data(), static_cast<u32>(needed_frames));
   if (available_frames != needed_frames)
   {
@@ -252,21 +341,26 @@ void Mixer::MixerFifo::PushSamples(const short* samples, unsigned int num_sample
 
   // Check if we have enough free space
   // indexW == m_indexR results in empty buffer, so indexR must always be smaller than indexW
-  if (num_samples * 2 + ((indexW - m_indexR.load()) & INDEX_MASK) >= MAX_SAMPLES * 2)
+  // The samples right behind indexR are kept as well, as the sinc resampler still reads them.
+  constexpr u32 history = AudioCommon::SincResampler::TAPS_BEFORE;
+  if ((num_samples + history) * 2 + ((indexW - m_indexR.load()) & m_index_mask) >= m_capacity * 2)
+  {
+    m_overflows.fetch_add(1, std::memory_order_relaxed);
     return;
+  }
 
   // AyuanX: Actual re-sampling work has been moved to sound thread
   // to alleviate the workload on main thread
   // and we simply store raw data here to make fast mem copy
-  int over_bytes = num_samples * 4 - (MAX_SAMPLES * 2 - (indexW & INDEX_MASK)) * sizeof(short);
+  int over_bytes = num_samples * 4 - (m_capacity * 2 - (indexW & m_index_mask)) * sizeof(short);
   if (over_bytes > 0)
   {
-    memcpy(&m_buffer[indexW & INDEX_MASK], samples, num_samples * 4 - over_bytes);
+    memcpy(&m_buffer[indexW & m_index_mask], samples, num_samples * 4 - over_bytes);
     memcpy(&m_buffer[0], samples + (num_samples * 4 - over_bytes) / sizeof(short), over_bytes);
   }
   else
   {
-    memcpy(&m_buffer[indexW & INDEX_MASK], samples, num_samples * 4);
+    memcpy(&m_buffer[indexW & m_index_mask], samples, num_samples * 4);
   }
 
   m_indexW.fetch_add(num_samples * 2);
@@ -457,7 +551,9 @@ void Mixer::RefreshConfig()
 {
   m_config_emulation_speed = Config::Get(Config::MAIN_EMULATION_SPEED);
   m_config_timing_variance = Config::Get(Config::MAIN_TIMING_VARIANCE);
+  m_config_buffer_latency = Config::Get(Config::MAIN_AUDIO_BUFFER_LATENCY);
   m_config_audio_stretch = Config::Get(Config::MAIN_AUDIO_STRETCH);
+  m_config_sinc_resampling = Config::Get(Config::MAIN_AUDIO_SINC_RESAMPLING);
 }
 
 void Mixer::MixerFifo::DoState(PointerWrap& p)
@@ -467,6 +563,15 @@ void Mixer::MixerFifo::DoState(PointerWrap& p)
   p.Do(m_RVolume);
 }
 
+void Mixer::MixerFifo::SetCapacity(u32 capacity)
+{
+  m_capacity = capacity;
+  m_index_mask = capacity * 2 - 1;
+  m_buffer.assign(capacity * 2, 0);
+  m_sinc_input_l.resize(capacity + AudioCommon::SincResampler::TAPS_BEFORE);
+  m_sinc_input_r.resize(capacity + AudioCommon::SincResampler::TAPS_BEFORE);
+}
+
 void Mixer::MixerFifo::SetInputSampleRateDivisor(unsigned int rate_divisor)
 {
   m_input_sample_rate_divisor = rate_divisor;
@@ -490,9 +595,21 @@ std::pair<s32, s32> Mixer::MixerFifo::GetVolume() const
 
 unsigned int Mixer::MixerFifo::AvailableSamples() const
 {
-  unsigned int samples_in_fifo = ((m_indexW.load() - m_indexR.load()) & INDEX_MASK) / 2;
-  if (samples_in_fifo <= 1)
-    return 0;  // Mixer::MixerFifo::Mix always keeps one sample in the buffer.
-  return (samples_in_fifo - 1) * static_cast<u64>(m_mixer->m_sampleRate) *
+  unsigned int samples_in_fifo = ((m_indexW.load() - m_indexR.load()) & m_index_mask) / 2;
+  // Mixer::MixerFifo::Mix always keeps the samples in the buffer that the interpolation reads ahead
+  // of the read position: one for linear interpolation, TAPS_AFTER for the sinc resampler.
+  const unsigned int kept_samples =
+      m_mixer->m_config_sinc_resampling ? AudioCommon::SincResampler::TAPS_AFTER : 1;
+  if (samples_in_fifo <= kept_samples)
+    return 0;
+  return (samples_in_fifo - kept_samples) * static_cast<u64>(m_mixer->m_sampleRate) *
          m_input_sample_rate_divisor / FIXED_SAMPLE_RATE_DIVIDEND;
 }
+
+Mixer::FifoStatistics Mixer::MixerFifo::GetStatistics() const
+{
+  return {.buffered_samples = ((m_indexW.load() - m_indexR.load()) & m_index_mask) / 2,
+          .capacity = m_capacity,
+          .underruns = m_underruns.load(std::memory_order_relaxed),
+          .overflows = m_overflows.load(std::memory_order_relaxed)};
+}
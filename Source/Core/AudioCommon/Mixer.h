@@ -5,8 +5,10 @@
 
 #include <array>
 #include <atomic>
+#include <vector>
 
 #include "AudioCommon/AudioStretcher.h"
+#include "AudioCommon/SincResampler.h"
 #include "AudioCommon/SurroundDecoder.h"
 #include "AudioCommon/WaveFile.h"
 #include "Common/CommonTypes.h"
@@ -20,6 +22,17 @@ public:
   explicit Mixer(unsigned int BackendSampleRate);
   ~Mixer();
 
+  struct FifoStatistics
+  {
+    // Stereo samples waiting to be mixed, and how many the FIFO can hold.
+    u32 buffered_samples;
+    u32 capacity;
+    // Mix calls that ran out of samples and had to pad their output.
+    u64 underruns;
+    // PushSamples calls that were dropped because the FIFO was full.
+    u64 overflows;
+  };
+
   void DoState(PointerWrap& p);
 
   // Called from audio threads
@@ -36,6 +49,9 @@ public:
 
   unsigned int GetSampleRate() const { return m_sampleRate; }
 
+  // Can be called from any thread.
+  FifoStatistics GetDMAStatistics() const;
+
   void SetDMAInputSampleRateDivisor(unsigned int rate_divisor);
   void SetStreamInputSampleRateDivisor(unsigned int rate_divisor);
   void SetGBAInputSampleRateDivisors(int device_number, unsigned int rate_divisor);
@@ -54,8 +70,8 @@ public:
   static constexpr u64 FIXED_SAMPLE_RATE_DIVIDEND = 54000000 * 2;
 
 private:
+  // Default FIFO size, used unless a larger target latency is configured.
   static constexpr u32 MAX_SAMPLES = 1024 * 4;  // 128 ms
-  static constexpr u32 INDEX_MASK = MAX_SAMPLES * 2 - 1;
   static constexpr int MAX_FREQ_SHIFT = 200;  // Per 32000 Hz
   static constexpr float CONTROL_FACTOR = 0.2f;
   static constexpr u32 CONTROL_AVG = 32;  // In freq_shift per FIFO size offset
@@ -71,20 +87,31 @@ private:
     {
     }
     void DoState(PointerWrap& p);
+    // Must be called before any samples are pushed. Capacity must be a power of two.
+    void SetCapacity(u32 capacity);
     void PushSamples(const short* samples, unsigned int num_samples);
     unsigned int Mix(short* samples, unsigned int numSamples, bool consider_framelimit,
-                     float emulationspeed, int timing_variance);
+                     float emulationspeed, int target_latency);
     void SetInputSampleRateDivisor(unsigned int rate_divisor);
     unsigned int GetInputSampleRateDivisor() const;
     void SetVolume(unsigned int lvolume, unsigned int rvolume);
     std::pair<s32, s32> GetVolume() const;
     unsigned int AvailableSamples() const;
+    FifoStatistics GetStatistics() const;
 
   private:
+    unsigned int MixLinear(short* samples, unsigned int numSamples, u32& indexR, u32 indexW,
+                           u32 ratio, s32 lvolume, s32 rvolume);
+    unsigned int MixSinc(short* samples, unsigned int numSamples, u32& indexR, u32 indexW,
+                         u32 ratio, s32 lvolume, s32 rvolume);
+    s16 ReadBuffer(u32 index) const;
+
     Mixer* m_mixer;
     unsigned m_input_sample_rate_divisor;
     bool m_little_endian;
-    std::array<short, MAX_SAMPLES * 2> m_buffer{};
+    u32 m_capacity = 0;
+    u32 m_index_mask = 0;
+    std::vector<short> m_buffer;
     std::atomic<u32> m_indexW{0};
     std::atomic<u32> m_indexR{0};
     // Volume ranges from 0-256
@@ -92,6 +119,12 @@ private:
     std::atomic<s32> m_RVolume{256};
     float m_numLeftI = 0.0f;
     u32 m_frac = 0;
+    std::atomic<u64> m_underruns{0};
+    std::atomic<u64> m_overflows{0};
+    // Only used by the audio thread, to unpack the input for the sinc resampler.
+    AudioCommon::SincResampler m_resampler;
+    std::vector<s16> m_sinc_input_l;
+    std::vector<s16> m_sinc_input_r;
   };
 
   void RefreshConfig();
@@ -109,7 +142,8 @@ private:
   bool m_is_stretching = false;
   AudioCommon::AudioStretcher m_stretcher;
   AudioCommon::SurroundDecoder m_surround_decoder;
-  std::array<short, MAX_SAMPLES * 2> m_scratch_buffer{};
+  u32 m_fifo_capacity = MAX_SAMPLES;
+  std::vector<short> m_scratch_buffer;
 
   WaveFileWriter m_wave_writer_dtk;
   WaveFileWriter m_wave_writer_dsp;
@@ -119,7 +153,9 @@ private:
 
   float m_config_emulation_speed;
   int m_config_timing_variance;
+  int m_config_buffer_latency;
   bool m_config_audio_stretch;
+  bool m_config_sinc_resampling;
 
   Config::ConfigChangedCallbackID m_config_changed_callback_id;
 };
@@ -0,0 +1,130 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "AudioCommon/SincResampler.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Common/CommonTypes.h"
+#include "Common/MathUtil.h"
+
+#if defined(_M_X86_64)
+#include <emmintrin.h>
+#elif defined(_M_ARM_64)
+#include <arm_neon.h>
+#endif
+
+namespace AudioCommon
+{
+// Fraction of the Nyquist frequency that is kept, leaving room for the transition band.
+constexpr double PASSBAND = 0.9;
+
+static double Sinc(double x)
+{
+  if (x == 0.0)
+    return 1.0;
+  return std::sin(MathUtil::PI * x) / (MathUtil::PI * x);
+}
+
+static double Blackman(double t, double half_width)
+{
+  const double x = MathUtil::PI * t / half_width;
+  return 0.42 + 0.5 * std::cos(x) + 0.08 * std::cos(2.0 * x);
+}
+
+SincResampler::SincResampler()
+{
+  SetRatio(1.0);
+}
+
+void SincResampler::SetRatio(double output_per_input)
+{
+  const double cutoff = std::min(output_per_input, 1.0) * PASSBAND;
+  if (cutoff == m_cutoff)
+    return;
+  m_cutoff = cutoff;
+
+  constexpr double half_width = NUM_TAPS / 2;
+  constexpr s32 unity = 1 << COEF_BITS;
+
+  for (u32 phase = 0; phase < NUM_PHASES; ++phase)
+  {
+    const double frac = static_cast<double>(phase) / NUM_PHASES;
+
+    std::array<double, NUM_TAPS> taps;
+    double sum = 0.0;
+    for (u32 i = 0; i < NUM_TAPS; ++i)
+    {
+      const double t = static_cast<double>(i) - TAPS_BEFORE - frac;
+      taps[i] = cutoff * Sinc(cutoff * t) * Blackman(t, half_width);
+      sum += taps[i];
+    }
+
+    // Normalize every phase to unity gain so that DC passes through unchanged, and put the
+    // rounding error into the largest tap.
+    s32 total = 0;
+    u32 largest = 0;
+    for (u32 i = 0; i < NUM_TAPS; ++i)
+    {
+      m_filters[phase][i] = static_cast<s16>(std::lround(taps[i] / sum * unity));
+      total += m_filters[phase][i];
+      if (std::abs(m_filters[phase][i]) > std::abs(m_filters[phase][largest]))
+        largest = i;
+    }
+    m_filters[phase][largest] += unity - total;
+  }
+}
+
+s32 SincResampler::Interpolate(const s16* input, u32 frac) const
+{
+  const s16* filter = GetFilter((frac & 0xffff) >> (16 - PHASE_BITS));
+#if defined(_M_X86_64) || defined(_M_ARM_64)
+  return SincDotProductSIMD(input, filter) >> COEF_BITS;
+#else
+  return SincDotProductScalar(input, filter) >> COEF_BITS;
+#endif
+}
+
+s32 SincDotProductScalar(const s16* input, const s16* filter)
+{
+  s32 sum = 0;
+  for (u32 i = 0; i < SincResampler::NUM_TAPS; ++i)
+    sum += s32(input[i]) * s32(filter[i]);
+  return sum;
+}
+
+#if defined(_M_X86_64)
+// SSE2 is part of the x86-64 baseline, so no runtime check is needed.
+s32 SincDotProductSIMD(const s16* input, const s16* filter)
+{
+  static_assert(SincResampler::NUM_TAPS == 16);
+
+  const __m128i in0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input));
+  const __m128i in1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + 8));
+  const __m128i f0 = _mm_load_si128(reinterpret_cast<const __m128i*>(filter));
+  const __m128i f1 = _mm_load_si128(reinterpret_cast<const __m128i*>(filter + 8));
+
+  __m128i sum = _mm_add_epi32(_mm_madd_epi16(in0, f0), _mm_madd_epi16(in1, f1));
+  sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(1, 0, 3, 2)));
+  sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(2, 3, 0, 1)));
+  return _mm_cvtsi128_si32(sum);
+}
+#elif defined(_M_ARM_64)
+s32 SincDotProductSIMD(const s16* input, const s16* filter)
+{
+  static_assert(SincResampler::NUM_TAPS == 16);
+
+  const int16x8_t in0 = vld1q_s16(input);
+  const int16x8_t in1 = vld1q_s16(input + 8);
+  const int16x8_t f0 = vld1q_s16(filter);
+  const int16x8_t f1 = vld1q_s16(filter + 8);
+
+  int32x4_t sum = vmull_s16(vget_low_s16(in0), vget_low_s16(f0));
+  sum = vmlal_high_s16(sum, in0, f0);
+  sum = vmlal_s16(sum, vget_low_s16(in1), vget_low_s16(f1));
+  sum = vmlal_high_s16(sum, in1, f1);
+  return vaddvq_s32(sum);
+}
+#endif
+}  // namespace AudioCommon
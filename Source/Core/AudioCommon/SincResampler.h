@@ -0,0 +1,52 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+
+#include "Common/CommonTypes.h"
+
+namespace AudioCommon
+{
+// Polyphase windowed-sinc interpolation filter. Each output sample is computed from NUM_TAPS input
+// samples around the current read position, weighted by one of NUM_PHASES precomputed filters that
+// is picked based on the fractional part of the position.
+class SincResampler
+{
+public:
+  static constexpr u32 NUM_TAPS = 16;
+  static constexpr u32 PHASE_BITS = 8;
+  static constexpr u32 NUM_PHASES = 1 << PHASE_BITS;
+
+  // How many input samples before and after the current one each output sample depends on.
+  static constexpr u32 TAPS_BEFORE = NUM_TAPS / 2 - 1;
+  static constexpr u32 TAPS_AFTER = NUM_TAPS / 2;
+
+  // Coefficients are stored as Q1.14 fixed point.
+  static constexpr u32 COEF_BITS = 14;
+
+  SincResampler();
+
+  // Rebuilds the filters for the given ratio of output to input sample rate. When downsampling,
+  // the cutoff frequency is lowered so that the output doesn't alias.
+  void SetRatio(double output_per_input);
+
+  // Interpolates one channel at <frac> (0.16 fixed point) past input[TAPS_BEFORE]. <input> must
+  // hold NUM_TAPS samples.
+  s32 Interpolate(const s16* input, u32 frac) const;
+
+  const s16* GetFilter(u32 phase) const { return m_filters[phase].data(); }
+
+private:
+  double m_cutoff = 0.0;
+  alignas(16) std::array<std::array<s16, NUM_TAPS>, NUM_PHASES> m_filters{};
+};
+
+// Reference and SIMD implementations of the NUM_TAPS long dot product used by Interpolate,
+// exposed for testing.
+s32 SincDotProductScalar(const s16* input, const s16* filter);
+#if defined(_M_X86_64) || defined(_M_ARM_64)
+s32 SincDotProductSIMD(const s16* input, const s16* filter);
+#endif
+}  // namespace AudioCommon
@@ -6,6 +6,7 @@
 #include <array>
 #include <bit>
 #include <memory>
+#include <span>
 
 #include <mbedtls/aes.h>
 
@@ -31,6 +32,16 @@
 
 namespace Common::AES
 {
+bool Context::CryptBatch(std::span<const BatchItem> items, size_t len) const
+{
+  for (const BatchItem& item : items)
+  {
+    if (!Crypt(item.iv, item.buf_in, item.buf_out, len))
+      return false;
+  }
+  return true;
+}
+
 // For x64 and arm64, it's very unlikely a user's cpu does not support the accelerated version,
 // fallback is just in case.
 template <Mode AesMode>
@@ -172,6 +183,38 @@ public:
     _mm_storeu_si128((__m128i*)buf_out, block);
   }
 
+  // Encrypts several independent streams at once, for the same reason as DecryptPipelined.
+  template <size_t NumItems>
+  ATTRIBUTE_TARGET("aes")
+  inline void EncryptInterleaved(const BatchItem* items, size_t len) const
+  {
+    __m128i iv[NumItems];
+    for (size_t d = 0; d < NumItems; d++)
+      iv[d] = items[d].iv ? _mm_loadu_si128((const __m128i*)items[d].iv) : _mm_setzero_si128();
+
+    for (size_t offset = 0; offset < len; offset += BLOCK_SIZE)
+    {
+      __m128i block[NumItems];
+      for (size_t d = 0; d < NumItems; d++)
+      {
+        block[d] = _mm_loadu_si128((const __m128i*)(items[d].buf_in + offset));
+        block[d] = _mm_xor_si128(_mm_xor_si128(block[d], iv[d]), round_keys[0]);
+      }
+
+      for (size_t i = 1; i < Nr; ++i)
+        for (size_t d = 0; d < NumItems; d++)
+          block[d] = _mm_aesenc_si128(block[d], round_keys[i]);
+      for (size_t d = 0; d < NumItems; d++)
+        block[d] = _mm_aesenclast_si128(block[d], round_keys[Nr]);
+
+      for (size_t d = 0; d < NumItems; d++)
+      {
+        iv[d] = block[d];
+        _mm_storeu_si128((__m128i*)(items[d].buf_out + offset), block[d]);
+      }
+    }
+  }
+
   // Takes advantage of instruction pipelining to parallelize.
   template <size_t NumBlocks>
   ATTRIBUTE_TARGET("aes")
@@ -250,6 +293,24 @@ public:
     return true;
   }
 
+  virtual bool CryptBatch(std::span<const BatchItem> items, size_t len) const override
+  {
+    // Decryption is already pipelined within each item.
+    if constexpr (AesMode == Mode::Decrypt)
+      return Context::CryptBatch(items, len);
+
+    if (len % BLOCK_SIZE)
+      return false;
+
+    // Like BLOCK_DEPTH for decryption, but there are fewer items than blocks in typical use.
+    while (items.size() >= BATCH_SIZE)
+    {
+      EncryptInterleaved<BATCH_SIZE>(items.data(), len);
+      items = items.subspan(BATCH_SIZE);
+    }
+    return Context::CryptBatch(items, len);
+  }
+
 private:
   // Ensures alignment specifiers are respected.
   struct XmmReg
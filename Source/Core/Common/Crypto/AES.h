@@ -4,6 +4,7 @@
 #pragma once
 
 #include <memory>
+#include <span>
 
 #include "Common/CommonTypes.h"
 
@@ -30,6 +31,15 @@ public:
   static constexpr size_t KEY_SIZE = Nk * WORD_SIZE;
   static constexpr size_t BLOCK_SIZE = Nb * WORD_SIZE;
 
+  // One of several independent CBC operations of the same length
+  struct BatchItem
+  {
+    // nullptr means an all-zero IV
+    const u8* iv;
+    const u8* buf_in;
+    u8* buf_out;
+  };
+
   Context() = default;
   virtual ~Context() = default;
   virtual bool Crypt(const u8* iv, u8* iv_out, const u8* buf_in, u8* buf_out, size_t len) const = 0;
@@ -41,6 +51,11 @@ public:
   {
     return Crypt(nullptr, nullptr, buf_in, buf_out, len);
   }
+  // Each block of CBC encryption depends on the previous one, so accelerated implementations
+  // interleave the items to keep the AES unit busy. The items must not overlap each other.
+  // Batches are fastest when their size is a multiple of BATCH_SIZE.
+  static constexpr size_t BATCH_SIZE = 8;
+  virtual bool CryptBatch(std::span<const BatchItem> items, size_t len) const;
 };
 
 std::unique_ptr<Context> CreateContextEncrypt(const u8* key);
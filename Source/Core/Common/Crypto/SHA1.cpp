@@ -379,11 +379,39 @@ std::unique_ptr<Context> CreateContext()
   return std::make_unique<ContextMbed>();
 }
 
+template <typename ContextType>
+static void CalculateDigestsWithContext(const u8* msgs, size_t len, size_t count, Digest* digests)
+{
+  for (size_t i = 0; i < count; ++i)
+  {
+    ContextType ctx;
+    Context& base = ctx;
+    base.Update(msgs + i * len, len);
+    digests[i] = base.Finish();
+  }
+}
+
+void CalculateDigests(const u8* msgs, size_t len, size_t count, Digest* digests)
+{
+  // Same as CreateContext, but the contexts live on the stack instead of being allocated for
+  // every message.
+  if (cpu_info.bSHA1)
+  {
+#ifdef _M_X86_64
+    if (cpu_info.bSSSE3)
+      return CalculateDigestsWithContext<ContextX64SHA1>(msgs, len, count, digests);
+#elif defined(_M_ARM_64)
+    return CalculateDigestsWithContext<ContextNeon>(msgs, len, count, digests);
+#endif
+  }
+  CalculateDigestsWithContext<ContextMbed>(msgs, len, count, digests);
+}
+
 Digest CalculateDigest(const u8* msg, size_t len)
 {
-  auto ctx = CreateContext();
-  ctx->Update(msg, len);
-  return ctx->Finish();
+  Digest digest;
+  CalculateDigests(msg, len, 1, &digest);
+  return digest;
 }
 
 std::string DigestToString(const Digest& digest)
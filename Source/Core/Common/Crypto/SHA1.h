@@ -37,6 +37,10 @@ std::unique_ptr<Context> CreateContext();
 
 Digest CalculateDigest(const u8* msg, size_t len);
 
+// Calculates the digests of count messages of len bytes each, which are stored back to back.
+// Faster than calling CalculateDigest for each message.
+void CalculateDigests(const u8* msgs, size_t len, size_t count, Digest* digests);
+
 template <typename T>
 inline Digest CalculateDigest(const std::vector<T>& msg)
 {
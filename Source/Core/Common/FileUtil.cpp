@@ -856,6 +856,7 @@ static void RebuildUserDirectories(unsigned int dir_index)
     s_user_paths[D_COVERCACHE_IDX] = s_user_paths[D_CACHE_IDX] + COVERCACHE_DIR DIR_SEP;
     s_user_paths[D_REDUMPCACHE_IDX] = s_user_paths[D_CACHE_IDX] + REDUMPCACHE_DIR DIR_SEP;
     s_user_paths[D_SHADERCACHE_IDX] = s_user_paths[D_CACHE_IDX] + SHADERCACHE_DIR DIR_SEP;
+    s_user_paths[D_JITCACHE_IDX] = s_user_paths[D_CACHE_IDX] + JITCACHE_DIR DIR_SEP;
     s_user_paths[D_RETROACHIEVEMENTSCACHE_IDX] =
         s_user_paths[D_CACHE_IDX] + RETROACHIEVEMENTSCACHE_DIR DIR_SEP;
     s_user_paths[D_SHADERS_IDX] = s_user_paths[D_USER_IDX] + SHADERS_DIR DIR_SEP;
@@ -941,6 +942,7 @@ static void RebuildUserDirectories(unsigned int dir_index)
     s_user_paths[D_COVERCACHE_IDX] = s_user_paths[D_CACHE_IDX] + COVERCACHE_DIR DIR_SEP;
     s_user_paths[D_REDUMPCACHE_IDX] = s_user_paths[D_CACHE_IDX] + REDUMPCACHE_DIR DIR_SEP;
     s_user_paths[D_SHADERCACHE_IDX] = s_user_paths[D_CACHE_IDX] + SHADERCACHE_DIR DIR_SEP;
+    s_user_paths[D_JITCACHE_IDX] = s_user_paths[D_CACHE_IDX] + JITCACHE_DIR DIR_SEP;
     s_user_paths[D_RETROACHIEVEMENTSCACHE_IDX] =
         s_user_paths[D_CACHE_IDX] + RETROACHIEVEMENTSCACHE_DIR DIR_SEP;
     break;
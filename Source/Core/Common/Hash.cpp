@@ -7,6 +7,7 @@
 #include <bit>
 #include <cstring>
 
+#include <xxhash.h>
 #include <zlib.h>
 
 #include "Common/BitUtils.h"
@@ -424,6 +425,11 @@ static u64 SetHash64Function(const u8* src, u32 len, u32 samples)
 
 u64 GetHash64(const u8* src, u32 len, u32 samples)
 {
+  // When every word would be sampled anyway, use XXH3. It is vectorized and much faster than the
+  // CRC32 based hashes, which are limited by the latency of the CRC32 instruction.
+  if (samples == 0 || samples >= len / 8)
+    return XXH3_64bits(src, len);
+
   return s_texture_hash_func(src, len, samples);
 }
 
@@ -104,6 +104,11 @@ const Info<ShaderCompilationMode> GFX_SHADER_COMPILATION_MODE{
 const Info<int> GFX_SHADER_COMPILER_THREADS{{System::GFX, "Settings", "ShaderCompilerThreads"}, 1};
 const Info<int> GFX_SHADER_PRECOMPILER_THREADS{
     {System::GFX, "Settings", "ShaderPrecompilerThreads"}, -1};
+const Info<int> GFX_TEXTURE_DECODING_THREADS{
+    {System::GFX, "Settings", "TextureDecodingThreads"}, -1};
+const Info<bool> GFX_TEXTURE_DISK_CACHE{{System::GFX, "Settings", "TextureDiskCache"}, false};
+const Info<int> GFX_TEXTURE_DISK_CACHE_SIZE{{System::GFX, "Settings", "TextureDiskCacheSize"},
+                                            1024};
 const Info<bool> GFX_SAVE_TEXTURE_CACHE_TO_STATE{
     {System::GFX, "Settings", "SaveTextureCacheToState"}, true};
 const Info<bool> GFX_PREFER_VS_FOR_LINE_POINT_EXPANSION{
@@ -29,6 +29,7 @@ static void LoadFromDTM(Config::Layer* config_layer, Movie::DTMHeader* dtm)
 {
   config_layer->Set(Config::MAIN_CPU_THREAD, dtm->bDualCore);
   config_layer->Set(Config::MAIN_DSP_HLE, dtm->bDSPHLE);
+  config_layer->Set(Config::MAIN_DSP_HLE_ASYNC_MIXING, dtm->bDSPHLEAsyncMixing);
   config_layer->Set(Config::MAIN_FAST_DISC_SPEED, dtm->bFastDiscSpeed);
   config_layer->Set(Config::MAIN_CPU_CORE, static_cast<PowerPC::CPUCore>(dtm->CPUCore));
   config_layer->Set(Config::MAIN_SYNC_GPU, dtm->bSyncGPU);
@@ -58,6 +59,7 @@ void SaveToDTM(Movie::DTMHeader* dtm)
 {
   dtm->bDualCore = Config::Get(Config::MAIN_CPU_THREAD);
   dtm->bDSPHLE = Config::Get(Config::MAIN_DSP_HLE);
+  dtm->bDSPHLEAsyncMixing = Config::Get(Config::MAIN_DSP_HLE_ASYNC_MIXING);
   dtm->bFastDiscSpeed = Config::Get(Config::MAIN_FAST_DISC_SPEED);
   dtm->CPUCore = static_cast<u8>(Config::Get(Config::MAIN_CPU_CORE));
   dtm->bSyncGPU = Config::Get(Config::MAIN_SYNC_GPU);
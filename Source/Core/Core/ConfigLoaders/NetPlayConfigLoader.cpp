@@ -40,6 +40,7 @@ public:
     layer->Set(Config::MAIN_GC_LANGUAGE, m_settings.selected_language);
     layer->Set(Config::MAIN_OVERRIDE_REGION_SETTINGS, m_settings.override_region_settings);
     layer->Set(Config::MAIN_DSP_HLE, m_settings.dsp_hle);
+    layer->Set(Config::MAIN_DSP_HLE_ASYNC_MIXING, m_settings.dsp_hle_async_mixing);
     layer->Set(Config::MAIN_OVERCLOCK_ENABLE, m_settings.oc_enable);
     layer->Set(Config::MAIN_OVERCLOCK, m_settings.oc_factor);
     for (ExpansionInterface::Slot slot : ExpansionInterface::SLOTS)
@@ -49,6 +49,7 @@
 #include "Core/IOS/ES/ES.h"
 #include "Core/IOS/ES/Formats.h"
 #include "Core/PatchEngine.h"
+#include "Core/PowerPC/JitInterface.h"
 #include "Core/PowerPC/PPCSymbolDB.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
@@ -212,6 +213,7 @@ void SConfig::OnNewTitleLoad(const Core::CPUThreadGuard& guard)
   CBoot::LoadMapFromFilename(guard, ppc_symbol_db);
   HLE::Reload(system);
   PatchEngine::Reload(system);
+  system.GetJitInterface().OnNewTitleLoad(guard);
   HiresTexture::Update();
   WC24PatchEngine::Reload();
 }
@@ -59,6 +59,7 @@
 #include "Core/HW/GCKeyboard.h"
 #include "Core/HW/GCPad.h"
 #include "Core/HW/HW.h"
+#include "Core/HW/Memmap.h"
 #include "Core/HW/SystemTimers.h"
 #include "Core/HW/VideoInterface.h"
 #include "Core/HW/Wiimote.h"
@@ -387,6 +388,12 @@ static void CpuThread(Core::System& system, const std::optional<std::string>& sa
   if (exception_handler)
     EMM::InstallExceptionHandler();
 
+  // Dirty page tracking needs the fault handler on every thread that writes to emulated memory.
+  const bool dirty_page_tracking = exception_handler && EMM::IsExceptionHandlerProcessWide() &&
+                                   Config::Get(Config::MAIN_DIRTY_PAGE_TRACKING);
+  if (dirty_page_tracking)
+    system.GetMemory().EnableDirtyPageTracking();
+
 #ifdef USE_MEMORYWATCHER
   s_memory_watcher = std::make_unique<MemoryWatcher>();
 #endif
@@ -434,6 +441,9 @@ static void CpuThread(Core::System& system, const std::optional<std::string>& sa
   s_memory_watcher.reset();
 #endif
 
+  if (dirty_page_tracking)
+    system.GetMemory().DisableDirtyPageTracking();
+
   if (exception_handler)
     EMM::UninstallExceptionHandler();
 
@@ -903,6 +913,7 @@ void Callback_NewField(Core::System& system)
   }
 
   AchievementManager::GetInstance().DoFrame();
+  ::State::RewindOnNewField(system);
 }
 
 void UpdateTitle(Core::System& system)
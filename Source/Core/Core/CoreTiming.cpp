@@ -21,6 +21,7 @@
 #include "Core/Config/AchievementSettings.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
+#include "Core/PowerPC/JitInterface.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
 
@@ -397,11 +398,15 @@ void CoreTimingManager::Throttle(const s64 target_cycle)
   // Only sleep if we are behind the deadline
   if (time < m_throttle_deadline)
   {
+    // Let the JIT get ahead on compiling before going to sleep
+    m_system.GetJitInterface().CompileAhead(m_throttle_deadline);
+
+    // Count amount of time sleeping for analytics, but not the time spent compiling
+    const TimePoint time_before_sleep = Clock::now();
     std::this_thread::sleep_until(m_throttle_deadline);
 
-    // Count amount of time sleeping for analytics
     const TimePoint time_after_sleep = Clock::now();
-    g_perf_metrics.CountThrottleSleep(time_after_sleep - time);
+    g_perf_metrics.CountThrottleSleep(time_after_sleep - time_before_sleep);
   }
 }
 
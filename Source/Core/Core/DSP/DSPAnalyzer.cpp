@@ -60,6 +60,60 @@ constexpr u16 idle_skip_sigs[NUM_IDLE_SIGS][MAX_IDLE_SIG_SIZE + 1] = {
      0, 0},
 };
 
+// Mailbox polling loops that don't match one of the signatures above are found by looking for
+// short backwards conditional jumps over code that only reads a mailbox and sets flags.
+constexpr u16 MAX_IDLE_LOOP_SIZE = 8;
+
+// Whether the register written by LR/LRS can be reloaded any number of times without any other
+// effect. Writing to the stack registers pushes a value, so those are excluded.
+static bool IsIdempotentLoadDest(u16 reg)
+{
+  return reg >= DSP_REG_AXL0 && reg <= DSP_REG_ACM1;
+}
+
+static bool IsMailboxPollAddress(u16 address)
+{
+  return address == (0xff00 | DSP_DMBH) || address == (0xff00 | DSP_CMBH);
+}
+
+// Checks whether the instruction at addr is allowed in an idle loop. Only loads from the high
+// mailbox registers (which, unlike the low halves, have no side effects when read) and
+// instructions that do nothing but compare an accumulator and set flags are accepted, so that
+// running the loop again without the mailbox changing leaves the DSP in exactly the same state.
+static bool IsIdleLoopInstruction(const SDSP& dsp, u16 addr, bool* reads_mailbox)
+{
+  const UDSPInstruction inst = dsp.ReadIMEM(addr);
+
+  // NOP
+  if (inst == 0x0000)
+    return true;
+
+  // LRS $(0x18+D), @M - this assumes $cr is 0xff, which is what every known ucode uses.
+  if ((inst & 0xf800) == 0x2000)
+  {
+    if (!IsMailboxPollAddress(0xff00 | (inst & 0xff)))
+      return false;
+    *reads_mailbox = true;
+    return true;
+  }
+
+  // LR $D, @M
+  if ((inst & 0xffe0) == 0x00c0)
+  {
+    if (!IsIdempotentLoadDest(inst & 0x1f) ||
+        !IsMailboxPollAddress(dsp.ReadIMEM(static_cast<u16>(addr + 1))))
+    {
+      return false;
+    }
+    *reads_mailbox = true;
+    return true;
+  }
+
+  // CMPI, ANDF, ANDCF $acD.m, #I
+  const u16 masked = inst & 0xfeff;
+  return masked == 0x0280 || masked == 0x02a0 || masked == 0x02c0;
+}
+
 Analyzer::Analyzer() = default;
 Analyzer::~Analyzer() = default;
 
@@ -83,6 +137,7 @@ void Analyzer::AnalyzeRange(const SDSP& dsp, u16 start_addr, u16 end_addr)
 
   // Next, we'll scan for potential idle skips.
   FindIdleSkips(dsp, start_addr, end_addr);
+  FindIdleLoops(dsp, start_addr, end_addr);
 
   INFO_LOG_FMT(DSPLLE, "Finished analysis.");
 }
@@ -170,4 +225,33 @@ void Analyzer::FindIdleSkips(const SDSP& dsp, u16 start_addr, u16 end_addr)
     }
   }
 }
+
+void Analyzer::FindIdleLoops(const SDSP& dsp, u16 start_addr, u16 end_addr)
+{
+  for (u16 addr = start_addr; addr < end_addr; addr++)
+  {
+    // Look for a conditional JMP (not JMP itself, as that would never leave the loop).
+    const UDSPInstruction inst = dsp.ReadIMEM(addr);
+    if (!IsStartOfInstruction(addr) || (inst & 0xfff0) != 0x0290 || inst == 0x029f)
+      continue;
+
+    const u16 dest = dsp.ReadIMEM(static_cast<u16>(addr + 1));
+    if (dest >= addr || addr - dest > MAX_IDLE_LOOP_SIZE || dest < start_addr ||
+        IsIdleSkip(dest) || !IsStartOfInstruction(dest))
+    {
+      continue;
+    }
+
+    bool reads_mailbox = false;
+    u16 loop_addr = dest;
+    while (loop_addr < addr && IsIdleLoopInstruction(dsp, loop_addr, &reads_mailbox))
+      loop_addr += GetOpTemplate(dsp.ReadIMEM(loop_addr))->size;
+
+    if (loop_addr == addr && reads_mailbox)
+    {
+      INFO_LOG_FMT(DSPLLE, "Idle loop found at {:02x} (jump at {:02x})", dest, addr);
+      m_code_flags[dest] |= CODE_IDLE_SKIP;
+    }
+  }
+}
 }  // namespace DSP
@@ -26,7 +26,6 @@ using namespace Gen;
 namespace DSP::JIT::x64
 {
 constexpr size_t COMPILED_CODE_SIZE = 2097152;
-constexpr size_t MAX_BLOCK_SIZE = 250;
 constexpr u16 DSP_IDLE_SKIP_CYCLES = 0x1000;
 
 DSPEmitter::DSPEmitter(DSPCore& dsp)
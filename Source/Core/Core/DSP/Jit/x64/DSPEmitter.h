@@ -34,6 +34,9 @@ public:
   void DoState(PointerWrap& p) override;
   void ClearIRAM() override;
 
+  // Exposed for testing; blocks are always linked otherwise. Only affects blocks compiled later.
+  void SetBlockLinkingEnabled(bool enabled) { m_block_linking_enabled = enabled; }
+
   // Ext commands
   void l(UDSPInstruction opc);
   void ln(UDSPInstruction opc);
@@ -212,7 +215,7 @@ private:
   void FallBackToInterpreter(UDSPInstruction inst);
 
   void WriteBranchExit();
-  void WriteBlockLink(u16 dest);
+  void WriteBlockLink(u16 dest, bool wait_for_dest);
 
   void ReJitConditional(UDSPInstruction opc, void (DSPEmitter::*conditional_fn)(UDSPInstruction));
   void r_jcc(UDSPInstruction opc);
@@ -309,6 +312,7 @@ private:
   void multiply_mulx(u8 axh0, u8 axh1);
 
   static constexpr size_t MAX_BLOCKS = 0x10000;
+  static constexpr u16 MAX_BLOCK_SIZE = 250;
 
   DSPJitRegCache m_gpr{*this};
 
@@ -324,6 +328,7 @@ private:
   std::array<std::list<u16>, MAX_BLOCKS> m_unresolved_jumps;
 
   u16 m_cycles_left = 0;
+  bool m_block_linking_enabled = true;
 
   // The index of the last stored ext value (compile time).
   int m_store_index = -1;
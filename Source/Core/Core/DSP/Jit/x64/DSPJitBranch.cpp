@@ -114,8 +114,32 @@ void DSPEmitter::WriteBranchExit()
   m_gpr.FlushRegs(c, false);
 }
 
-void DSPEmitter::WriteBlockLink(u16 dest)
+void DSPEmitter::WriteBlockLink(u16 dest, bool wait_for_dest)
 {
+  if (!m_block_linking_enabled)
+    return;
+
+  // Loop back to the start of the block being compiled, unless it's an idle skip: those have to
+  // return to the dispatcher so that the skipped cycles get accounted for.
+  if (dest == m_start_address)
+  {
+    if (m_dsp_core.DSPState().GetAnalyzer().IsIdleSkip(dest))
+      return;
+
+    m_gpr.FlushRegs();
+    // The final size of this block isn't known yet, so make sure that a whole block fits.
+    MOV(64, R(RAX), ImmPtr(&m_cycles_left));
+    MOV(16, R(ECX), MatR(RAX));
+    CMP(16, R(ECX), Imm16(m_block_size[m_start_address] + MAX_BLOCK_SIZE));
+    FixupBranch notEnoughCycles = J_CC(CC_BE);
+
+    SUB(16, R(ECX), Imm16(m_block_size[m_start_address]));
+    MOV(16, MatR(RAX), R(ECX));
+    JMP(m_block_link_entry, Jump::Near);
+    SetJumpTarget(notEnoughCycles);
+    return;
+  }
+
   // Jump directly to the called block if it has already been compiled.
   if (!(dest >= m_start_address && dest <= m_compile_pc))
   {
@@ -133,7 +157,7 @@ void DSPEmitter::WriteBlockLink(u16 dest)
       JMP(m_block_links[dest], Jump::Near);
       SetJumpTarget(notEnoughCycles);
     }
-    else
+    else if (wait_for_dest)
     {
       // The destination has not been compiled yet.  Add it to the list
       // of blocks that this block is waiting on.
@@ -147,9 +171,10 @@ void DSPEmitter::r_jcc(const UDSPInstruction opc)
   const u16 dest = m_dsp_core.DSPState().ReadIMEM(m_compile_pc + 1);
   const DSPOPCTemplate* opcode = GetOpTemplate(opc);
 
-  // If the block is unconditional, attempt to link block
-  if (opcode->uncond_branch)
-    WriteBlockLink(dest);
+  // This only runs if the condition was met, so the destination is known and can be linked.
+  // Conditional branches don't wait for their destination to be compiled though: the block
+  // continues past them, so two blocks branching to each other would recompile each other forever.
+  WriteBlockLink(dest, opcode->uncond_branch);
   MOV(16, M_SDSP_pc(), Imm16(dest));
   WriteBranchExit();
 }
@@ -194,9 +219,8 @@ void DSPEmitter::r_call(const UDSPInstruction opc)
   const u16 dest = m_dsp_core.DSPState().ReadIMEM(m_compile_pc + 1);
   const DSPOPCTemplate* opcode = GetOpTemplate(opc);
 
-  // If the block is unconditional, attempt to link block
-  if (opcode->uncond_branch)
-    WriteBlockLink(dest);
+  // As with jumps, conditional calls only link to destinations which are already linkable.
+  WriteBlockLink(dest, opcode->uncond_branch);
   MOV(16, M_SDSP_pc(), Imm16(dest));
   WriteBranchExit();
 }
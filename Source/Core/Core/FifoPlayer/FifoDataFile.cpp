@@ -4,23 +4,31 @@
 #include "Core/FifoPlayer/FifoDataFile.h"
 
 #include <algorithm>
+#include <cstdio>
 #include <cstring>
+#include <limits>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
+#include <xxhash.h>
+#include <zstd.h>
+
+#include "Common/Assert.h"
 #include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/HW/Memmap.h"
 #include "Core/System.h"
 
 constexpr u32 FILE_ID = 0x0d01f1f0;
-constexpr u32 VERSION_NUMBER = 5;
-constexpr u32 MIN_LOADER_VERSION = 1;
-// This value is only used if the DFF file was created with overridden RAM sizes.
-// If the MIN_LOADER_VERSION ever exceeds this, it's alright to remove it.
-constexpr u32 MIN_LOADER_VERSION_FOR_RAM_OVERRIDE = 5;
+constexpr u32 VERSION_NUMBER = 6;
+// Version 6 switched to compressed frame blocks and deduplicated memory updates, which older
+// loaders can't read.
+constexpr u32 MIN_LOADER_VERSION = 6;
+constexpr u32 FIRST_COMPRESSED_VERSION = 6;
 
 #pragma pack(push, 1)
 
@@ -46,10 +54,14 @@ struct FileHeader
   // will crash and burn with mismatched settings.  See PR #8722.
   u32 mem1_size;
   u32 mem2_size;
-  u8 reserved[32];
+  // Added in version 6.
+  u64 memoryBlobListOffset;
+  u32 memoryBlobCount;
+  u8 reserved[20];
 };
 static_assert(sizeof(FileHeader) == 128, "FileHeader should be 128 bytes");
 
+// Version 5 and earlier: uncompressed FIFO data and memory updates, referenced by offset.
 struct FileFrameInfo
 {
   u64 fifoDataOffset;
@@ -73,6 +85,41 @@ struct FileMemoryUpdate
 };
 static_assert(sizeof(FileMemoryUpdate) == 24, "FileMemoryUpdate should be 24 bytes");
 
+// Version 6 and later: each frame is stored as one independently compressed block, made up of the
+// FIFO data followed by a list of FileBlockMemoryUpdate.
+struct FileCompressedFrameInfo
+{
+  u64 blockOffset;
+  u32 blockStoredSize;
+  u32 blockSize;
+  u32 fifoDataSize;
+  u32 fifoStart;
+  u32 fifoEnd;
+  u32 numMemoryUpdates;
+  u64 memoryUpdatesDataSize;
+  u8 reserved[24];
+};
+static_assert(sizeof(FileCompressedFrameInfo) == 64, "FileCompressedFrameInfo should be 64 bytes");
+
+struct FileBlockMemoryUpdate
+{
+  u32 fifoPosition;
+  u32 address;
+  u32 blobIndex;
+  u8 type;
+  u8 reserved[3];
+};
+static_assert(sizeof(FileBlockMemoryUpdate) == 16, "FileBlockMemoryUpdate should be 16 bytes");
+
+// A stored size equal to the real size means the data is stored uncompressed.
+struct FileMemoryBlob
+{
+  u64 dataOffset;
+  u32 storedSize;
+  u32 size;
+};
+static_assert(sizeof(FileMemoryBlob) == 16, "FileMemoryBlob should be 16 bytes");
+
 #pragma pack(pop)
 
 FifoDataFile::FifoDataFile() = default;
@@ -101,11 +148,101 @@ bool FifoDataFile::GetIsWii() const
 
 void FifoDataFile::AddFrame(const FifoFrameInfo& frameInfo)
 {
-  m_Frames.push_back(frameInfo);
+  DEBUG_ASSERT(!m_file);
+  std::lock_guard lk(m_mutex);
+
+  std::vector<u8> block;
+  block.reserve(frameInfo.fifoData.size() +
+                frameInfo.memoryUpdates.size() * sizeof(FileBlockMemoryUpdate));
+  block.insert(block.end(), frameInfo.fifoData.begin(), frameInfo.fifoData.end());
+
+  u64 memory_updates_data_size = 0;
+  for (const MemoryUpdate& srcUpdate : frameInfo.memoryUpdates)
+  {
+    memory_updates_data_size += srcUpdate.data.size();
+
+    FileBlockMemoryUpdate dstUpdate{};
+    dstUpdate.fifoPosition = srcUpdate.fifoPosition;
+    dstUpdate.address = srcUpdate.address;
+    dstUpdate.blobIndex = StoreMemoryBlob(srcUpdate.data);
+    dstUpdate.type = static_cast<u8>(srcUpdate.type);
+
+    const u8* const bytes = reinterpret_cast<const u8*>(&dstUpdate);
+    block.insert(block.end(), bytes, bytes + sizeof(dstUpdate));
+  }
+
+  FrameEntry entry;
+  entry.size = static_cast<u32>(block.size());
+  entry.offset = StoreData(block.data(), block.size(), &entry.stored_size);
+  entry.fifo_data_size = static_cast<u32>(frameInfo.fifoData.size());
+  entry.fifo_start = frameInfo.fifoStart;
+  entry.fifo_end = frameInfo.fifoEnd;
+  entry.num_memory_updates = static_cast<u32>(frameInfo.memoryUpdates.size());
+  entry.memory_updates_data_size = memory_updates_data_size;
+  m_frames.push_back(entry);
+
+  if (m_data.size() >= m_max_buffered_data_size)
+    FlushBufferedData();
+}
+
+std::shared_ptr<const FifoFrameInfo> FifoDataFile::GetFrame(u32 frame) const
+{
+  std::lock_guard lk(m_mutex);
+
+  const auto it = std::ranges::find(m_frame_cache, frame,
+                                    &decltype(m_frame_cache)::value_type::first);
+  if (it != m_frame_cache.end())
+  {
+    // Move to the front so that the least recently used frame is evicted first
+    std::rotate(m_frame_cache.begin(), it, it + 1);
+    return m_frame_cache.front().second;
+  }
+
+  const FrameEntry& entry = m_frames[frame];
+  auto decoded = std::make_shared<FifoFrameInfo>();
+  decoded->fifoStart = entry.fifo_start;
+  decoded->fifoEnd = entry.fifo_end;
+
+  const bool success = IsLegacyFormat() ? DecodeLegacyFrame(entry, decoded.get()) :
+                                          DecodeFrame(entry, decoded.get());
+  if (!success)
+  {
+    PanicAlertFmtT("Failed to read frame {0} of the DFF file.", frame);
+    decoded->fifoData.clear();
+    decoded->memoryUpdates.clear();
+  }
+
+  if (m_frame_cache.size() >= FRAME_CACHE_SIZE)
+    m_frame_cache.pop_back();
+  m_frame_cache.emplace(m_frame_cache.begin(), frame, decoded);
+
+  return decoded;
+}
+
+std::pair<u32, u64> FifoDataFile::GetFrameDataSizes(u32 frame) const
+{
+  if (IsLegacyFormat())
+  {
+    // The sizes of the memory updates are only stored next to their data
+    const auto decoded = GetFrame(frame);
+    u64 memory_updates_data_size = 0;
+    for (const MemoryUpdate& update : decoded->memoryUpdates)
+      memory_updates_data_size += update.data.size();
+    return {static_cast<u32>(decoded->fifoData.size()), memory_updates_data_size};
+  }
+
+  std::lock_guard lk(m_mutex);
+  const FrameEntry& entry = m_frames[frame];
+  return {entry.fifo_data_size, entry.memory_updates_data_size};
 }
 
 bool FifoDataFile::Save(const std::string& filename)
 {
+  if (IsLegacyFormat())
+    return SaveLegacyAsCompressed(filename);
+
+  std::lock_guard lk(m_mutex);
+
   File::IOFile file;
   if (!file.Open(filename, "wb"))
     return false;
@@ -113,9 +250,12 @@ bool FifoDataFile::Save(const std::string& filename)
   // Add space for header
   PadFile(sizeof(FileHeader), file);
 
-  // Add space for frame list
+  // Add space for frame list and memory blob list
   u64 frameListOffset = file.Tell();
-  PadFile(m_Frames.size() * sizeof(FileFrameInfo), file);
+  PadFile(m_frames.size() * sizeof(FileCompressedFrameInfo), file);
+
+  u64 memoryBlobListOffset = file.Tell();
+  PadFile(m_memory_blobs.size() * sizeof(FileMemoryBlob), file);
 
   u64 bpMemOffset = file.Tell();
   file.WriteArray(m_BPMem);
@@ -132,15 +272,49 @@ bool FifoDataFile::Save(const std::string& filename)
   u64 texMemOffset = file.Tell();
   file.WriteArray(m_TexMem);
 
+  // Copy the stored (compressed) data over as is
+  std::vector<u8> buffer;
+
+  std::vector<FileMemoryBlob> dstBlobs(m_memory_blobs.size());
+  for (size_t i = 0; i < m_memory_blobs.size(); ++i)
+  {
+    const MemoryBlob& srcBlob = m_memory_blobs[i];
+    buffer.resize(srcBlob.stored_size);
+    if (!ReadStoredBytes(srcBlob.offset, srcBlob.stored_size, buffer.data()))
+      return false;
+
+    dstBlobs[i].dataOffset = file.Tell();
+    dstBlobs[i].storedSize = srcBlob.stored_size;
+    dstBlobs[i].size = srcBlob.size;
+    file.WriteBytes(buffer.data(), buffer.size());
+  }
+
+  std::vector<FileCompressedFrameInfo> dstFrames(m_frames.size());
+  for (size_t i = 0; i < m_frames.size(); ++i)
+  {
+    const FrameEntry& srcFrame = m_frames[i];
+    buffer.resize(srcFrame.stored_size);
+    if (!ReadStoredBytes(srcFrame.offset, srcFrame.stored_size, buffer.data()))
+      return false;
+
+    FileCompressedFrameInfo& dstFrame = dstFrames[i];
+    dstFrame = {};
+    dstFrame.blockOffset = file.Tell();
+    dstFrame.blockStoredSize = srcFrame.stored_size;
+    dstFrame.blockSize = srcFrame.size;
+    dstFrame.fifoDataSize = srcFrame.fifo_data_size;
+    dstFrame.fifoStart = srcFrame.fifo_start;
+    dstFrame.fifoEnd = srcFrame.fifo_end;
+    dstFrame.numMemoryUpdates = srcFrame.num_memory_updates;
+    dstFrame.memoryUpdatesDataSize = srcFrame.memory_updates_data_size;
+    file.WriteBytes(buffer.data(), buffer.size());
+  }
+
   // Write header
-  FileHeader header;
+  FileHeader header{};
   header.fileId = FILE_ID;
   header.file_version = VERSION_NUMBER;
-  // Maintain backwards compatability so long as the RAM sizes aren't overridden.
-  if (Config::Get(Config::MAIN_RAM_OVERRIDE_ENABLE))
-    header.min_loader_version = MIN_LOADER_VERSION_FOR_RAM_OVERRIDE;
-  else
-    header.min_loader_version = MIN_LOADER_VERSION;
+  header.min_loader_version = MIN_LOADER_VERSION;
 
   header.bpMemOffset = bpMemOffset;
   header.bpMemSize = BP_MEM_SIZE;
@@ -158,7 +332,10 @@ bool FifoDataFile::Save(const std::string& filename)
   header.texMemSize = TEX_MEM_SIZE;
 
   header.frameListOffset = frameListOffset;
-  header.frameCount = (u32)m_Frames.size();
+  header.frameCount = static_cast<u32>(m_frames.size());
+
+  header.memoryBlobListOffset = memoryBlobListOffset;
+  header.memoryBlobCount = static_cast<u32>(m_memory_blobs.size());
 
   header.flags = m_Flags;
 
@@ -170,31 +347,11 @@ bool FifoDataFile::Save(const std::string& filename)
   file.Seek(0, File::SeekOrigin::Begin);
   file.WriteBytes(&header, sizeof(FileHeader));
 
-  // Write frames list
-  for (unsigned int i = 0; i < m_Frames.size(); ++i)
-  {
-    const FifoFrameInfo& srcFrame = m_Frames[i];
-
-    // Write FIFO data
-    file.Seek(0, File::SeekOrigin::End);
-    u64 dataOffset = file.Tell();
-    file.WriteBytes(srcFrame.fifoData.data(), srcFrame.fifoData.size());
-
-    u64 memoryUpdatesOffset = WriteMemoryUpdates(srcFrame.memoryUpdates, file);
-
-    FileFrameInfo dstFrame;
-    dstFrame.fifoDataSize = static_cast<u32>(srcFrame.fifoData.size());
-    dstFrame.fifoDataOffset = dataOffset;
-    dstFrame.fifoStart = srcFrame.fifoStart;
-    dstFrame.fifoEnd = srcFrame.fifoEnd;
-    dstFrame.memoryUpdatesOffset = memoryUpdatesOffset;
-    dstFrame.numMemoryUpdates = static_cast<u32>(srcFrame.memoryUpdates.size());
-
-    // Write frame info
-    u64 frameOffset = frameListOffset + (i * sizeof(FileFrameInfo));
-    file.Seek(frameOffset, File::SeekOrigin::Begin);
-    file.WriteBytes(&dstFrame, sizeof(FileFrameInfo));
-  }
+  file.Seek(frameListOffset, File::SeekOrigin::Begin);
+  file.WriteArray(dstFrames.data(), dstFrames.size());
+
+  file.Seek(memoryBlobListOffset, File::SeekOrigin::Begin);
+  file.WriteArray(dstBlobs.data(), dstBlobs.size());
 
   if (!file.Close())
     return false;
@@ -202,10 +359,27 @@ bool FifoDataFile::Save(const std::string& filename)
   return true;
 }
 
+bool FifoDataFile::SaveLegacyAsCompressed(const std::string& filename) const
+{
+  // Older files can't be copied block by block, so re-encode them one frame at a time
+  auto converted = std::make_unique<FifoDataFile>();
+  converted->m_BPMem = m_BPMem;
+  converted->m_CPMem = m_CPMem;
+  converted->m_XFMem = m_XFMem;
+  converted->m_XFRegs = m_XFRegs;
+  converted->m_TexMem = m_TexMem;
+  converted->m_Flags = m_Flags;
+
+  for (u32 i = 0; i < GetFrameCount(); ++i)
+    converted->AddFrame(*GetFrame(i));
+
+  return converted->Save(filename);
+}
+
 std::unique_ptr<FifoDataFile> FifoDataFile::Load(const std::string& filename, bool flagsOnly)
 {
-  File::IOFile file;
-  file.Open(filename, "rb");
+  auto file_ptr = std::make_unique<File::IOFile>(filename, "rb");
+  File::IOFile& file = *file_ptr;
   if (!file)
     return nullptr;
 
@@ -316,32 +490,66 @@ std::unique_ptr<FifoDataFile> FifoDataFile::Load(const std::string& filename, bo
   dataFile->m_ram_size_real = header.mem1_size;
   dataFile->m_exram_size_real = header.mem2_size;
 
-  // Read frames
-  for (u32 i = 0; i < header.frameCount; ++i)
+  // Read the frame index. The frames themselves are only read when they're needed.
+  dataFile->m_frames.resize(header.frameCount);
+  file.Seek(header.frameListOffset, File::SeekOrigin::Begin);
+  if (dataFile->m_Version >= FIRST_COMPRESSED_VERSION)
   {
-    u64 frameOffset = header.frameListOffset + (i * sizeof(FileFrameInfo));
-    file.Seek(frameOffset, File::SeekOrigin::Begin);
-    FileFrameInfo srcFrame;
-    if (!file.ReadBytes(&srcFrame, sizeof(FileFrameInfo)))
+    std::vector<FileCompressedFrameInfo> srcFrames(header.frameCount);
+    if (!file.ReadArray(srcFrames.data(), srcFrames.size()))
       return panic_failed_to_read();
 
-    FifoFrameInfo dstFrame;
-    dstFrame.fifoData.resize(srcFrame.fifoDataSize);
-    dstFrame.fifoStart = srcFrame.fifoStart;
-    dstFrame.fifoEnd = srcFrame.fifoEnd;
-
-    file.Seek(srcFrame.fifoDataOffset, File::SeekOrigin::Begin);
-    file.ReadBytes(dstFrame.fifoData.data(), srcFrame.fifoDataSize);
-
-    ReadMemoryUpdates(srcFrame.memoryUpdatesOffset, srcFrame.numMemoryUpdates,
-                      dstFrame.memoryUpdates, file);
+    for (u32 i = 0; i < header.frameCount; ++i)
+    {
+      const FileCompressedFrameInfo& srcFrame = srcFrames[i];
+      FrameEntry& dstFrame = dataFile->m_frames[i];
+      dstFrame.offset = srcFrame.blockOffset;
+      dstFrame.stored_size = srcFrame.blockStoredSize;
+      dstFrame.size = srcFrame.blockSize;
+      dstFrame.fifo_data_size = srcFrame.fifoDataSize;
+      dstFrame.fifo_start = srcFrame.fifoStart;
+      dstFrame.fifo_end = srcFrame.fifoEnd;
+      dstFrame.num_memory_updates = srcFrame.numMemoryUpdates;
+      dstFrame.memory_updates_data_size = srcFrame.memoryUpdatesDataSize;
+    }
+
+    std::vector<FileMemoryBlob> srcBlobs(header.memoryBlobCount);
+    file.Seek(header.memoryBlobListOffset, File::SeekOrigin::Begin);
+    if (!file.ReadArray(srcBlobs.data(), srcBlobs.size()))
+      return panic_failed_to_read();
 
-    if (!file.IsGood())
+    dataFile->m_memory_blobs.resize(header.memoryBlobCount);
+    for (u32 i = 0; i < header.memoryBlobCount; ++i)
+    {
+      MemoryBlob& dstBlob = dataFile->m_memory_blobs[i];
+      dstBlob.offset = srcBlobs[i].dataOffset;
+      dstBlob.stored_size = srcBlobs[i].storedSize;
+      dstBlob.size = srcBlobs[i].size;
+    }
+  }
+  else
+  {
+    std::vector<FileFrameInfo> srcFrames(header.frameCount);
+    if (!file.ReadArray(srcFrames.data(), srcFrames.size()))
       return panic_failed_to_read();
 
-    dataFile->AddFrame(dstFrame);
+    for (u32 i = 0; i < header.frameCount; ++i)
+    {
+      const FileFrameInfo& srcFrame = srcFrames[i];
+      FrameEntry& dstFrame = dataFile->m_frames[i];
+      dstFrame.offset = srcFrame.fifoDataOffset;
+      dstFrame.stored_size = srcFrame.fifoDataSize;
+      dstFrame.size = srcFrame.fifoDataSize;
+      dstFrame.fifo_data_size = srcFrame.fifoDataSize;
+      dstFrame.fifo_start = srcFrame.fifoStart;
+      dstFrame.fifo_end = srcFrame.fifoEnd;
+      dstFrame.memory_updates_offset = srcFrame.memoryUpdatesOffset;
+      dstFrame.num_memory_updates = srcFrame.numMemoryUpdates;
+    }
   }
 
+  dataFile->m_file = std::move(file_ptr);
+
   return dataFile;
 }
 
@@ -364,35 +572,159 @@ bool FifoDataFile::GetFlag(u32 flag) const
   return !!(m_Flags & flag);
 }
 
-u64 FifoDataFile::WriteMemoryUpdates(const std::vector<MemoryUpdate>& memUpdates,
-                                     File::IOFile& file)
+bool FifoDataFile::IsLegacyFormat() const
+{
+  return m_file && m_Version < FIRST_COMPRESSED_VERSION;
+}
+
+u64 FifoDataFile::StoreData(const u8* data, size_t size, u32* stored_size)
+{
+  const size_t buffer_offset = m_data.size();
+  const size_t bound = ZSTD_compressBound(size);
+  m_data.resize(buffer_offset + bound);
+
+  const size_t compressed_size =
+      ZSTD_compress(m_data.data() + buffer_offset, bound, data, size, ZSTD_CLEVEL_DEFAULT);
+  if (ZSTD_isError(compressed_size) || compressed_size >= size)
+  {
+    // Not worth compressing, store it as is
+    std::memcpy(m_data.data() + buffer_offset, data, size);
+    *stored_size = static_cast<u32>(size);
+  }
+  else
+  {
+    *stored_size = static_cast<u32>(compressed_size);
+  }
+
+  m_data.resize(buffer_offset + *stored_size);
+  return m_spilled_size + buffer_offset;
+}
+
+void FifoDataFile::FlushBufferedData()
 {
-  // Add space for memory update list
-  u64 updateListOffset = file.Tell();
-  PadFile(memUpdates.size() * sizeof(FileMemoryUpdate), file);
+  if (!m_spill_file)
+  {
+    // Deleted automatically once it's closed
+    m_spill_file = std::make_unique<File::IOFile>(std::tmpfile());
+    if (!m_spill_file->IsOpen())
+    {
+      WARN_LOG_FMT(VIDEO, "Failed to create a temporary file for the FIFO recording, keeping it "
+                          "in memory");
+      m_max_buffered_data_size = std::numeric_limits<size_t>::max();
+      return;
+    }
+  }
 
-  for (unsigned int i = 0; i < memUpdates.size(); ++i)
+  // Data is always moved as a whole, so stored blocks never straddle the file and the buffer
+  if (!m_spill_file->Seek(0, File::SeekOrigin::End) ||
+      !m_spill_file->WriteBytes(m_data.data(), m_data.size()))
   {
-    const MemoryUpdate& srcUpdate = memUpdates[i];
+    WARN_LOG_FMT(VIDEO, "Failed to write to the temporary file for the FIFO recording, keeping it "
+                        "in memory");
+    m_max_buffered_data_size = std::numeric_limits<size_t>::max();
+    return;
+  }
+
+  m_spilled_size += m_data.size();
+  m_data.clear();
+}
 
-    // Write memory
-    file.Seek(0, File::SeekOrigin::End);
-    u64 dataOffset = file.Tell();
-    file.WriteBytes(srcUpdate.data.data(), srcUpdate.data.size());
+u32 FifoDataFile::StoreMemoryBlob(const std::vector<u8>& data)
+{
+  // Games tend to upload the same textures and vertex data over and over, so only store it once
+  const XXH128_hash_t hash = XXH3_128bits(data.data(), data.size());
+  const std::pair<u64, u64> key{hash.low64, hash.high64};
+  const auto it = m_memory_blob_lookup.find(key);
+  if (it != m_memory_blob_lookup.end() && m_memory_blobs[it->second].size == data.size())
+    return it->second;
+
+  const u32 index = static_cast<u32>(m_memory_blobs.size());
+  MemoryBlob& blob = m_memory_blobs.emplace_back();
+  blob.size = static_cast<u32>(data.size());
+  blob.offset = StoreData(data.data(), data.size(), &blob.stored_size);
+  m_memory_blob_lookup.emplace(key, index);
+  return index;
+}
 
-    FileMemoryUpdate dstUpdate;
+bool FifoDataFile::ReadStoredBytes(u64 offset, u32 size, u8* dst) const
+{
+  if (m_file)
+    return m_file->Seek(offset, File::SeekOrigin::Begin) && m_file->ReadBytes(dst, size);
+
+  if (offset < m_spilled_size)
+  {
+    return size <= m_spilled_size - offset &&
+           m_spill_file->Seek(offset, File::SeekOrigin::Begin) && m_spill_file->ReadBytes(dst, size);
+  }
+
+  offset -= m_spilled_size;
+  if (offset > m_data.size() || size > m_data.size() - offset)
+    return false;
+
+  std::copy_n(m_data.data() + offset, size, dst);
+  return true;
+}
+
+bool FifoDataFile::ReadStoredData(u64 offset, u32 stored_size, u32 size,
+                                  std::vector<u8>* dst) const
+{
+  dst->resize(size);
+  if (stored_size == size)
+    return ReadStoredBytes(offset, size, dst->data());
+
+  std::vector<u8> compressed(stored_size);
+  if (!ReadStoredBytes(offset, stored_size, compressed.data()))
+    return false;
+
+  const size_t result = ZSTD_decompress(dst->data(), size, compressed.data(), stored_size);
+  return !ZSTD_isError(result) && result == size;
+}
+
+bool FifoDataFile::DecodeFrame(const FrameEntry& entry, FifoFrameInfo* frame) const
+{
+  const u64 expected_size = u64(entry.fifo_data_size) +
+                            u64(entry.num_memory_updates) * sizeof(FileBlockMemoryUpdate);
+  if (expected_size != entry.size)
+    return false;
+
+  std::vector<u8> block;
+  if (!ReadStoredData(entry.offset, entry.stored_size, entry.size, &block))
+    return false;
+
+  frame->fifoData.assign(block.begin(), block.begin() + entry.fifo_data_size);
+
+  frame->memoryUpdates.resize(entry.num_memory_updates);
+  for (u32 i = 0; i < entry.num_memory_updates; ++i)
+  {
+    FileBlockMemoryUpdate srcUpdate;
+    std::memcpy(&srcUpdate,
+                block.data() + entry.fifo_data_size + i * sizeof(FileBlockMemoryUpdate),
+                sizeof(FileBlockMemoryUpdate));
+    if (srcUpdate.blobIndex >= m_memory_blobs.size())
+      return false;
+
+    MemoryUpdate& dstUpdate = frame->memoryUpdates[i];
     dstUpdate.address = srcUpdate.address;
-    dstUpdate.dataOffset = dataOffset;
-    dstUpdate.dataSize = static_cast<u32>(srcUpdate.data.size());
     dstUpdate.fifoPosition = srcUpdate.fifoPosition;
-    dstUpdate.type = static_cast<u8>(srcUpdate.type);
+    dstUpdate.type = static_cast<MemoryUpdate::Type>(srcUpdate.type);
 
-    u64 updateOffset = updateListOffset + (i * sizeof(FileMemoryUpdate));
-    file.Seek(updateOffset, File::SeekOrigin::Begin);
-    file.WriteBytes(&dstUpdate, sizeof(FileMemoryUpdate));
+    const MemoryBlob& blob = m_memory_blobs[srcUpdate.blobIndex];
+    if (!ReadStoredData(blob.offset, blob.stored_size, blob.size, &dstUpdate.data))
+      return false;
   }
 
-  return updateListOffset;
+  return true;
+}
+
+bool FifoDataFile::DecodeLegacyFrame(const FrameEntry& entry, FifoFrameInfo* frame) const
+{
+  frame->fifoData.resize(entry.fifo_data_size);
+  if (!ReadStoredBytes(entry.offset, entry.fifo_data_size, frame->fifoData.data()))
+    return false;
+
+  ReadMemoryUpdates(entry.memory_updates_offset, entry.num_memory_updates, frame->memoryUpdates,
+                    *m_file);
+  return m_file->IsGood();
 }
 
 void FifoDataFile::ReadMemoryUpdates(u64 fileOffset, u32 numUpdates,
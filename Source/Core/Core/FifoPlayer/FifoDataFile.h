@@ -4,8 +4,11 @@
 #pragma once
 
 #include <array>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -43,6 +46,9 @@ struct FifoFrameInfo
   std::vector<MemoryUpdate> memoryUpdates;
 };
 
+// Frames are kept in compressed form, either in the file they were loaded from or, while
+// recording, in memory and then in a temporary file once too much has been recorded. They are only
+// decoded on demand. This keeps memory usage independent of the length of the recording.
 class FifoDataFile
 {
 public:
@@ -73,24 +79,69 @@ public:
   u32 GetExRamSizeReal() { return m_exram_size_real; }
 
   void AddFrame(const FifoFrameInfo& frameInfo);
-  const FifoFrameInfo& GetFrame(u32 frame) const { return m_Frames[frame]; }
-  u32 GetFrameCount() const { return static_cast<u32>(m_Frames.size()); }
+  // The last few decoded frames are cached, so looking up the same frame repeatedly is cheap.
+  std::shared_ptr<const FifoFrameInfo> GetFrame(u32 frame) const;
+  u32 GetFrameCount() const { return static_cast<u32>(m_frames.size()); }
+  // Returns the size of a frame's FIFO data and the total size of its memory updates, without
+  // decoding the frame (except for files older than version 6).
+  std::pair<u32, u64> GetFrameDataSizes(u32 frame) const;
   bool Save(const std::string& filename);
 
   static std::unique_ptr<FifoDataFile> Load(const std::string& filename, bool flagsOnly);
 
+  // Exposed for testing. Recorded data beyond this size is moved to a temporary file.
+  void SetMaxBufferedDataSize(size_t size) { m_max_buffered_data_size = size; }
+
 private:
   enum
   {
     FLAG_IS_WII = 1
   };
 
+  static constexpr size_t FRAME_CACHE_SIZE = 4;
+  static constexpr size_t DEFAULT_MAX_BUFFERED_DATA_SIZE = 64 * 1024 * 1024;
+
+  // Location of a frame in the backing storage. For files older than version 6, offset and
+  // stored_size describe the uncompressed FIFO data and memory_updates_offset points to the
+  // memory update list. Otherwise, they describe a compressed block containing both.
+  struct FrameEntry
+  {
+    u64 offset = 0;
+    u32 stored_size = 0;
+    u32 size = 0;
+    u32 fifo_data_size = 0;
+    u32 fifo_start = 0;
+    u32 fifo_end = 0;
+    u64 memory_updates_offset = 0;
+    u32 num_memory_updates = 0;
+    u64 memory_updates_data_size = 0;
+  };
+
+  // Memory update contents are deduplicated and compressed separately from the frames.
+  struct MemoryBlob
+  {
+    u64 offset = 0;
+    u32 stored_size = 0;
+    u32 size = 0;
+  };
+
   void PadFile(size_t numBytes, File::IOFile& file);
 
   void SetFlag(u32 flag, bool set);
   bool GetFlag(u32 flag) const;
 
-  u64 WriteMemoryUpdates(const std::vector<MemoryUpdate>& memUpdates, File::IOFile& file);
+  bool IsLegacyFormat() const;
+
+  u64 StoreData(const u8* data, size_t size, u32* stored_size);
+  void FlushBufferedData();
+  u32 StoreMemoryBlob(const std::vector<u8>& data);
+  bool ReadStoredBytes(u64 offset, u32 size, u8* dst) const;
+  bool ReadStoredData(u64 offset, u32 stored_size, u32 size, std::vector<u8>* dst) const;
+  bool DecodeFrame(const FrameEntry& entry, FifoFrameInfo* frame) const;
+  bool DecodeLegacyFrame(const FrameEntry& entry, FifoFrameInfo* frame) const;
+
+  bool SaveLegacyAsCompressed(const std::string& filename) const;
+
   static void ReadMemoryUpdates(u64 fileOffset, u32 numUpdates,
                                 std::vector<MemoryUpdate>& memUpdates, File::IOFile& file);
 
@@ -105,5 +156,20 @@ private:
   u32 m_Flags = 0;
   u32 m_Version = 0;
 
-  std::vector<FifoFrameInfo> m_Frames;
+  std::vector<FrameEntry> m_frames;
+  std::vector<MemoryBlob> m_memory_blobs;
+  // Maps the XXH3-128 hash of a memory update's contents to its blob. Only used while recording.
+  std::map<std::pair<u64, u64>, u32> m_memory_blob_lookup;
+
+  // Backing storage for recorded frames. Loaded files are read from m_file instead. Stored data
+  // starts in m_spill_file and continues in m_data, which is moved to the end of m_spill_file
+  // whenever it grows past m_max_buffered_data_size.
+  std::vector<u8> m_data;
+  std::unique_ptr<File::IOFile> m_spill_file;
+  u64 m_spilled_size = 0;
+  size_t m_max_buffered_data_size = DEFAULT_MAX_BUFFERED_DATA_SIZE;
+  std::unique_ptr<File::IOFile> m_file;
+
+  mutable std::mutex m_mutex;
+  mutable std::vector<std::pair<u32, std::shared_ptr<const FifoFrameInfo>>> m_frame_cache;
 };
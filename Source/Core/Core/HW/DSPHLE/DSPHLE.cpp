@@ -26,6 +26,9 @@ bool DSPHLE::Initialize(bool wii, bool dsp_thread)
   m_ucode = nullptr;
   m_last_ucode = nullptr;
 
+  m_event_type_finish_async_work =
+      m_system.GetCoreTiming().RegisterEvent("DSPHLEAsyncWork", FinishAsyncWorkCallback);
+
   SetUCode(UCODE_ROM);
 
   m_dsp_control.Hex = 0;
@@ -96,6 +99,21 @@ void DSPHLE::SwapUCode(u32 crc)
   }
 }
 
+void DSPHLE::ScheduleAsyncWorkCompletion(s64 cycles)
+{
+  // Work that was finished early (because of a new mail) may have left an event behind.
+  auto& core_timing = m_system.GetCoreTiming();
+  core_timing.RemoveEvent(m_event_type_finish_async_work);
+  core_timing.ScheduleEvent(cycles, m_event_type_finish_async_work);
+}
+
+void DSPHLE::FinishAsyncWorkCallback(Core::System& system, u64 userdata, s64 cycles_late)
+{
+  auto* dsphle = static_cast<DSPHLE*>(system.GetDSP().GetDSPEmulator());
+  if (dsphle->m_ucode != nullptr)
+    dsphle->m_ucode->FinishAsyncWork();
+}
+
 void DSPHLE::DoState(PointerWrap& p)
 {
   bool is_hle = true;
@@ -16,6 +16,11 @@ class System;
 }
 class PointerWrap;
 
+namespace CoreTiming
+{
+struct EventType;
+}
+
 namespace DSP::HLE
 {
 class UCodeInterface;
@@ -50,9 +55,15 @@ public:
   void SetUCode(u32 crc);
   void SwapUCode(u32 crc);
 
+  // Calls FinishAsyncWork on the current ucode <cycles> from now. Used by ucodes that process
+  // mail on another thread, so that the result is picked up at a deterministic emulated time.
+  void ScheduleAsyncWorkCompletion(s64 cycles);
+
   Core::System& GetSystem() const { return m_system; }
 
 private:
+  static void FinishAsyncWorkCallback(Core::System& system, u64 userdata, s64 cycles_late);
+
   void SendMailToDSP(u32 mail);
 
   // Fake mailbox utility
@@ -78,6 +89,8 @@ private:
   u64 m_control_reg_init_code_clear_time = 0;
   CMailHandler m_mail_handler;
 
+  CoreTiming::EventType* m_event_type_finish_async_work = nullptr;
+
   Core::System& m_system;
 };
 }  // namespace DSP::HLE
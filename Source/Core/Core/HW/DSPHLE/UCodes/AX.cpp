@@ -15,6 +15,7 @@
 #include "Common/IOFile.h"
 #include "Common/Logging/Log.h"
 #include "Common/Swap.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/DolphinAnalytics.h"
 #include "Core/HW/DSP.h"
@@ -29,6 +30,9 @@ namespace DSP::HLE
 {
 AXUCode::AXUCode(DSPHLE* dsphle, u32 crc, bool dummy) : UCodeInterface(dsphle, crc)
 {
+  m_async_mixing = Config::Get(Config::MAIN_DSP_HLE_ASYNC_MIXING);
+  if (m_async_mixing)
+    m_mix_thread.Reset("AX Mixing", [](std::function<void()> work) { work(); });
 }
 
 AXUCode::AXUCode(DSPHLE* dsphle, u32 crc) : AXUCode(dsphle, crc, false)
@@ -110,6 +114,36 @@ void AXUCode::SignalWorkEnd()
   m_mail_handler.PushMail(DSP_YIELD, true, AX_EMPTY_COMMAND_LIST_CYCLES);
 }
 
+void AXUCode::SuspendCommandList(u32 resume_idx, u32 pb_addr)
+{
+  // How long the command list stays suspended while its PB list is mixed on another thread.
+  // Together with the delay in SignalWorkEnd, this stays within the range of command list
+  // durations observed in DSP-LLE (see above).
+  constexpr int AX_ASYNC_MIXING_CYCLES = 100000;
+
+  m_cmdlist_suspended = true;
+  m_cmdlist_resume_idx = resume_idx;
+  m_cmdlist_resume_pb_addr = pb_addr;
+  m_dsphle->ScheduleAsyncWorkCompletion(AX_ASYNC_MIXING_CYCLES);
+}
+
+void AXUCode::FinishAsyncWork()
+{
+  if (!m_cmdlist_suspended)
+    return;
+
+  m_mix_thread.WaitForCompletion();
+  ApplyAsyncMixResults();
+
+  m_cmdlist_suspended = false;
+  HandleCommandList();
+  if (m_cmdlist_suspended)
+    return;
+
+  m_cmdlist_size = 0;
+  SignalWorkEnd();
+}
+
 void AXUCode::HandleCommandList()
 {
   // Temp variables for addresses computation
@@ -117,9 +151,11 @@ void AXUCode::HandleCommandList()
   u16 addr2_hi, addr2_lo;
   u16 size;
 
-  u32 pb_addr = 0;
+  u32 pb_addr = m_cmdlist_resume_pb_addr;
 
-  u32 curr_idx = 0;
+  u32 curr_idx = m_cmdlist_resume_idx;
+  m_cmdlist_resume_idx = 0;
+  m_cmdlist_resume_pb_addr = 0;
   bool end = false;
   while (!end)
   {
@@ -154,6 +190,12 @@ void AXUCode::HandleCommandList()
       break;
 
     case CMD_PROCESS:
+      if (m_async_mixing)
+      {
+        StartAsyncPBList(pb_addr);
+        SuspendCommandList(curr_idx, pb_addr);
+        return;
+      }
       ProcessPBList(pb_addr);
       break;
 
@@ -492,6 +534,72 @@ void AXUCode::ProcessPBList(u32 pb_addr)
   }
 }
 
+void AXUCode::StartAsyncPBList(u32 pb_addr)
+{
+  constexpr u32 spms = 32;
+  constexpr u32 buffer_size = 5 * spms;
+
+  auto voices = std::make_shared<std::vector<AsyncVoice>>();
+  const s16* coeffs = m_coeffs_checksum ? m_coeffs.data() : nullptr;
+
+  m_async_pb_addrs.clear();
+  auto& memory = m_dsphle->GetSystem().GetMemory();
+  while (pb_addr)
+  {
+    AsyncVoice& voice = voices->emplace_back();
+    voice.addr = pb_addr;
+    ReadPB(memory, pb_addr, voice.initial_pb);
+    voice.updates = LoadPBUpdates(memory, voice.initial_pb);
+    voice.apply_updates = true;
+    voice.num_subframes = 5;
+    voice.samples_per_subframe = spms;
+
+    DecodeAsyncVoice(static_cast<HLEAccelerator*>(m_accelerator.get()), voice, coeffs, false,
+                     [this](const AXPB& pb) { return ConvertMixerControl(pb.mixer_control); });
+
+    m_async_pb_addrs.push_back(pb_addr);
+    pb_addr = HILO_TO_32(voice.decoded_pb.next_pb);
+  }
+
+  m_mix_thread.Push([this, voices, coeffs] {
+    m_async_samples.assign(9 * buffer_size, 0);
+    AXBuffers buffers{};
+    for (size_t i = 0; i < std::size(buffers.ptrs); ++i)
+      buffers.ptrs[i] = &m_async_samples[i * buffer_size];
+
+    m_async_pbs.resize(voices->size() * sizeof(AXPB));
+    for (size_t i = 0; i < voices->size(); ++i)
+    {
+      AsyncVoice& voice = (*voices)[i];
+      MixAsyncVoice(voice, buffers, coeffs, false);
+      std::memcpy(&m_async_pbs[i * sizeof(AXPB)], &voice.decoded_pb, sizeof(AXPB));
+    }
+  });
+}
+
+void AXUCode::ApplyAsyncMixResults()
+{
+  constexpr u32 buffer_size = 5 * 32;
+  const std::array<int*, 9> buffers{
+      m_samples_main_left,  m_samples_main_right, m_samples_main_surround,
+      m_samples_auxA_left,  m_samples_auxA_right, m_samples_auxA_surround,
+      m_samples_auxB_left,  m_samples_auxB_right, m_samples_auxB_surround,
+  };
+  for (size_t i = 0; i < buffers.size(); ++i)
+  {
+    for (u32 j = 0; j < buffer_size; ++j)
+      buffers[i][j] += m_async_samples[i * buffer_size + j];
+  }
+
+  auto& memory = m_dsphle->GetSystem().GetMemory();
+  for (size_t i = 0; i < m_async_pb_addrs.size(); ++i)
+  {
+    AXPB pb;
+    std::memcpy(&pb, &m_async_pbs[i * sizeof(AXPB)], sizeof(AXPB));
+    WritePB(memory, m_async_pb_addrs[i], pb);
+  }
+}
+
 void AXUCode::MixAUXSamples(int aux_id, u32 write_addr, u32 read_addr)
 {
   int* buffers[3] = {nullptr};
@@ -718,6 +826,10 @@ void AXUCode::SendAUXAndMix(u32 auxa_lrs_up, u32 auxb_s_up, u32 main_l_dl, u32 m
 
 void AXUCode::HandleMail(u32 mail)
 {
+  // The CPU isn't supposed to send anything before the command list is done, but if it does,
+  // finish the command list first.
+  FinishAsyncWork();
+
   if (m_upload_setup_in_progress)
   {
     PrepareBootUCode(mail);
@@ -743,8 +855,11 @@ void AXUCode::HandleMail(u32 mail)
   case MailState::WaitingForCmdListAddress:
     CopyCmdList(mail, m_cmdlist_size);
     HandleCommandList();
-    m_cmdlist_size = 0;
-    SignalWorkEnd();
+    if (!m_cmdlist_suspended)
+    {
+      m_cmdlist_size = 0;
+      SignalWorkEnd();
+    }
     m_mail_state = MailState::WaitingForNextTask;
     break;
 
@@ -814,6 +929,10 @@ void AXUCode::Update()
 
 void AXUCode::DoAXState(PointerWrap& p)
 {
+  // The results of a command list that is still being mixed are saved, rather than the work
+  // itself, so the mixing thread has to be done with it first.
+  m_mix_thread.WaitForCompletion();
+
   p.Do(m_cmdlist);
   p.Do(m_cmdlist_size);
   p.Do(m_mail_state);
@@ -846,6 +965,13 @@ void AXUCode::DoAXState(PointerWrap& p)
   p.Do(m_compressor_pos);
 
   m_accelerator->DoState(p);
+
+  p.Do(m_cmdlist_suspended);
+  p.Do(m_cmdlist_resume_idx);
+  p.Do(m_cmdlist_resume_pb_addr);
+  p.Do(m_async_samples);
+  p.Do(m_async_pb_addrs);
+  p.Do(m_async_pbs);
 }
 
 void AXUCode::DoState(PointerWrap& p)
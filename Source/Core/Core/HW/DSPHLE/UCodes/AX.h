@@ -12,12 +12,15 @@
 #pragma once
 
 #include <array>
+#include <functional>
 #include <memory>
 #include <optional>
+#include <vector>
 
 #include "Common/BitUtils.h"
 #include "Common/CommonTypes.h"
 #include "Common/Swap.h"
+#include "Common/WorkQueueThread.h"
 #include "Core/HW/DSPHLE/DSPHLE.h"
 #include "Core/HW/DSPHLE/UCodes/UCodes.h"
 #include "Core/HW/Memmap.h"
@@ -80,6 +83,7 @@ public:
   void Initialize() override;
   void HandleMail(u32 mail) override;
   void Update() override;
+  void FinishAsyncWork() override;
   void DoState(PointerWrap& p) override;
 
 protected:
@@ -111,6 +115,17 @@ protected:
 
   std::unique_ptr<Accelerator> m_accelerator;
 
+  bool m_async_mixing = false;
+  bool m_cmdlist_suspended = false;
+  u32 m_cmdlist_resume_idx = 0;
+  u32 m_cmdlist_resume_pb_addr = 0;
+
+  // Written by the mixing thread: the mixed voices, to be added to the mixing buffers, and the
+  // PBs to write back to memory (raw AXPB/AXPBWii structs).
+  std::vector<int> m_async_samples;
+  std::vector<u32> m_async_pb_addrs;
+  std::vector<u8> m_async_pbs;
+
   // Constructs without any GC-specific state, so it can be used by the deriving AXWii.
   AXUCode(DSPHLE* dsphle, u32 crc, bool dummy);
 
@@ -129,6 +144,12 @@ protected:
   virtual void HandleCommandList();
   void SignalWorkEnd();
 
+  // Asynchronous mixing (see MAIN_DSP_HLE_ASYNC_MIXING). A PB list is decoded on the CPU thread
+  // and mixed on m_mix_thread, while the rest of the command list is suspended. FinishAsyncWork
+  // resumes it a fixed number of emulated cycles later, no matter how long the worker takes.
+  void SuspendCommandList(u32 resume_idx, u32 pb_addr);
+  virtual void ApplyAsyncMixResults();
+
   struct BufferDesc
   {
     int* ptr;
@@ -161,6 +182,7 @@ protected:
   void SetupProcessing(u32 init_addr);
   void DownloadAndMixWithVolume(u32 addr, u16 vol_main, u16 vol_auxa, u16 vol_auxb);
   void ProcessPBList(u32 pb_addr);
+  void StartAsyncPBList(u32 pb_addr);
   void MixAUXSamples(int aux_id, u32 write_addr, u32 read_addr);
   void UploadLRS(u32 dst_addr);
   void SetMainLR(u32 src_addr);
@@ -210,5 +232,9 @@ private:
   };
 
   MailState m_mail_state = MailState::WaitingForCmdListSize;
+
+protected:
+  // Declared last so that it is shut down before anything the mixing thread writes to.
+  Common::WorkQueueThread<std::function<void()>> m_mix_thread;
 };
 }  // namespace DSP::HLE
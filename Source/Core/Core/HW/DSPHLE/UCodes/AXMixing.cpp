@@ -0,0 +1,141 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/HW/DSPHLE/UCodes/AXMixing.h"
+
+#include <algorithm>
+
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+#include "Common/Intrinsics.h"
+
+namespace DSP::HLE::AXMixing
+{
+static s16 ClampS16(s64 sample)
+{
+  return std::clamp<s64>(sample, -0x8000, 0x7FFF);
+}
+
+void MixAddScalar(int* out, const s16* input, u32 count, u16& volume, u16 volume_delta,
+                  s16& dpop)
+{
+  for (u32 i = 0; i < count; ++i)
+  {
+    s64 sample = input[i];
+    sample *= volume;
+    sample >>= 15;
+    s16 sample16 = ClampS16((s32)sample);
+
+    out[i] += sample16;
+    volume += volume_delta;
+
+    dpop = sample16;
+  }
+}
+
+void ApplyVolumeEnvelopeScalar(s16* samples, u32 count, u16& volume, u16 volume_delta,
+                               bool signed_volume)
+{
+  for (u32 i = 0; i < count; ++i)
+  {
+    const s32 v = signed_volume ? s32(s16(volume)) : s32(volume);
+    const s32 sample = ((s32)samples[i] * v) >> 15;
+    samples[i] = ClampS16(sample);
+    volume += volume_delta;
+  }
+}
+
+#ifdef _M_X86_64
+// Returns the volumes of the next four samples, one per 32-bit lane, zero extended.
+FUNCTION_TARGET_SSR41
+static __m128i InitialVolumes(u16 volume, u16 volume_delta)
+{
+  return _mm_and_si128(_mm_setr_epi32(volume, volume + volume_delta, volume + 2 * volume_delta,
+                                      volume + 3 * volume_delta),
+                       _mm_set1_epi32(0xFFFF));
+}
+
+// A 16-bit sample times a 16-bit volume always fits in 32 bits, signed or not, so every product
+// below can be computed with _mm_mullo_epi32 without changing the result of the scalar code.
+FUNCTION_TARGET_SSR41
+void MixAddSSE41(int* out, const s16* input, u32 count, u16& volume, u16 volume_delta,
+                 s16& dpop)
+{
+  u32 i = 0;
+  if (count >= 4)
+  {
+    const __m128i mask = _mm_set1_epi32(0xFFFF);
+    const __m128i step = _mm_set1_epi32(4 * volume_delta);
+    const __m128i min = _mm_set1_epi32(-0x8000);
+    const __m128i max = _mm_set1_epi32(0x7FFF);
+    __m128i volumes = InitialVolumes(volume, volume_delta);
+    __m128i mixed = _mm_setzero_si128();
+
+    for (; i + 4 <= count; i += 4)
+    {
+      const __m128i samples =
+          _mm_cvtepi16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(input + i)));
+      mixed = _mm_srai_epi32(_mm_mullo_epi32(samples, volumes), 15);
+      mixed = _mm_min_epi32(_mm_max_epi32(mixed, min), max);
+
+      __m128i* dst = reinterpret_cast<__m128i*>(out + i);
+      _mm_storeu_si128(dst, _mm_add_epi32(_mm_loadu_si128(dst), mixed));
+      volumes = _mm_and_si128(_mm_add_epi32(volumes, step), mask);
+    }
+
+    volume += static_cast<u16>(i * volume_delta);
+    dpop = static_cast<s16>(_mm_extract_epi32(mixed, 3));
+  }
+
+  MixAddScalar(out + i, input + i, count - i, volume, volume_delta, dpop);
+}
+
+FUNCTION_TARGET_SSR41
+void ApplyVolumeEnvelopeSSE41(s16* samples, u32 count, u16& volume, u16 volume_delta,
+                              bool signed_volume)
+{
+  u32 i = 0;
+  if (count >= 4)
+  {
+    const __m128i mask = _mm_set1_epi32(0xFFFF);
+    const __m128i step = _mm_set1_epi32(4 * volume_delta);
+    __m128i volumes = InitialVolumes(volume, volume_delta);
+
+    for (; i + 4 <= count; i += 4)
+    {
+      __m128i* ptr = reinterpret_cast<__m128i*>(samples + i);
+      const __m128i input = _mm_cvtepi16_epi32(_mm_loadl_epi64(ptr));
+      const __m128i v =
+          signed_volume ? _mm_srai_epi32(_mm_slli_epi32(volumes, 16), 16) : volumes;
+      const __m128i scaled = _mm_srai_epi32(_mm_mullo_epi32(input, v), 15);
+      // _mm_packs_epi32 saturates, which is the same as clamping to 16 bits.
+      _mm_storel_epi64(ptr, _mm_packs_epi32(scaled, scaled));
+      volumes = _mm_and_si128(_mm_add_epi32(volumes, step), mask);
+    }
+
+    volume += static_cast<u16>(i * volume_delta);
+  }
+
+  ApplyVolumeEnvelopeScalar(samples + i, count - i, volume, volume_delta, signed_volume);
+}
+#endif
+
+void MixAdd(int* out, const s16* input, u32 count, u16& volume, u16 volume_delta, s16& dpop)
+{
+#ifdef _M_X86_64
+  if (cpu_info.bSSE4_1)
+    return MixAddSSE41(out, input, count, volume, volume_delta, dpop);
+#endif
+  MixAddScalar(out, input, count, volume, volume_delta, dpop);
+}
+
+void ApplyVolumeEnvelope(s16* samples, u32 count, u16& volume, u16 volume_delta,
+                         bool signed_volume)
+{
+#ifdef _M_X86_64
+  if (cpu_info.bSSE4_1)
+    return ApplyVolumeEnvelopeSSE41(samples, count, volume, volume_delta, signed_volume);
+#endif
+  ApplyVolumeEnvelopeScalar(samples, count, volume, volume_delta, signed_volume);
+}
+}  // namespace DSP::HLE::AXMixing
@@ -0,0 +1,34 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Sample-level kernels shared by AX GC and AX Wii voice processing. Unlike AXVoice.h, nothing in
+// here depends on the PB layout, so it is compiled once and can be tested on its own.
+
+#pragma once
+
+#include "Common/CommonTypes.h"
+
+namespace DSP::HLE::AXMixing
+{
+// Multiplies each sample by a 1.15 volume, clamps the result to 16 bits and adds it to <out>.
+// The volume is advanced by <volume_delta> (modulo 2^16) after every sample, and the final value
+// is written back. <dpop> receives the last mixed sample. Nothing is written if count is 0.
+void MixAdd(int* out, const s16* input, u32 count, u16& volume, u16 volume_delta, s16& dpop);
+
+// Scales the samples in place by a per-sample 1.15 volume envelope. The GameCube ucode treats
+// the envelope volume as signed and the Wii ucode treats it as unsigned.
+void ApplyVolumeEnvelope(s16* samples, u32 count, u16& volume, u16 volume_delta,
+                         bool signed_volume);
+
+// Reference and SIMD implementations, exposed for testing. Use the dispatching functions above.
+void MixAddScalar(int* out, const s16* input, u32 count, u16& volume, u16 volume_delta,
+                  s16& dpop);
+void ApplyVolumeEnvelopeScalar(s16* samples, u32 count, u16& volume, u16 volume_delta,
+                               bool signed_volume);
+#ifdef _M_X86_64
+void MixAddSSE41(int* out, const s16* input, u32 count, u16& volume, u16 volume_delta,
+                 s16& dpop);
+void ApplyVolumeEnvelopeSSE41(s16* samples, u32 count, u16& volume, u16 volume_delta,
+                              bool signed_volume);
+#endif
+}  // namespace DSP::HLE::AXMixing
@@ -12,8 +12,8 @@
 #endif
 
 #include <algorithm>
+#include <array>
 #include <bit>
-#include <functional>
 #include <memory>
 
 #include "Common/CommonTypes.h"
@@ -21,6 +21,7 @@
 #include "Core/DolphinAnalytics.h"
 #include "Core/HW/DSP.h"
 #include "Core/HW/DSPHLE/UCodes/AX.h"
+#include "Core/HW/DSPHLE/UCodes/AXMixing.h"
 #include "Core/HW/DSPHLE/UCodes/AXStructs.h"
 #include "Core/HW/Memmap.h"
 #include "Core/System.h"
@@ -212,7 +213,8 @@ u16 AcceleratorGetSample(HLEAccelerator* accelerator)
 // We start getting samples not from sample 0, but 0.<curr_pos_frac>. This
 // avoids discontinuities in the audio stream, especially with very low ratios
 // which interpolate a lot of values between two "real" samples.
-u32 ResampleAudio(std::function<s16(u32)> input_callback, s16* output, u32 count, s16* last_samples,
+template <typename InputCallback>
+u32 ResampleAudio(InputCallback input_callback, s16* output, u32 count, s16* last_samples,
                   u32 curr_pos, u32 ratio, int srctype, const s16* coeffs)
 {
   int read_samples_count = 0;
@@ -324,6 +326,10 @@ u32 ResampleAudio(std::function<s16(u32)> input_callback, s16* output, u32 count
   return curr_pos;
 }
 
+// Number of input samples that can be decoded in one batch before resampling. This is enough
+// for any ratio up to 8, which covers every sample rate games use in practice.
+constexpr u32 MAX_BATCHED_INPUT_SAMPLES = MAX_SAMPLES_PER_FRAME * 8;
+
 // Read <count> input samples from ARAM, decoding and converting rate
 // if required.
 void GetInputSamples(HLEAccelerator* accelerator, PB_TYPE& pb, s16* samples, u16 count,
@@ -333,9 +339,30 @@ void GetInputSamples(HLEAccelerator* accelerator, PB_TYPE& pb, s16* samples, u16
 
   if (coeffs)
     coeffs += pb.coef_select * 0x200;
-  u32 curr_pos = ResampleAudio([accelerator](u32) { return AcceleratorGetSample(accelerator); },
-                               samples, count, pb.src.last_samples, pb.src.cur_addr_frac,
-                               HILO_TO_32(pb.src.ratio), pb.src_type, coeffs);
+
+  // ResampleAudio consumes one input sample each time the position crosses an integer, so the
+  // number of samples it will read is known in advance. Decoding them all at once gives the same
+  // accelerator state as reading them one by one during resampling.
+  const u32 ratio = HILO_TO_32(pb.src.ratio);
+  u64 input_count = count;
+  if (pb.src_type == SRCTYPE_LINEAR || pb.src_type == SRCTYPE_POLYPHASE)
+    input_count = (pb.src.cur_addr_frac + u64(count) * ratio) >> 16;
+
+  u32 curr_pos;
+  if (input_count <= MAX_BATCHED_INPUT_SAMPLES)
+  {
+    s16 input[MAX_BATCHED_INPUT_SAMPLES];
+    accelerator->ReadSamples(pb.adpcm.coefs, input, static_cast<u32>(input_count));
+    curr_pos = ResampleAudio([&input](u32 i) { return input[i]; }, samples, count,
+                             pb.src.last_samples, pb.src.cur_addr_frac, ratio, pb.src_type,
+                             coeffs);
+  }
+  else
+  {
+    curr_pos = ResampleAudio([accelerator](u32) { return AcceleratorGetSample(accelerator); },
+                             samples, count, pb.src.last_samples, pb.src.cur_addr_frac, ratio,
+                             pb.src_type, coeffs);
+  }
   pb.src.cur_addr_frac = (curr_pos & 0xFFFF);
 
   // Update current position, YN1, YN2 and pred scale in the PB.
@@ -354,27 +381,10 @@ s16 ClampS16(s64 sample)
 // Add samples to an output buffer, with optional volume ramping.
 void MixAdd(int* out, const s16* input, u32 count, VolumeData* vd, s16* dpop, bool ramp)
 {
-  u16& volume = vd->volume;
-  u16 volume_delta = vd->volume_delta;
-
-  // If volume ramping is disabled, set volume_delta to 0. That way, the
+  // If volume ramping is disabled, use a volume_delta of 0. That way, the
   // mixing loop can avoid testing if volume ramping is enabled at each step,
   // and just add volume_delta.
-  if (!ramp)
-    volume_delta = 0;
-
-  for (u32 i = 0; i < count; ++i)
-  {
-    s64 sample = input[i];
-    sample *= volume;
-    sample >>= 15;
-    s16 sample16 = ClampS16((s32)sample);
-
-    out[i] += sample16;
-    volume += volume_delta;
-
-    *dpop = sample16;
-  }
+  AXMixing::MixAdd(out, input, count, vd->volume, ramp ? vd->volume_delta : 0, *dpop);
 }
 
 // Execute a low pass filter on the samples using one history value.
@@ -413,33 +423,57 @@ static void BiquadFilter(s16* samples, u32 count, PBBiquadFilter& f)
 }
 #endif
 
-// Process 1ms of audio (for AX GC) or 3ms of audio (for AX Wii) from a PB and
-// mix it to the output buffers.
-void ProcessVoice(HLEAccelerator* accelerator, PB_TYPE& pb, const AXBuffers& buffers, u16 count,
-                  AXMixControl mctrl, const s16* coeffs, bool new_filter)
+// First half of ProcessVoice: reads the input samples of a running voice, performing sample
+// rate conversion if needed. Returns false if the voice is not running.
+//
+// Only the accelerator and resampler state of the PB (audio_addr, adpcm, src, running...) is
+// touched here, and MixVoice never touches it, which allows the two halves to run on different
+// copies of a PB. See MergeMixedVoice.
+bool DecodeVoice(HLEAccelerator* accelerator, PB_TYPE& pb, s16* samples, u16 count,
+                 const s16* coeffs, bool new_filter)
 {
   // If the voice is not running, nothing to do.
   if (pb.running != 1)
-    return;
+    return false;
 
-  // Read input samples, performing sample rate conversion if needed.
-  s16 samples[MAX_SAMPLES_PER_FRAME];
   GetInputSamples(accelerator, pb, samples, count, coeffs);
 
-  // Apply a global volume ramp using the volume envelope parameters.
-  for (u32 i = 0; i < count; ++i)
+  // Optionally, phase shift left or right channel to simulate 3D sound.
+  if (pb.initial_time_delay.on)
   {
+    // TODO
+    DolphinAnalytics::Instance().ReportGameQuirk(GameQuirk::USES_AX_INITIAL_TIME_DELAY);
+  }
+
+#ifdef AX_WII
+  if (pb.remote && new_filter && pb.remote_iir.on != 0)
+  {
+    DolphinAnalytics::Instance().ReportGameQuirk(pb.remote_iir.on == 2 ?
+                                                     GameQuirk::USES_AX_WIIMOTE_BIQUAD :
+                                                     GameQuirk::USES_AX_WIIMOTE_LOWPASS);
+  }
+#endif
+
+  return true;
+}
+
+// Second half of ProcessVoice: applies the volume envelope and filters to the samples read by
+// DecodeVoice and mixes them to the output buffers.
+void MixVoice(PB_TYPE& pb, s16* samples, const AXBuffers& buffers, u16 count, AXMixControl mctrl,
+              const s16* coeffs, bool new_filter)
+{
+  // Apply a global volume ramp using the volume envelope parameters.
+  u16 env_volume = static_cast<u16>(pb.vol_env.cur_volume);
 #ifdef AX_GC
-    // signed on GameCube
-    const s32 volume = (s16)pb.vol_env.cur_volume;
+  // signed on GameCube
+  constexpr bool signed_env_volume = true;
 #else
-    // unsigned on Wii
-    const s32 volume = (u16)pb.vol_env.cur_volume;
+  // unsigned on Wii
+  constexpr bool signed_env_volume = false;
 #endif
-    const s32 sample = ((s32)samples[i] * volume) >> 15;
-    samples[i] = ClampS16(sample);
-    pb.vol_env.cur_volume += pb.vol_env.cur_volume_delta;
-  }
+  AXMixing::ApplyVolumeEnvelope(samples, count, env_volume,
+                                static_cast<u16>(pb.vol_env.cur_volume_delta), signed_env_volume);
+  pb.vol_env.cur_volume = static_cast<s16>(env_volume);
 
   // Optionally, execute a low-pass and/or biquad filter.
   if (pb.lpf.on != 0)
@@ -529,13 +563,6 @@ void ProcessVoice(HLEAccelerator* accelerator, PB_TYPE& pb, const AXBuffers& buf
 #undef MIX_ON
 #undef RAMP_ON
 
-  // Optionally, phase shift left or right channel to simulate 3D sound.
-  if (pb.initial_time_delay.on)
-  {
-    // TODO
-    DolphinAnalytics::Instance().ReportGameQuirk(GameQuirk::USES_AX_INITIAL_TIME_DELAY);
-  }
-
 #ifdef AX_WII
   // Wiimote mixing.
   if (pb.remote)
@@ -544,15 +571,9 @@ void ProcessVoice(HLEAccelerator* accelerator, PB_TYPE& pb, const AXBuffers& buf
     {
       // Only one filter at most for Wiimotes.
       if (pb.remote_iir.on == 2)
-      {
-        DolphinAnalytics::Instance().ReportGameQuirk(GameQuirk::USES_AX_WIIMOTE_BIQUAD);
         BiquadFilter(samples, count, pb.remote_iir.biquad);
-      }
       else
-      {
-        DolphinAnalytics::Instance().ReportGameQuirk(GameQuirk::USES_AX_WIIMOTE_LOWPASS);
         LowPassFilter(samples, count, pb.remote_iir.lpf);
-      }
     }
 
     // Old AXWii versions process ms per ms.
@@ -602,6 +623,103 @@ void ProcessVoice(HLEAccelerator* accelerator, PB_TYPE& pb, const AXBuffers& buf
 #endif
 }
 
+// Process 1ms of audio (for AX GC) or 3ms of audio (for AX Wii) from a PB and
+// mix it to the output buffers.
+void ProcessVoice(HLEAccelerator* accelerator, PB_TYPE& pb, const AXBuffers& buffers, u16 count,
+                  AXMixControl mctrl, const s16* coeffs, bool new_filter)
+{
+  s16 samples[MAX_SAMPLES_PER_FRAME];
+  if (DecodeVoice(accelerator, pb, samples, count, coeffs, new_filter))
+    MixVoice(pb, samples, buffers, count, mctrl, coeffs, new_filter);
+}
+
+// Copies the state owned by MixVoice from <mixed> to <pb>, which has been run through DecodeVoice.
+// Both copies must have started from the same PB and received the same updates.
+void MergeMixedVoice(PB_TYPE& pb, const PB_TYPE& mixed)
+{
+  pb.mixer = mixed.mixer;
+  pb.dpop = mixed.dpop;
+  pb.vol_env = mixed.vol_env;
+  pb.lpf = mixed.lpf;
+#ifdef AX_WII
+  pb.biquad = mixed.biquad;
+  pb.remote_mixer = mixed.remote_mixer;
+  pb.remote_dpop = mixed.remote_dpop;
+  pb.remote_src = mixed.remote_src;
+  pb.remote_iir = mixed.remote_iir;
+#endif
+}
+
+// Voice state captured on the CPU thread for asynchronous mixing. The worker mixes <samples> with
+// its own copy of <initial_pb>, so it never needs to access emulated memory.
+struct AsyncVoice
+{
+#ifdef AX_GC
+  static constexpr u32 MAX_SUBFRAMES = 5;
+#else
+  static constexpr u32 MAX_SUBFRAMES = 3;
+#endif
+
+  u32 addr;
+  PB_TYPE initial_pb;
+  PB_TYPE decoded_pb;
+  PBUpdateData updates;
+  bool apply_updates;
+  u32 num_subframes;
+  u16 samples_per_subframe;
+  std::array<AXMixControl, MAX_SUBFRAMES> mctrl;
+  std::array<bool, MAX_SUBFRAMES> decoded;
+  std::array<s16, 32 * MAX_SUBFRAMES> samples;
+};
+
+// CPU thread side of asynchronous mixing: runs DecodeVoice for every subframe of a voice. Before
+// calling this, addr, initial_pb, updates and the subframe layout must be filled in.
+template <typename ConvertMixerControlFn>
+void DecodeAsyncVoice(HLEAccelerator* accelerator, AsyncVoice& voice, const s16* coeffs,
+                      bool new_filter, ConvertMixerControlFn convert_mixer_control)
+{
+  PB_TYPE pb = voice.initial_pb;
+  const u16 count = voice.samples_per_subframe;
+  for (u32 i = 0; i < voice.num_subframes; ++i)
+  {
+    if (voice.apply_updates)
+      ApplyUpdatesForMs(i, pb, pb.updates.num_updates, voice.updates);
+
+    voice.mctrl[i] = convert_mixer_control(pb);
+    voice.decoded[i] = DecodeVoice(accelerator, pb, &voice.samples[i * count], count, coeffs,
+                                   new_filter);
+  }
+  voice.decoded_pb = pb;
+}
+
+// Worker side of asynchronous mixing: mixes a voice captured by DecodeAsyncVoice to <buffers>,
+// then merges the result into decoded_pb, which becomes the PB to write back.
+void MixAsyncVoice(AsyncVoice& voice, AXBuffers buffers, const s16* coeffs, bool new_filter)
+{
+  PB_TYPE pb = voice.initial_pb;
+  const u16 count = voice.samples_per_subframe;
+  for (u32 i = 0; i < voice.num_subframes; ++i)
+  {
+    if (voice.apply_updates)
+      ApplyUpdatesForMs(i, pb, pb.updates.num_updates, voice.updates);
+
+    if (voice.decoded[i])
+      MixVoice(pb, &voice.samples[i * count], buffers, count, voice.mctrl[i], coeffs, new_filter);
+
+    // Forward the buffers
+#ifdef AX_GC
+    for (auto& ptr : buffers.ptrs)
+      ptr += count;
+#else
+    for (auto& ptr : buffers.regular_ptrs)
+      ptr += count;
+    for (auto& ptr : buffers.wiimote_ptrs)
+      ptr += 6;
+#endif
+  }
+  MergeMixedVoice(voice.decoded_pb, pb);
+}
+
 }  // namespace
 }  // inline namespace AXGC/AXWii
 }  // namespace DSP::HLE
@@ -7,6 +7,10 @@
 
 #include <algorithm>
 #include <array>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <vector>
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
@@ -46,9 +50,11 @@ void AXWiiUCode::HandleCommandList()
   u16 addr2_hi, addr2_lo;
   u16 volume;
 
-  u32 pb_addr = 0;
+  u32 pb_addr = m_cmdlist_resume_pb_addr;
 
-  u32 curr_idx = 0;
+  u32 curr_idx = m_cmdlist_resume_idx;
+  m_cmdlist_resume_idx = 0;
+  m_cmdlist_resume_pb_addr = 0;
   bool end = false;
   while (!end)
   {
@@ -87,6 +93,12 @@ void AXWiiUCode::HandleCommandList()
         break;
 
       case CMD_PROCESS_OLD:
+        if (m_async_mixing)
+        {
+          StartAsyncPBList(pb_addr);
+          SuspendCommandList(curr_idx, pb_addr);
+          return;
+        }
         ProcessPBList(pb_addr);
         break;
 
@@ -184,6 +196,12 @@ void AXWiiUCode::HandleCommandList()
       case CMD_PROCESS:
         addr_hi = m_cmdlist[curr_idx++];
         addr_lo = m_cmdlist[curr_idx++];
+        if (m_async_mixing)
+        {
+          StartAsyncPBList(HILO_TO_32(addr));
+          SuspendCommandList(curr_idx, pb_addr);
+          return;
+        }
         ProcessPBList(HILO_TO_32(addr));
         break;
 
@@ -482,6 +500,106 @@ void AXWiiUCode::ProcessPBList(u32 pb_addr)
   }
 }
 
+// Sizes of the regular and Wii Remote mixing buffers, and their layout in m_async_samples.
+static constexpr u32 REGULAR_BUFFER_SIZE = 3 * 32;
+static constexpr u32 WIIMOTE_BUFFER_SIZE = 3 * 6;
+static constexpr u32 NUM_REGULAR_BUFFERS = 12;
+static constexpr u32 NUM_WIIMOTE_BUFFERS = 8;
+static constexpr u32 WIIMOTE_BUFFERS_OFFSET = NUM_REGULAR_BUFFERS * REGULAR_BUFFER_SIZE;
+
+void AXWiiUCode::StartAsyncPBList(u32 pb_addr)
+{
+  constexpr u32 spms = 32;
+
+  auto voices = std::make_shared<std::vector<AsyncVoice>>();
+  const s16* coeffs = m_coeffs_checksum ? m_coeffs.data() : nullptr;
+  const bool new_filter = m_new_filter;
+
+  m_async_pb_addrs.clear();
+  auto& memory = m_dsphle->GetSystem().GetMemory();
+  while (pb_addr)
+  {
+    AsyncVoice& voice = voices->emplace_back();
+    voice.addr = pb_addr;
+    ReadPB(memory, pb_addr, voice.initial_pb);
+
+    const AXPBWii& pb = voice.initial_pb;
+    if (m_old_axwii &&
+        (pb.updates.num_updates[0] | pb.updates.num_updates[1] | pb.updates.num_updates[2]))
+    {
+      voice.updates = LoadPBUpdates(memory, pb);
+      voice.apply_updates = true;
+      voice.num_subframes = 3;
+      voice.samples_per_subframe = spms;
+    }
+    else
+    {
+      voice.apply_updates = false;
+      voice.num_subframes = 1;
+      voice.samples_per_subframe = 96;
+    }
+
+    DecodeAsyncVoice(static_cast<HLEAccelerator*>(m_accelerator.get()), voice, coeffs, new_filter,
+                     [this](const AXPBWii& voice_pb) {
+                       return ConvertMixerControl(HILO_TO_32(voice_pb.mixer_control));
+                     });
+
+    m_async_pb_addrs.push_back(pb_addr);
+    pb_addr = HILO_TO_32(voice.decoded_pb.next_pb);
+  }
+
+  m_mix_thread.Push([this, voices, coeffs, new_filter] {
+    m_async_samples.assign(WIIMOTE_BUFFERS_OFFSET + NUM_WIIMOTE_BUFFERS * WIIMOTE_BUFFER_SIZE, 0);
+    AXBuffers buffers{};
+    for (u32 i = 0; i < NUM_REGULAR_BUFFERS; ++i)
+      buffers.regular_ptrs[i] = &m_async_samples[i * REGULAR_BUFFER_SIZE];
+    for (u32 i = 0; i < NUM_WIIMOTE_BUFFERS; ++i)
+      buffers.wiimote_ptrs[i] = &m_async_samples[WIIMOTE_BUFFERS_OFFSET + i * WIIMOTE_BUFFER_SIZE];
+
+    m_async_pbs.resize(voices->size() * sizeof(AXPBWii));
+    for (size_t i = 0; i < voices->size(); ++i)
+    {
+      AsyncVoice& voice = (*voices)[i];
+      MixAsyncVoice(voice, buffers, coeffs, new_filter);
+      std::memcpy(&m_async_pbs[i * sizeof(AXPBWii)], &voice.decoded_pb, sizeof(AXPBWii));
+    }
+  });
+}
+
+void AXWiiUCode::ApplyAsyncMixResults()
+{
+  const std::array<int*, NUM_REGULAR_BUFFERS> regular_buffers{
+      m_samples_main_left,  m_samples_main_right, m_samples_main_surround,
+      m_samples_auxA_left,  m_samples_auxA_right, m_samples_auxA_surround,
+      m_samples_auxB_left,  m_samples_auxB_right, m_samples_auxB_surround,
+      m_samples_auxC_left,  m_samples_auxC_right, m_samples_auxC_surround,
+  };
+  const std::array<int*, NUM_WIIMOTE_BUFFERS> wiimote_buffers{
+      m_samples_wm0, m_samples_aux0, m_samples_wm1, m_samples_aux1,
+      m_samples_wm2, m_samples_aux2, m_samples_wm3, m_samples_aux3,
+  };
+
+  for (u32 i = 0; i < NUM_REGULAR_BUFFERS; ++i)
+  {
+    for (u32 j = 0; j < REGULAR_BUFFER_SIZE; ++j)
+      regular_buffers[i][j] += m_async_samples[i * REGULAR_BUFFER_SIZE + j];
+  }
+  for (u32 i = 0; i < NUM_WIIMOTE_BUFFERS; ++i)
+  {
+    const int* mixed = &m_async_samples[WIIMOTE_BUFFERS_OFFSET + i * WIIMOTE_BUFFER_SIZE];
+    for (u32 j = 0; j < WIIMOTE_BUFFER_SIZE; ++j)
+      wiimote_buffers[i][j] += mixed[j];
+  }
+
+  auto& memory = m_dsphle->GetSystem().GetMemory();
+  for (size_t i = 0; i < m_async_pb_addrs.size(); ++i)
+  {
+    AXPBWii pb;
+    std::memcpy(&pb, &m_async_pbs[i * sizeof(AXPBWii)], sizeof(AXPBWii));
+    WritePB(memory, m_async_pb_addrs[i], pb);
+  }
+}
+
 void AXWiiUCode::MixAUXSamples(int aux_id, u32 write_addr, u32 read_addr, u16 volume)
 {
   std::array<u16, 96> volume_ramp;
@@ -49,6 +49,9 @@ public:
   virtual void Initialize() = 0;
   virtual void HandleMail(u32 mail) = 0;
   virtual void Update() = 0;
+  // Completes work that was started in HandleMail and finished on another thread. Called by
+  // DSPHLE at the emulated time requested through DSPHLE::ScheduleAsyncWorkCompletion.
+  virtual void FinishAsyncWork() {}
 
   virtual void DoState(PointerWrap& p) = 0;
   static u32 GetCRC(UCodeInterface* ucode) { return ucode ? ucode->m_crc : UCODE_NULL; }
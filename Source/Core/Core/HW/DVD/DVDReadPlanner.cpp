@@ -0,0 +1,144 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/HW/DVD/DVDReadPlanner.h"
+
+#include <algorithm>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+#include "DiscIO/Volume.h"
+
+namespace DVD
+{
+ReadPlanner::ReadPlanner(FileEndLookup file_end_lookup)
+    : m_file_end_lookup(std::move(file_end_lookup))
+{
+}
+
+std::vector<ReadPlanner::Run> ReadPlanner::GetRuns(const std::vector<Range>& requests,
+                                                   size_t readers)
+{
+  const auto add_request = [&requests](std::vector<Run>* runs, size_t index, bool new_run) {
+    const Range& request = requests[index];
+    if (new_run)
+    {
+      Run& run = runs->emplace_back();
+      run.dvd_offset = request.dvd_offset;
+      run.partition = request.partition;
+      run.first_request = index;
+    }
+
+    Run& run = runs->back();
+    run.length += request.length;
+    run.end_request = index + 1;
+  };
+
+  // Requests for adjacent data are combined into a single read
+  std::vector<Run> runs;
+  for (size_t i = 0; i < requests.size(); ++i)
+  {
+    const Range& request = requests[i];
+    const bool adjacent = !runs.empty() && runs.back().partition == request.partition &&
+                          runs.back().dvd_offset + runs.back().length == request.dvd_offset;
+    add_request(&runs, i, !adjacent);
+  }
+
+  if (readers <= 1)
+    return runs;
+
+  // Large reads are split at request boundaries, so that the readers can share them
+  std::vector<Run> split_runs;
+  for (const Run& run : runs)
+  {
+    if (run.length < MIN_SPLIT_READ_SIZE)
+    {
+      split_runs.push_back(run);
+      continue;
+    }
+
+    const u64 part_size = (run.length + readers - 1) / readers;
+    for (size_t i = run.first_request; i < run.end_request; ++i)
+      add_request(&split_runs, i, i == run.first_request || split_runs.back().length >= part_size);
+  }
+
+  return split_runs;
+}
+
+bool ReadPlanner::IsPrefetched(const Run& run) const
+{
+  return m_prefetch && m_prefetch->partition == run.partition &&
+         run.dvd_offset >= m_prefetch->dvd_offset &&
+         run.dvd_offset + run.length <= m_prefetch->dvd_offset + m_prefetch->length;
+}
+
+std::optional<ReadPlanner::Range> ReadPlanner::PlanPrefetch(const std::vector<Run>& runs)
+{
+  // A run continues a file if it starts where the previous run ended, or if it was prefetched.
+  // Other runs in the same batch, such as reads of a different file, don't stop that file from
+  // being read ahead.
+  const Run* sequential_run = nullptr;
+  for (const Run& run : runs)
+  {
+    if ((run.partition == m_last_read_partition && run.dvd_offset == m_last_read_end) ||
+        IsPrefetched(run))
+    {
+      sequential_run = &run;
+    }
+
+    m_last_read_partition = run.partition;
+    m_last_read_end = run.dvd_offset + run.length;
+  }
+
+  if (!sequential_run)
+    return std::nullopt;
+
+  const DiscIO::Partition& partition = sequential_run->partition;
+  const u64 end = sequential_run->dvd_offset + sequential_run->length;
+  if (m_prefetch && m_prefetch->partition == partition && end >= m_prefetch->dvd_offset &&
+      end < m_prefetch->dvd_offset + m_prefetch->length)
+  {
+    return std::nullopt;
+  }
+
+  // Only read ahead within the file that is being read, as there's no telling what comes next
+  const std::optional<u64> file_end = GetFileEnd(partition, end - 1);
+  if (!file_end || *file_end <= end)
+    return std::nullopt;
+
+  m_prefetch = Range{end, std::min(PREFETCH_SIZE, *file_end - end), partition};
+  return m_prefetch;
+}
+
+void ReadPlanner::DropPrefetch()
+{
+  m_prefetch.reset();
+}
+
+void ReadPlanner::Reset()
+{
+  m_prefetch.reset();
+  m_last_read_partition = {};
+  m_last_read_end = 0;
+  m_cached_file.reset();
+}
+
+std::optional<u64> ReadPlanner::GetFileEnd(const DiscIO::Partition& partition, u64 offset)
+{
+  if (m_cached_file && m_cached_file->partition == partition &&
+      offset >= m_cached_file->dvd_offset &&
+      offset < m_cached_file->dvd_offset + m_cached_file->length)
+  {
+    return m_cached_file->dvd_offset + m_cached_file->length;
+  }
+
+  const std::optional<u64> file_end = m_file_end_lookup(partition, offset);
+  if (file_end && *file_end > offset)
+    m_cached_file = Range{offset, *file_end - offset, partition};
+
+  return file_end;
+}
+}  // namespace DVD
@@ -0,0 +1,83 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+#include "DiscIO/Volume.h"
+
+namespace DVD
+{
+// Decides which disc reads the DVD thread makes for a batch of requests. Requests for adjacent
+// data are read together, and files that are read from start to end are read ahead of time.
+// Only the DVD thread uses this.
+class ReadPlanner
+{
+public:
+  // Returns the offset where the file that contains the given offset ends,
+  // or nothing if the offset isn't part of any file
+  using FileEndLookup = std::function<std::optional<u64>(const DiscIO::Partition&, u64)>;
+
+  struct Range
+  {
+    u64 dvd_offset = 0;
+    u64 length = 0;
+    DiscIO::Partition partition{};
+  };
+
+  // A single read of adjacent data, covering the requests in [first_request, end_request)
+  struct Run
+  {
+    u64 dvd_offset = 0;
+    u64 length = 0;
+    DiscIO::Partition partition{};
+    size_t first_request = 0;
+    size_t end_request = 0;
+  };
+
+  // The size a run of adjacent requests needs to have before it is split up among readers
+  static constexpr u64 MIN_SPLIT_READ_SIZE = 0x40000;
+  // How much data following a sequential read is read ahead of time, if the file being read is
+  // that large
+  static constexpr u64 PREFETCH_SIZE = 0x100000;
+
+  explicit ReadPlanner(FileEndLookup file_end_lookup);
+
+  // Combines requests for adjacent data in the same partition into runs. If there are several
+  // readers, runs of at least MIN_SPLIT_READ_SIZE are split at request boundaries, so that the
+  // readers can share them.
+  static std::vector<Run> GetRuns(const std::vector<Range>& requests, size_t readers);
+
+  // Whether all data of the run is covered by the current prefetch
+  bool IsPrefetched(const Run& run) const;
+
+  // Records that the runs have been read. If the game seems to be reading a file from start to
+  // end, returns the part of the file to read ahead of time, which replaces the current prefetch.
+  std::optional<Range> PlanPrefetch(const std::vector<Run>& runs);
+
+  // Stops serving runs from the current prefetch, e.g. because reading it failed
+  void DropPrefetch();
+
+  // Forgets about all previous reads. Has to be called when the disc changes.
+  void Reset();
+
+private:
+  std::optional<u64> GetFileEnd(const DiscIO::Partition& partition, u64 offset);
+
+  FileEndLookup m_file_end_lookup;
+
+  std::optional<Range> m_prefetch;
+  DiscIO::Partition m_last_read_partition{};
+  u64 m_last_read_end = 0;
+
+  // The file most recently looked up, so that reading through a file only looks it up once.
+  // The range starts at the offset that was looked up rather than where the file starts.
+  std::optional<Range> m_cached_file;
+};
+}  // namespace DVD
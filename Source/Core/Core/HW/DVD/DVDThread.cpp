@@ -3,10 +3,13 @@
 
 #include "Core/HW/DVD/DVDThread.h"
 
+#include <algorithm>
+#include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <string_view>
 #include <thread>
 #include <utility>
 #include <vector>
@@ -25,18 +28,24 @@
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
 #include "Core/HW/DVD/DVDInterface.h"
+#include "Core/HW/DVD/DVDReadPlanner.h"
 #include "Core/HW/DVD/FileMonitor.h"
 #include "Core/HW/Memmap.h"
 #include "Core/HW/SystemTimers.h"
 #include "Core/IOS/ES/Formats.h"
 #include "Core/System.h"
 
+#include "DiscIO/Blob.h"
 #include "DiscIO/Enums.h"
 #include "DiscIO/Volume.h"
 
 namespace DVD
 {
-DVDThread::DVDThread(Core::System& system) : m_system(system)
+DVDThread::DVDThread(Core::System& system)
+    : m_read_planner([this](const DiscIO::Partition& partition, u64 offset) {
+        return FileMonitor::GetFileEnd(*m_disc, partition, offset);
+      }),
+      m_system(system)
 {
 }
 
@@ -68,6 +77,7 @@ void DVDThread::StartDVDThread()
 void DVDThread::Stop()
 {
   StopDVDThread();
+  DestroyReadWorkers();
   m_disc.reset();
 }
 
@@ -131,6 +141,7 @@ void DVDThread::DoState(PointerWrap& p)
 void DVDThread::SetDisc(std::unique_ptr<DiscIO::Volume> disc)
 {
   WaitUntilIdle();
+  DestroyReadWorkers();
   m_disc = std::move(disc);
 }
 
@@ -332,6 +343,7 @@ void DVDThread::DVDThreadMain()
 {
   Common::SetCurrentThreadName("DVD thread");
 
+  std::vector<ReadRequest> requests;
   while (true)
   {
     m_request_queue_expanded.Wait();
@@ -339,23 +351,194 @@ void DVDThread::DVDThreadMain()
     if (m_dvd_thread_exiting.IsSet())
       return;
 
-    ReadRequest request;
-    while (m_request_queue.Pop(request))
+    while (true)
     {
-      m_file_logger.Log(*m_disc, request.partition, request.dvd_offset);
+      // Take all requests that have been queued so far, so that adjacent ones can be read together
+      ReadRequest request;
+      while (m_request_queue.Pop(request))
+        requests.push_back(std::move(request));
+
+      if (requests.empty())
+        break;
+
+      ProcessRequests(&requests);
+      requests.clear();
+
+      if (m_dvd_thread_exiting.IsSet())
+        return;
+    }
+  }
+}
+
+void DVDThread::ProcessRequests(std::vector<ReadRequest>* requests)
+{
+  std::vector<ReadPlanner::Range> ranges;
+  ranges.reserve(requests->size());
+  for (const ReadRequest& request : *requests)
+  {
+    m_file_logger.Log(*m_disc, request.partition, request.dvd_offset);
+    ranges.push_back({request.dvd_offset, request.length, request.partition});
+  }
+
+  const bool use_read_workers = CreateReadWorkers();
+  const std::vector<ReadPlanner::Run> planned_runs =
+      ReadPlanner::GetRuns(ranges, use_read_workers ? m_read_workers.size() + 1 : 1);
 
-      std::vector<u8> buffer(request.length);
-      if (!m_disc->Read(request.dvd_offset, request.length, buffer.data(), request.partition))
-        buffer.resize(0);
+  std::vector<ReadRun> runs;
+  runs.reserve(planned_runs.size());
+  for (const ReadPlanner::Run& planned_run : planned_runs)
+    runs.push_back({planned_run});
+
+  // Hand out the runs that aren't already prefetched to the workers and the DVD thread in turn.
+  // The workers start reading right away, in parallel with the DVD thread.
+  size_t runs_to_read = 0;
+  for (ReadRun& run : runs)
+  {
+    if (ReadFromPrefetch(&run))
+      continue;
+
+    run.buffer.resize(run.length);
+    const size_t worker_index = runs_to_read++ % (m_read_workers.size() + 1);
+    if (worker_index == 0)
+      continue;
+
+    run.worker = m_read_workers[worker_index - 1].get();
+    run.worker->thread.Push([&run, disc = run.worker->disc.get()] {
+      run.success = disc->Read(run.dvd_offset, run.length, run.buffer.data(), run.partition);
+    });
+  }
+
+  // Results are handed back in the order they were requested. This doesn't affect emulation,
+  // as the emulated time at which each read completes was already scheduled by the CPU thread.
+  for (ReadRun& run : runs)
+  {
+    if (run.worker)
+      run.worker->thread.WaitForCompletion();
+    else if (!run.done)
+      run.success = m_disc->Read(run.dvd_offset, run.length, run.buffer.data(), run.partition);
+
+    const bool single_request = run.end_request - run.first_request == 1;
+    for (size_t i = run.first_request; i < run.end_request; ++i)
+    {
+      ReadRequest& request = (*requests)[i];
+
+      std::vector<u8> buffer;
+      if (run.success && single_request)
+      {
+        buffer = std::move(run.buffer);
+      }
+      else if (run.success)
+      {
+        const auto begin = run.buffer.begin() + (request.dvd_offset - run.dvd_offset);
+        buffer.assign(begin, begin + request.length);
+      }
+      else if (!single_request)
+      {
+        // Find out which of the requests can't be read
+        buffer.resize(request.length);
+        if (!m_disc->Read(request.dvd_offset, request.length, buffer.data(), request.partition))
+          buffer.resize(0);
+      }
 
       request.realtime_done_us = Common::Timer::NowUs();
 
       m_result_queue.Push(ReadResult(std::move(request), std::move(buffer)));
       m_result_queue_expanded.Set();
-
-      if (m_dvd_thread_exiting.IsSet())
-        return;
     }
   }
+
+  // If the game is reading a file from start to end, read the next part of it ahead of time
+  if (use_read_workers)
+  {
+    const std::optional<ReadPlanner::Range> prefetch = m_read_planner.PlanPrefetch(planned_runs);
+    if (prefetch)
+      StartPrefetch(*prefetch);
+  }
+}
+
+bool DVDThread::ReadFromPrefetch(ReadRun* run)
+{
+  if (!m_read_planner.IsPrefetched(*run))
+    return false;
+
+  m_prefetch_worker->thread.WaitForCompletion();
+  if (!m_prefetch->success)
+  {
+    // Read the run on its own instead, which reports the error if it persists. Later runs don't
+    // need to wait for the failed prefetch.
+    m_read_planner.DropPrefetch();
+    m_prefetch.reset();
+    return false;
+  }
+
+  const auto begin = m_prefetch->buffer.begin() + (run->dvd_offset - m_prefetch->dvd_offset);
+  run->buffer.assign(begin, begin + run->length);
+  run->success = true;
+  run->done = true;
+  return true;
+}
+
+void DVDThread::StartPrefetch(const ReadPlanner::Range& range)
+{
+  auto prefetch = std::make_shared<Prefetch>();
+  prefetch->dvd_offset = range.dvd_offset;
+  prefetch->buffer.resize(range.length);
+
+  m_prefetch_worker->thread.Push(
+      [prefetch, partition = range.partition, disc = m_prefetch_worker->disc.get()] {
+        prefetch->success = disc->Read(prefetch->dvd_offset, prefetch->buffer.size(),
+                                       prefetch->buffer.data(), partition);
+      });
+  m_prefetch = std::move(prefetch);
+}
+
+std::unique_ptr<DVDThread::ReadWorker> DVDThread::CreateReadWorker(std::string_view name) const
+{
+  std::unique_ptr<DiscIO::BlobReader> reader = m_disc->GetBlobReader().CopyReader();
+  if (!reader)
+    return nullptr;
+
+  std::unique_ptr<DiscIO::Volume> disc = DiscIO::CreateVolume(std::move(reader));
+  if (!disc)
+    return nullptr;
+
+  auto worker = std::make_unique<ReadWorker>();
+  worker->disc = std::move(disc);
+  worker->thread.Reset(name, [](std::function<void()> work) { work(); });
+  return worker;
+}
+
+bool DVDThread::CreateReadWorkers()
+{
+  if (m_tried_creating_read_workers)
+    return m_prefetch_worker != nullptr;
+
+  m_tried_creating_read_workers = true;
+
+  std::vector<std::unique_ptr<ReadWorker>> read_workers;
+  for (size_t i = 0; i < NUM_READ_WORKERS; ++i)
+  {
+    std::unique_ptr<ReadWorker> worker = CreateReadWorker("DVD Read Worker");
+    if (!worker)
+      return false;
+    read_workers.push_back(std::move(worker));
+  }
+
+  std::unique_ptr<ReadWorker> prefetch_worker = CreateReadWorker("DVD Prefetch");
+  if (!prefetch_worker)
+    return false;
+
+  m_read_workers = std::move(read_workers);
+  m_prefetch_worker = std::move(prefetch_worker);
+  return true;
+}
+
+void DVDThread::DestroyReadWorkers()
+{
+  m_read_workers.clear();
+  m_prefetch_worker.reset();
+  m_tried_creating_read_workers = false;
+  m_prefetch.reset();
+  m_read_planner.Reset();
 }
 }  // namespace DVD
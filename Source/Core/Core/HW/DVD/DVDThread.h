@@ -3,9 +3,11 @@
 
 #pragma once
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <optional>
+#include <string_view>
 #include <thread>
 #include <utility>
 #include <vector>
@@ -14,8 +16,10 @@
 #include "Common/Event.h"
 #include "Common/Flag.h"
 #include "Common/SPSCQueue.h"
+#include "Common/WorkQueueThread.h"
 
 #include "Core/HW/DVD/DVDInterface.h"
+#include "Core/HW/DVD/DVDReadPlanner.h"
 #include "Core/HW/DVD/FileMonitor.h"
 
 #include "DiscIO/Volume.h"
@@ -126,6 +130,39 @@ private:
 
   using ReadResult = std::pair<ReadRequest, std::vector<u8>>;
 
+  // Reads from its own copy of the disc on its own thread
+  struct ReadWorker
+  {
+    std::unique_ptr<DiscIO::Volume> disc;
+    Common::WorkQueueThread<std::function<void()>> thread;
+  };
+
+  // The data read for a run of adjacent requests
+  struct ReadRun : ReadPlanner::Run
+  {
+    std::vector<u8> buffer;
+    bool success = false;
+    bool done = false;
+    ReadWorker* worker = nullptr;
+  };
+
+  struct Prefetch
+  {
+    u64 dvd_offset = 0;
+    std::vector<u8> buffer;
+    bool success = false;
+  };
+
+  void ProcessRequests(std::vector<ReadRequest>* requests);
+  bool ReadFromPrefetch(ReadRun* run);
+  void StartPrefetch(const ReadPlanner::Range& range);
+  std::unique_ptr<ReadWorker> CreateReadWorker(std::string_view name) const;
+  bool CreateReadWorkers();
+  void DestroyReadWorkers();
+
+  // Number of threads that read from copies of the disc in addition to the DVD thread
+  static constexpr size_t NUM_READ_WORKERS = 2;
+
   CoreTiming::EventType* m_finish_read = nullptr;
 
   u64 m_next_id = 0;
@@ -141,6 +178,13 @@ private:
 
   std::unique_ptr<DiscIO::Volume> m_disc;
 
+  // These are only accessed by the DVD thread while it's running.
+  std::vector<std::unique_ptr<ReadWorker>> m_read_workers;
+  std::unique_ptr<ReadWorker> m_prefetch_worker;
+  bool m_tried_creating_read_workers = false;
+  std::shared_ptr<Prefetch> m_prefetch;
+  ReadPlanner m_read_planner;
+
   FileMonitor::FileLogger m_file_logger;
 
   Core::System& m_system;
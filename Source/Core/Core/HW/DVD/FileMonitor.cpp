@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_set>
 
@@ -46,6 +47,20 @@ static bool IsSoundFile(const std::string& filename)
   return extensions.contains(extension);
 }
 
+std::optional<u64> GetFileEnd(const DiscIO::Volume& volume, const DiscIO::Partition& partition,
+                              u64 offset)
+{
+  const DiscIO::FileSystem* file_system = volume.GetFileSystem(partition);
+  if (!file_system)
+    return std::nullopt;
+
+  const std::unique_ptr<DiscIO::FileInfo> file_info = file_system->FindFileInfo(offset);
+  if (!file_info)
+    return std::nullopt;
+
+  return file_info->GetOffset() + file_info->GetSize();
+}
+
 FileLogger::FileLogger() = default;
 
 FileLogger::~FileLogger() = default;
@@ -3,11 +3,18 @@
 
 #pragma once
 
+#include <optional>
+
 #include "Common/CommonTypes.h"
 #include "DiscIO/Volume.h"
 
 namespace FileMonitor
 {
+// Returns the offset where the file that contains the given offset ends,
+// or nothing if the offset isn't part of any file
+std::optional<u64> GetFileEnd(const DiscIO::Volume& volume, const DiscIO::Partition& partition,
+                              u64 offset);
+
 class FileLogger
 {
 public:
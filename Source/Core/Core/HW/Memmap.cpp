@@ -19,6 +19,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 #include "Common/MemArena.h"
+#include "Common/MemoryUtil.h"
 #include "Common/MsgHandler.h"
 #include "Common/Swap.h"
 #include "Core/Config/MainSettings.h"
@@ -235,6 +236,10 @@ bool MemoryManager::InitFastmemArena()
 
 void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
 {
+  // The new views are protected according to the page states, which WatchWrites and friends change
+  // under this lock.
+  std::lock_guard lk(m_dirty_page_lock);
+
   for (auto& entry : m_logical_mapped_entries)
   {
     m_arena.UnmapFromMemoryRegion(entry.mapped_pointer, entry.mapped_size);
@@ -279,7 +284,10 @@ void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
                   intersection_start, mapped_size, logical_address);
               exit(0);
             }
-            m_logical_mapped_entries.push_back({mapped_pointer, mapped_size});
+            m_logical_mapped_entries.push_back({mapped_pointer, mapped_size, position});
+
+            if (m_dirty_page_tracking)
+              ProtectCleanPagesLocked(static_cast<u8*>(mapped_pointer), position, mapped_size);
           }
 
           m_logical_page_mappings[i] =
@@ -341,6 +349,9 @@ void MemoryManager::DoState(PointerWrap& p)
 
 void MemoryManager::Shutdown()
 {
+  DisableDirtyPageTracking();
+  m_page_states.reset();
+  m_shm_size = 0;
   ShutdownFastmemArena();
 
   m_is_initialized = false;
@@ -399,6 +410,322 @@ void MemoryManager::Clear()
     memset(m_exram, 0, GetExRamSize());
 }
 
+template <typename Func>
+void MemoryManager::ForEachView(const Func& func) const
+{
+  for (const PhysicalMemoryRegion& region : m_physical_regions)
+  {
+    if (!region.active)
+      continue;
+
+    func(*region.out_pointer, region.shm_position, region.size);
+    if (m_is_fastmem_arena_initialized)
+      func(m_physical_base + region.physical_address, region.shm_position, region.size);
+  }
+
+  for (const LogicalMemoryView& entry : m_logical_mapped_entries)
+    func(static_cast<u8*>(entry.mapped_pointer), entry.shm_position, entry.mapped_size);
+}
+
+void MemoryManager::SetProtectionLocked(u32 shm_offset, u32 size, bool write_protect)
+{
+  const u32 end = shm_offset + size;
+  ForEachView([&](u8* base, u32 shm_position, u32 view_size) {
+    const u32 intersection_start = std::max(shm_offset, shm_position);
+    const u32 intersection_end = std::min(end, shm_position + view_size);
+    if (intersection_start >= intersection_end)
+      return;
+
+    u8* const pointer = base + (intersection_start - shm_position);
+    const u32 intersection_size = intersection_end - intersection_start;
+    if (write_protect)
+      Common::WriteProtectMemory(pointer, intersection_size);
+    else
+      Common::UnWriteProtectMemory(pointer, intersection_size);
+  });
+}
+
+void MemoryManager::ProtectCleanPagesLocked(u8* base, u32 shm_position, u32 size)
+{
+  // Protect runs of clean or watched pages with one call each.
+  u32 run_start = 0;
+  for (u32 offset = 0; offset <= size; offset += DIRTY_PAGE_SIZE)
+  {
+    const bool protect =
+        offset < size && IsPageProtected((shm_position + offset) / DIRTY_PAGE_SIZE);
+    if (protect)
+      continue;
+
+    if (offset > run_start)
+      Common::WriteProtectMemory(base + run_start, offset - run_start);
+    run_start = offset + DIRTY_PAGE_SIZE;
+  }
+}
+
+bool MemoryManager::IsPageProtected(u32 page) const
+{
+  const u64 state = m_page_states[page].load();
+  return !(state & PAGE_DIRTY) || (state & PAGE_WATCHED);
+}
+
+void MemoryManager::MarkPageDirty(u32 page)
+{
+  u64 state = m_page_states[page].load();
+  u64 new_state;
+  do
+  {
+    new_state = (state | PAGE_DIRTY) & ~PAGE_WATCHED;
+    if (!(state & PAGE_DIRTY) || (state & PAGE_WATCHED))
+      new_state += PAGE_GENERATION_INCREMENT;
+  } while (!m_page_states[page].compare_exchange_weak(state, new_state));
+
+  if (!(state & PAGE_DIRTY))
+  {
+    ++m_num_dirty_pages;
+    ++m_num_newly_dirty_pages;
+  }
+}
+
+void MemoryManager::ResetDirtyPagesLocked()
+{
+  // Protect before clearing the flags, so that a racing write is recorded after the checkpoint
+  // rather than lost.
+  SetProtectionLocked(0, m_shm_size, true);
+  for (u32 i = 0; i < m_shm_size / DIRTY_PAGE_SIZE; ++i)
+    m_page_states[i] &= ~PAGE_DIRTY;
+  m_num_dirty_pages = 0;
+}
+
+void MemoryManager::EnableDirtyPageTracking()
+{
+  std::lock_guard lk(m_dirty_page_lock);
+  if (m_dirty_page_tracking)
+    return;
+
+  if (!m_page_states)
+  {
+    m_shm_size = 0;
+    for (const PhysicalMemoryRegion& region : m_physical_regions)
+    {
+      if (region.active)
+        m_shm_size = std::max(m_shm_size, region.shm_position + region.size);
+    }
+    m_page_states = std::make_unique<std::atomic<u64>[]>(m_shm_size / DIRTY_PAGE_SIZE);
+  }
+  else
+  {
+    // Writes made while tracking was disabled weren't counted, so move every generation on.
+    // Otherwise a generation remembered from before DisableDirtyPageTracking could still match.
+    for (u32 i = 0; i < m_shm_size / DIRTY_PAGE_SIZE; ++i)
+      m_page_states[i] += PAGE_GENERATION_INCREMENT;
+  }
+
+  m_dirty_page_tracking = true;
+  ResetDirtyPagesLocked();
+  m_num_newly_dirty_pages = 0;
+
+  INFO_LOG_FMT(MEMMAP, "Dirty page tracking enabled for {} pages", m_shm_size / DIRTY_PAGE_SIZE);
+}
+
+void MemoryManager::DisableDirtyPageTracking()
+{
+  std::lock_guard lk(m_dirty_page_lock);
+  if (!m_dirty_page_tracking)
+    return;
+
+  // Faults during this still have to be handled, so only stop tracking once nothing is protected.
+  SetProtectionLocked(0, m_shm_size, false);
+  m_dirty_page_tracking = false;
+  m_num_dirty_pages = 0;
+  m_num_newly_dirty_pages = 0;
+}
+
+void MemoryManager::ResetDirtyPages()
+{
+  std::lock_guard lk(m_dirty_page_lock);
+  if (m_dirty_page_tracking)
+    ResetDirtyPagesLocked();
+}
+
+std::optional<std::pair<u32, u32>> MemoryManager::GetPageRange(const u8* host_pointer,
+                                                               size_t size) const
+{
+  if (size == 0)
+    return std::nullopt;
+
+  for (const PhysicalMemoryRegion& region : m_physical_regions)
+  {
+    const u8* const base = *region.out_pointer;
+    if (!region.active || host_pointer < base || host_pointer + size > base + region.size)
+      continue;
+
+    const u32 start = region.shm_position + static_cast<u32>(host_pointer - base);
+    const u32 end = start + static_cast<u32>(size);
+    return std::make_pair(start / DIRTY_PAGE_SIZE, (end - 1) / DIRTY_PAGE_SIZE + 1);
+  }
+  return std::nullopt;
+}
+
+void MemoryManager::MarkDirty(const u8* host_pointer, size_t size)
+{
+  if (!m_dirty_page_tracking)
+    return;
+
+  std::lock_guard lk(m_dirty_page_lock);
+  if (!m_dirty_page_tracking)
+    return;
+
+  const auto pages = GetPageRange(host_pointer, size);
+  if (!pages)
+    return;
+
+  for (u32 page = pages->first; page < pages->second; ++page)
+  {
+    if (!IsPageProtected(page))
+      continue;
+
+    MarkPageDirty(page);
+    SetProtectionLocked(page * DIRTY_PAGE_SIZE, DIRTY_PAGE_SIZE, false);
+  }
+}
+
+std::optional<u64> MemoryManager::WatchWrites(const u8* host_pointer, size_t size)
+{
+  if (!m_dirty_page_tracking)
+    return std::nullopt;
+
+  std::lock_guard lk(m_dirty_page_lock);
+  if (!m_dirty_page_tracking)
+    return std::nullopt;
+
+  const auto pages = GetPageRange(host_pointer, size);
+  if (!pages)
+    return std::nullopt;
+
+  // Set the watched flags before protecting, and take the generation from the same atomic update.
+  // A fault that is handled after this consumes the flag and increments the generation, and
+  // HandleDirtyPageFault checks for a flag set while it was running, so a write that happens after
+  // this returns always changes the generation. Protect runs of writable pages with one call each.
+  u64 generation = 0;
+  u32 run_start = pages->first;
+  for (u32 page = pages->first; page <= pages->second; ++page)
+  {
+    if (page < pages->second)
+    {
+      const u64 state = m_page_states[page].fetch_or(PAGE_WATCHED);
+      generation += state / PAGE_GENERATION_INCREMENT;
+      if ((state & PAGE_DIRTY) && !(state & PAGE_WATCHED))
+        continue;
+    }
+
+    if (page > run_start)
+    {
+      SetProtectionLocked(run_start * DIRTY_PAGE_SIZE, (page - run_start) * DIRTY_PAGE_SIZE,
+                          true);
+    }
+    run_start = page + 1;
+  }
+  return generation;
+}
+
+std::optional<u64> MemoryManager::GetWriteGeneration(const u8* host_pointer, size_t size)
+{
+  if (!m_dirty_page_tracking)
+    return std::nullopt;
+
+  std::lock_guard lk(m_dirty_page_lock);
+  if (!m_dirty_page_tracking)
+    return std::nullopt;
+
+  const auto pages = GetPageRange(host_pointer, size);
+  if (!pages)
+    return std::nullopt;
+
+  // Generations only ever increase, so the sum changes whenever any page is written to.
+  u64 generation = 0;
+  for (u32 page = pages->first; page < pages->second; ++page)
+    generation += m_page_states[page].load() / PAGE_GENERATION_INCREMENT;
+  return generation;
+}
+
+u8* MemoryManager::FindFaultingPage(uintptr_t fault_address, u32* page) const
+{
+  const auto find_in_view = [&](u8* base, u32 shm_position, u32 size) -> u8* {
+    const uintptr_t start = reinterpret_cast<uintptr_t>(base);
+    if (fault_address < start || fault_address >= start + size)
+      return nullptr;
+
+    const u32 offset = static_cast<u32>(fault_address - start) & ~(DIRTY_PAGE_SIZE - 1);
+    *page = (shm_position + offset) / DIRTY_PAGE_SIZE;
+    return base + offset;
+  };
+
+  for (const PhysicalMemoryRegion& region : m_physical_regions)
+  {
+    if (!region.active)
+      continue;
+
+    if (u8* result = find_in_view(*region.out_pointer, region.shm_position, region.size))
+      return result;
+    if (m_is_fastmem_arena_initialized)
+    {
+      u8* const fastmem_view = m_physical_base + region.physical_address;
+      if (u8* result = find_in_view(fastmem_view, region.shm_position, region.size))
+        return result;
+    }
+  }
+
+  // Only JIT code on the CPU thread writes through the logical views, and only the CPU thread
+  // changes them (UpdateLogicalMemory), so a fault in the logical range can't race with changes to
+  // m_logical_mapped_entries. Faults from other threads never get past this check.
+  const uintptr_t logical_base = reinterpret_cast<uintptr_t>(m_logical_base);
+  if (!m_is_fastmem_arena_initialized || fault_address < logical_base ||
+      fault_address - logical_base >= 0x100000000)
+  {
+    return nullptr;
+  }
+
+  for (const LogicalMemoryView& entry : m_logical_mapped_entries)
+  {
+    if (u8* result =
+            find_in_view(static_cast<u8*>(entry.mapped_pointer), entry.shm_position,
+                         entry.mapped_size))
+    {
+      return result;
+    }
+  }
+  return nullptr;
+}
+
+bool MemoryManager::HandleDirtyPageFault(uintptr_t fault_address)
+{
+  u32 page = 0;
+  u8* const page_pointer = FindFaultingPage(fault_address, &page);
+  if (!page_pointer)
+    return false;
+
+  // The flag has to be checked after looking up the view. DisableDirtyPageTracking makes all pages
+  // writable before clearing it, so if tracking was disabled while this write was faulting, the
+  // page is writable by now and the write just has to be retried.
+  if (!m_dirty_page_tracking)
+    return true;
+
+  // Only the view that faulted is made writable. If the page gets written to through another view
+  // as well, that write faults too and ends up here with the page already dirty.
+  //
+  // If WatchWrites protected the page again after MarkPageDirty but before the protection is
+  // removed here, the write would go unnoticed, so mark the page again in that case, which
+  // increments the generation.
+  do
+  {
+    MarkPageDirty(page);
+    if (!Common::UnWriteProtectMemory(page_pointer, DIRTY_PAGE_SIZE))
+      return false;
+  } while (m_page_states[page].load() & PAGE_WATCHED);
+
+  return true;
+}
+
 u8* MemoryManager::GetPointerForRange(u32 address, size_t size) const
 {
   std::span<u8> span = GetSpanForAddress(address);
@@ -420,6 +747,14 @@ u8* MemoryManager::GetPointerForRange(u32 address, size_t size) const
   return span.data();
 }
 
+u8* MemoryManager::GetPointerForKernelWrite(u32 address, size_t size)
+{
+  u8* const pointer = GetPointerForRange(address, size);
+  if (pointer)
+    MarkDirty(pointer, size);
+  return pointer;
+}
+
 void MemoryManager::CopyFromEmu(void* data, u32 address, size_t size) const
 {
   if (size == 0)
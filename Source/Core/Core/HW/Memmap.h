@@ -4,9 +4,13 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <span>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -54,6 +58,7 @@ struct LogicalMemoryView
 {
   void* mapped_pointer;
   u32 mapped_size;
+  u32 shm_position;
 };
 
 class MemoryManager
@@ -103,6 +108,43 @@ public:
 
   void Clear();
 
+  // Dirty page tracking. While it is enabled, all emulated memory is write-protected at every
+  // checkpoint (each savestate). The first write to a page after that faults, and
+  // HandleDirtyPageFault marks the page as dirty and makes it writable again. The write generations
+  // below are built on this, and the statistics window shows the dirty page counts.
+  //
+  // This relies on the fault handler from MemTools catching faults on every thread, since the GPU,
+  // DSP and IOS code write to emulated memory too. Writes done by the kernel (read(), recv(), ...)
+  // fail instead of faulting, so code letting the kernel write to emulated memory directly has to
+  // get its pointer from GetPointerForKernelWrite.
+  static constexpr u32 DIRTY_PAGE_SIZE = 0x4000;
+  void EnableDirtyPageTracking();
+  void DisableDirtyPageTracking();
+  bool IsDirtyPageTrackingEnabled() const { return m_dirty_page_tracking; }
+  // Marks every page as clean. Must only be called while emulation is paused, otherwise writes
+  // racing with the checkpoint may be attributed to the wrong side of it.
+  void ResetDirtyPages();
+  // Makes the pages in the given range of host memory writable and marks them as dirty.
+  void MarkDirty(const u8* host_pointer, size_t size);
+  u32 GetNumDirtyPages() const { return m_num_dirty_pages; }
+  // Returns the number of pages that became dirty since the last call.
+  u32 TakeNumNewlyDirtyPages() { return m_num_newly_dirty_pages.exchange(0); }
+  // Called from the fault handler, so it doesn't take any locks: the thread that faulted might be
+  // holding them already. Returns true if the fault was a write to a write-protected page of a view
+  // of emulated memory, which can be retried now.
+  bool HandleDirtyPageFault(uintptr_t fault_address);
+
+  // Write generations let caches of data derived from emulated memory (e.g. texture hashes) tell
+  // whether the memory may have changed. Every page has a counter that is incremented when a write
+  // to the page faults. WatchWrites write-protects the pages in the given range of host memory
+  // again, even if they are dirty, so that the next write to each of them is counted, and returns
+  // the current generation of the range. As long as GetWriteGeneration returns the same value for
+  // the range later on, none of its pages have been written to. Generations never go back, even
+  // across disabling and re-enabling tracking. Both return nullopt if dirty page tracking is
+  // disabled or the range isn't in emulated memory.
+  std::optional<u64> WatchWrites(const u8* host_pointer, size_t size);
+  std::optional<u64> GetWriteGeneration(const u8* host_pointer, size_t size);
+
   // Routines to access physically addressed memory, designed for use by
   // emulated hardware outside the CPU. Use "Device_" prefix.
   std::string GetString(u32 em_address, size_t size = 0);
@@ -116,6 +158,10 @@ public:
   // of the corresponding range in host memory. Otherwise, returns nullptr.
   u8* GetPointerForRange(u32 address, size_t size) const;
 
+  // Like GetPointerForRange, but for buffers that are filled by the kernel, e.g. with read() or
+  // recv(). See the dirty page tracking comment above.
+  u8* GetPointerForKernelWrite(u32 address, size_t size);
+
   void CopyFromEmu(void* data, u32 address, size_t size) const;
   void CopyToEmu(u32 address, const void* data, size_t size);
   void Memset(u32 address, u8 value, size_t size);
@@ -252,8 +298,35 @@ private:
   std::array<void*, PowerPC::BAT_PAGE_COUNT> m_physical_page_mappings{};
   std::array<void*, PowerPC::BAT_PAGE_COUNT> m_logical_page_mappings{};
 
+  // Dirty page tracking. The state of each page within the shared memory segment is one atomic
+  // word, so that the fault handler can update it without a lock: a dirty flag, a flag for dirty
+  // pages that are write-protected anyway because of WatchWrites, and the write generation in the
+  // remaining bits. Once allocated, the states are kept until Shutdown, so that a fault racing
+  // with DisableDirtyPageTracking doesn't touch freed memory.
+  static constexpr u64 PAGE_DIRTY = 1;
+  static constexpr u64 PAGE_WATCHED = 2;
+  static constexpr u64 PAGE_GENERATION_INCREMENT = 4;
+  std::atomic<bool> m_dirty_page_tracking = false;
+  std::unique_ptr<std::atomic<u64>[]> m_page_states;
+  u32 m_shm_size = 0;
+  std::atomic<u32> m_num_dirty_pages = 0;
+  std::atomic<u32> m_num_newly_dirty_pages = 0;
+  // Serializes the functions above that change page protection. HandleDirtyPageFault doesn't take
+  // it.
+  std::mutex m_dirty_page_lock;
+
   Core::System& m_system;
 
   void InitMMIO(bool is_wii);
+
+  template <typename Func>
+  void ForEachView(const Func& func) const;
+  void SetProtectionLocked(u32 shm_offset, u32 size, bool write_protect);
+  void ProtectCleanPagesLocked(u8* base, u32 shm_position, u32 size);
+  bool IsPageProtected(u32 page) const;
+  void MarkPageDirty(u32 page);
+  u8* FindFaultingPage(uintptr_t fault_address, u32* page) const;
+  std::optional<std::pair<u32, u32>> GetPageRange(const u8* host_pointer, size_t size) const;
+  void ResetDirtyPagesLocked();
 };
 }  // namespace Memory
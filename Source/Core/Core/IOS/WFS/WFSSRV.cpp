@@ -300,7 +300,7 @@ std::optional<IPCReply> WFSSRVDevice::IOCtl(const IOCtlRequest& request)
       fd_obj->file.Seek(position, File::SeekOrigin::Begin);
     }
     size_t read_bytes;
-    fd_obj->file.ReadArray(memory.GetPointerForRange(addr, size), size, &read_bytes);
+    fd_obj->file.ReadArray(memory.GetPointerForKernelWrite(addr, size), size, &read_bytes);
     // TODO(wfs): Handle read errors.
     if (absolute)
     {
@@ -8,4 +8,6 @@ namespace EMM
 void InstallExceptionHandler();
 void UninstallExceptionHandler();
 bool IsExceptionHandlerSupported();
+// Returns whether faults on threads other than the one that installed the handler reach it too.
+bool IsExceptionHandlerProcessWide();
 }  // namespace EMM
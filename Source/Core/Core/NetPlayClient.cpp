@@ -853,6 +853,7 @@ void NetPlayClient::OnStartGame(sf::Packet& packet)
     packet >> m_net_settings.override_region_settings;
     packet >> m_net_settings.dsp_enable_jit;
     packet >> m_net_settings.dsp_hle;
+    packet >> m_net_settings.dsp_hle_async_mixing;
     packet >> m_net_settings.ram_override_enable;
     packet >> m_net_settings.mem1_size;
     packet >> m_net_settings.mem2_size;
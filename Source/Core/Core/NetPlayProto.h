@@ -39,6 +39,7 @@ struct NetSettings
   int selected_language = 0;
   bool override_region_settings = false;
   bool dsp_hle = false;
+  bool dsp_hle_async_mixing = false;
   bool dsp_enable_jit = false;
   bool ram_override_enable = false;
   u32 mem1_size = 0;
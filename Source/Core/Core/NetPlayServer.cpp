@@ -1363,6 +1363,7 @@ bool NetPlayServer::SetupNetSettings()
   settings.selected_language = Config::Get(Config::MAIN_GC_LANGUAGE);
   settings.override_region_settings = Config::Get(Config::MAIN_OVERRIDE_REGION_SETTINGS);
   settings.dsp_hle = Config::Get(Config::MAIN_DSP_HLE);
+  settings.dsp_hle_async_mixing = Config::Get(Config::MAIN_DSP_HLE_ASYNC_MIXING);
   settings.dsp_enable_jit = Config::Get(Config::MAIN_DSP_JIT);
   settings.ram_override_enable = Config::Get(Config::MAIN_RAM_OVERRIDE_ENABLE);
   settings.mem1_size = Config::Get(Config::MAIN_MEM1_SIZE);
@@ -1591,6 +1592,7 @@ bool NetPlayServer::StartGame()
   spac << m_settings.override_region_settings;
   spac << m_settings.dsp_enable_jit;
   spac << m_settings.dsp_hle;
+  spac << m_settings.dsp_hle_async_mixing;
   spac << m_settings.ram_override_enable;
   spac << m_settings.mem1_size;
   spac << m_settings.mem2_size;
@@ -25,6 +25,8 @@
 #include "Common/StringUtil.h"
 #include "Common/Swap.h"
 #include "Common/x64ABI.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
 #include "Core/HLE/HLE.h"
@@ -34,6 +36,8 @@
 #include "Core/HW/ProcessorInterface.h"
 #include "Core/Host.h"
 #include "Core/MachineContext.h"
+#include "Core/Movie.h"
+#include "Core/NetPlayProto.h"
 #include "Core/PatchEngine.h"
 #include "Core/PowerPC/Interpreter/Interpreter.h"
 #include "Core/PowerPC/Jit64/JitAsm.h"
@@ -763,6 +767,10 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
     }
     ClearCache();
   }
+  if (!IsDebuggingEnabled())
+    blocks.WarmUpFromDiskCache(em_address);
+
+  const auto compile_start = Clock::now();
   FreeRanges();
 
   std::size_t block_size = m_code_buffer.size();
@@ -807,38 +815,13 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
     return;
   }
 
-  if (SetEmitterStateToFreeCodeRegion())
-  {
-    u8* near_start = GetWritableCodePtr();
-    u8* far_start = m_far_code.GetWritableCodePtr();
-
-    JitBlock* b = blocks.AllocateBlock(em_address);
-    if (DoJit(em_address, b, nextPC))
-    {
-      // Code generation succeeded.
-
-      // Mark the memory regions that this code block uses as used in the local rangesets.
-      u8* near_end = GetWritableCodePtr();
-      if (near_start != near_end)
-        m_free_ranges_near.erase(near_start, near_end);
-      u8* far_end = m_far_code.GetWritableCodePtr();
-      if (far_start != far_end)
-        m_free_ranges_far.erase(far_start, far_end);
+  js.baselineTier = ShouldCompileBaselineTier(em_address);
 
-      // Store the used memory regions in the block so we know what to mark as unused when the
-      // block gets invalidated.
-      b->near_begin = near_start;
-      b->near_end = near_end;
-      b->far_begin = far_start;
-      b->far_end = far_end;
-
-      blocks.FinalizeBlock(*b, jo.enableBlocklink, code_block, m_code_buffer);
-
-#ifdef JIT_LOG_GENERATED_CODE
-      LogGeneratedCode();
-#endif
-      return;
-    }
+  const u32 physical_address = m_mmu.JitCache_TranslateAddress(em_address).address;
+  if (EmitBlock(em_address, physical_address, nextPC))
+  {
+    blocks.RecordOnDemandCompile(Clock::now() - compile_start);
+    return;
   }
 
   if (clear_cache_and_retry_on_failure)
@@ -856,6 +839,134 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
   std::exit(-1);
 }
 
+bool Jit64::EmitBlock(u32 em_address, u32 physical_address, u32 nextPC)
+{
+  if (!SetEmitterStateToFreeCodeRegion())
+    return false;
+
+  u8* near_start = GetWritableCodePtr();
+  u8* far_start = m_far_code.GetWritableCodePtr();
+
+  JitBlock* b = blocks.AllocateBlock(em_address, physical_address);
+  if (!DoJit(em_address, b, nextPC))
+    return false;
+
+  // Code generation succeeded.
+
+  // Mark the memory regions that this code block uses as used in the local rangesets.
+  u8* near_end = GetWritableCodePtr();
+  if (near_start != near_end)
+    m_free_ranges_near.erase(near_start, near_end);
+  u8* far_end = m_far_code.GetWritableCodePtr();
+  if (far_start != far_end)
+    m_free_ranges_far.erase(far_start, far_end);
+
+  // Store the used memory regions in the block so we know what to mark as unused when the
+  // block gets invalidated.
+  b->near_begin = near_start;
+  b->near_end = near_end;
+  b->far_begin = far_start;
+  b->far_end = far_end;
+
+  blocks.FinalizeBlock(*b, jo.enableBlocklink, code_block, m_code_buffer);
+
+#ifdef JIT_LOG_GENERATED_CODE
+  LogGeneratedCode();
+#endif
+  return true;
+}
+
+bool Jit64::CompileCachedBlock(const JitBlockDiskCache::Key& key)
+{
+  if (blocks.GetBlockFromStartAddress(key.effective_address, m_ppc_state.feature_flags))
+    return true;
+
+  // The CPU hasn't reached this code yet, so read it without touching the emulated instruction
+  // cache and TLB.
+  const auto first_instruction = m_mmu.TryPeekInstruction(key.effective_address);
+  if (!first_instruction.valid || first_instruction.physical_address != key.physical_address)
+    return false;
+
+  FreeRanges();
+
+  const u32 nextPC = analyzer.Analyze(key.effective_address, &code_block, &m_code_buffer,
+                                      m_code_buffer.size(), true);
+  if (code_block.m_memory_exception || code_block.m_num_instructions != key.num_instructions ||
+      JitBlockDiskCache::HashGuestCode(m_code_buffer, code_block.m_num_instructions) !=
+          key.guest_code_hash)
+  {
+    return false;
+  }
+
+  // Only blocks compiled at the full tier get recorded, so this one ran often enough last time to
+  // be worth the full compile up front.
+  js.baselineTier = false;
+
+  if (EmitBlock(key.effective_address, key.physical_address, nextPC))
+    return true;
+
+  // Out of code space. Unlike Jit(), don't retry; the cache clear stops the warm-up.
+  WARN_LOG_FMT(DYNA_REC, "flushing code caches while compiling blocks from the JIT disk cache");
+  ClearCache();
+  return false;
+}
+
+void Jit64::OnNewTitleLoad()
+{
+  // Blocks compiled ahead of time never fill the emulated instruction cache when they run, so
+  // keep this out of sessions that have to stay deterministic.
+  if (!Config::Get(Config::MAIN_JIT_DISK_CACHE) || NetPlay::IsNetPlayRunning() ||
+      m_system.GetMovie().IsMovieActive())
+  {
+    blocks.CloseDiskCache();
+    return;
+  }
+
+  blocks.OpenDiskCache(SConfig::GetInstance().GetGameID());
+}
+
+void Jit64::CompileAhead(TimePoint deadline)
+{
+  // Like the JIT disk cache, this changes which blocks fill the emulated instruction cache, which
+  // has to stay deterministic for these.
+  if (!IsBlockPrefetchEnabled() || IsDebuggingEnabled() || NetPlay::IsNetPlayRunning() ||
+      m_system.GetMovie().IsMovieActive())
+  {
+    return;
+  }
+
+  blocks.CompileQueuedExits(deadline);
+}
+
+bool Jit64::CompileSpeculativeBlock(u32 em_address)
+{
+  if (blocks.GetBlockFromStartAddress(em_address, m_ppc_state.feature_flags))
+    return true;
+
+  // Like CompileCachedBlock, this must not touch the emulated instruction cache and TLB.
+  const auto first_instruction = m_mmu.TryPeekInstruction(em_address);
+  if (!first_instruction.valid)
+    return false;
+
+  FreeRanges();
+
+  const u32 nextPC =
+      analyzer.Analyze(em_address, &code_block, &m_code_buffer, m_code_buffer.size(), true);
+  if (code_block.m_memory_exception)
+    return false;
+
+  js.baselineTier = ShouldCompileBaselineTier(em_address);
+
+  if (EmitBlock(em_address, first_instruction.physical_address, nextPC))
+    return true;
+
+  // Out of code space. The half-emitted block is still in the block map, so clear the cache; that
+  // also stops CompileQueuedExits.
+  WARN_LOG_FMT(DYNA_REC, "flushing code caches while compiling blocks ahead of time");
+  ClearCache();
+  return false;
+}
+
 bool Jit64::SetEmitterStateToFreeCodeRegion()
 {
   // Find the largest free memory blocks and set code emitters to point at them.
@@ -905,6 +1016,23 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
   if (IsProfilingEnabled())
     ABI_CallFunctionP(&JitBlock::ProfileData::BeginProfiling, b->profile_data.get());
 
+  if (js.baselineTier)
+  {
+    b->tier_up_countdown = TIER_UP_THRESHOLD;
+    MOV(64, R(RSCRATCH), ImmPtr(&b->tier_up_countdown));
+    SUB(32, MatR(RSCRATCH), Imm8(1));
+    FixupBranch tier_up = J_CC(CC_Z, Jump::Near);
+
+    SwitchToFarCode();
+    SetJumpTarget(tier_up);
+    MOV(32, PPCSTATE(pc), Imm32(js.blockStart));
+    ABI_PushRegistersAndAdjustStack({}, 0);
+    ABI_CallFunctionPP(JitBase::TierUpFromJIT, static_cast<JitBase*>(this), b);
+    ABI_PopRegistersAndAdjustStack({}, 0);
+    JMP(asm_routines.dispatcher_no_check, Jump::Near);
+    SwitchToNearCode();
+  }
+
 #if defined(_DEBUG) || defined(DEBUGFAST) || defined(NAN_CHECK)
   // should help logged stack-traces become more accurate
   MOV(32, PPCSTATE(pc), Imm32(js.blockStart));
@@ -1095,7 +1223,7 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
         js.firstFPInstructionFound = true;
       }
 
-      if (bJITRegisterCacheOff)
+      if (bJITRegisterCacheOff || js.baselineTier)
       {
         gpr.Flush();
         fpr.Flush();
@@ -1159,7 +1287,7 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
       fpr.Commit();
 
       // If we have a register that will never be used again, discard or flush it.
-      if (!bJITRegisterCacheOff)
+      if (!bJITRegisterCacheOff && !js.baselineTier)
       {
         gpr.Discard(op.gprDiscardable);
         fpr.Discard(op.fprDiscardable);
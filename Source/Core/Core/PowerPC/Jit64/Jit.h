@@ -65,6 +65,11 @@ public:
   void Jit(u32 em_address) override;
   void Jit(u32 em_address, bool clear_cache_and_retry_on_failure);
   bool DoJit(u32 em_address, JitBlock* b, u32 nextPC);
+  bool CompileCachedBlock(const JitBlockDiskCache::Key& key) override;
+
+  void OnNewTitleLoad() override;
+  void CompileAhead(TimePoint deadline) override;
+  bool CompileSpeculativeBlock(u32 em_address) override;
 
   void EraseSingleBlock(const JitBlock& block) override;
   std::vector<MemoryStats> GetMemoryStats() const override;
@@ -273,6 +278,10 @@ private:
 
   bool HandleFunctionHooking(u32 address);
 
+  // Emits the block that the analyzer produced for em_address and adds it to the block cache.
+  // Returns false if there wasn't enough free code space.
+  bool EmitBlock(u32 em_address, u32 physical_address, u32 nextPC);
+
   void FreeRanges();
   void ResetFreeMemoryRanges();
 
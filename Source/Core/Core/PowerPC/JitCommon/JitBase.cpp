@@ -57,7 +57,7 @@
 // After resetting the stack to the top, we call _resetstkoflw() to restore
 // the guard page at the 256kb mark.
 
-const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 23> JitBase::JIT_SETTINGS{{
+const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 25> JitBase::JIT_SETTINGS{{
     {&JitBase::bJITOff, &Config::MAIN_DEBUG_JIT_OFF},
     {&JitBase::bJITLoadStoreOff, &Config::MAIN_DEBUG_JIT_LOAD_STORE_OFF},
     {&JitBase::bJITLoadStorelXzOff, &Config::MAIN_DEBUG_JIT_LOAD_STORE_LXZ_OFF},
@@ -81,6 +81,8 @@ const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 23> JitB
     {&JitBase::m_accurate_nans, &Config::MAIN_ACCURATE_NANS},
     {&JitBase::m_fastmem_enabled, &Config::MAIN_FASTMEM},
     {&JitBase::m_accurate_cpu_cache_enabled, &Config::MAIN_ACCURATE_CPU_CACHE},
+    {&JitBase::m_enable_tiered_compilation, &Config::MAIN_JIT_TIERED_COMPILATION},
+    {&JitBase::m_enable_block_prefetch, &Config::MAIN_JIT_PREFETCH_BLOCKS},
 }};
 
 const u8* JitBase::Dispatch(JitBase& jit)
@@ -285,3 +287,18 @@ bool JitBase::ShouldHandleFPExceptionForInstruction(const PPCAnalyst::CodeOp* op
   else
     return false;
 }
+
+bool JitBase::ShouldCompileBaselineTier(u32 em_address) const
+{
+  // Profiling and debugging want to see the code that actually gets run in the long term.
+  return m_enable_tiered_compilation && !IsProfilingEnabled() && !IsDebuggingEnabled() &&
+         !js.tierUpAddresses.contains(em_address);
+}
+
+void JitBase::TierUpFromJIT(JitBase& jit, const JitBlock* block)
+{
+  // The block's code stays intact until the next compilation, so returning into it to get to the
+  // dispatcher is fine. The new block gets linked to from the blocks that linked to this one.
+  jit.js.tierUpAddresses.insert(block->effectiveAddress);
+  jit.EraseSingleBlock(*block);
+}
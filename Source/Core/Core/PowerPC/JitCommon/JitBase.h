@@ -55,7 +55,7 @@ class PPCSymbolDB;
     }                                                                                              \
   } while (0)
 
-#define JITDISABLE(setting) FALLBACK_IF(bJITOff || setting)
+#define JITDISABLE(setting) FALLBACK_IF(bJITOff || js.baselineTier || setting)
 
 class JitBase : public CPUCoreBase
 {
@@ -79,6 +79,9 @@ protected:
   static constexpr size_t GUARD_SIZE = 64 * 1024;
   static constexpr size_t GUARD_OFFSET = SAFE_STACK_SIZE - GUARD_SIZE;
 
+  // How many times a baseline tier block runs before it gets recompiled with full optimization.
+  static constexpr u32 TIER_UP_THRESHOLD = 32;
+
   struct JitOptions
   {
     bool enableBlocklink;
@@ -130,6 +133,10 @@ protected:
     std::unordered_set<u32> fifoWriteAddresses;
     std::unordered_set<u32> pairedQuantizeAddresses;
     std::unordered_set<u32> noSpeculativeConstantsAddresses;
+
+    // Whether the block being compiled only calls into the interpreter, see TierUpFromJIT.
+    bool baselineTier;
+    std::unordered_set<u32> tierUpAddresses;
   };
 
   PPCAnalyst::CodeBlock code_block;
@@ -160,12 +167,14 @@ protected:
   bool m_accurate_nans = false;
   bool m_fastmem_enabled = false;
   bool m_accurate_cpu_cache_enabled = false;
+  bool m_enable_tiered_compilation = false;
+  bool m_enable_block_prefetch = false;
 
   bool m_enable_blr_optimization = false;
   bool m_cleanup_after_stackfault = false;
   u8* m_stack_guard = nullptr;
 
-  static const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 23> JIT_SETTINGS;
+  static const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 25> JIT_SETTINGS;
 
   bool DoesConfigNeedRefresh() const;
   void RefreshConfig();
@@ -189,6 +198,13 @@ protected:
 
   bool ShouldHandleFPExceptionForInstruction(const PPCAnalyst::CodeOp* op) const;
 
+  // With tiered compilation, new blocks are first compiled at a baseline tier that calls into the
+  // interpreter for every instruction. That is much cheaper to emit than optimized code, which
+  // matters for the many blocks that only ever run a handful of times. Baseline blocks count
+  // their runs and recompile themselves at the full tier once they reach TIER_UP_THRESHOLD.
+  bool ShouldCompileBaselineTier(u32 em_address) const;
+  static void TierUpFromJIT(JitBase& jit, const JitBlock* block);
+
 public:
   explicit JitBase(Core::System& system);
   JitBase(const JitBase&) = delete;
@@ -199,12 +215,27 @@ public:
 
   bool IsProfilingEnabled() const { return m_enable_profiling; }
   bool IsDebuggingEnabled() const { return m_enable_debugging; }
+  bool IsBlockPrefetchEnabled() const { return m_enable_block_prefetch; }
 
   static const u8* Dispatch(JitBase& jit);
   virtual JitBaseBlockCache* GetBlockCache() = 0;
 
   virtual void Jit(u32 em_address) = 0;
 
+  // Compiles the block described by a JIT disk cache entry, provided that the guest code in memory
+  // still matches it. Returns whether a block for the entry exists afterwards.
+  virtual bool CompileCachedBlock(const JitBlockDiskCache::Key& key) { return false; }
+
+  // Called after a new title's executable has been loaded into memory.
+  virtual void OnNewTitleLoad() {}
+
+  // Called while the CPU thread would otherwise sleep to throttle emulation speed. The JIT can use
+  // the time until the deadline to compile blocks that are likely to run soon.
+  virtual void CompileAhead(TimePoint deadline) {}
+  // Compiles a block that hasn't been reached yet. Unlike Jit(), this must not raise exceptions.
+  // Returns whether a block for em_address exists afterwards.
+  virtual bool CompileSpeculativeBlock(u32 em_address) { return false; }
+
   virtual void EraseSingleBlock(const JitBlock& block) = 0;
 
   // Memory region name, free size, and fragmentation ratio
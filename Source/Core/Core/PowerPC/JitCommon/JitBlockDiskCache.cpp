@@ -0,0 +1,120 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/PowerPC/JitCommon/JitBlockDiskCache.h"
+
+#include <utility>
+
+#include <fmt/format.h>
+#include <xxhash.h>
+
+#include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
+#include "Core/PowerPC/JitCommon/JitCache.h"
+
+u64 JitBlockDiskCache::HashGuestCode(const PPCAnalyst::CodeBuffer& code_buffer,
+                                     u32 num_instructions)
+{
+  // Branch following can pull code from anywhere into a block, so the addresses are hashed too.
+  std::vector<u32> words;
+  words.reserve(num_instructions * 2);
+  for (u32 i = 0; i < num_instructions; ++i)
+  {
+    words.push_back(code_buffer[i].address);
+    words.push_back(code_buffer[i].inst.hex);
+  }
+  return XXH3_64bits(words.data(), words.size() * sizeof(u32));
+}
+
+u32 JitBlockDiskCache::Open(const std::string& game_id)
+{
+  Close();
+
+  const std::string& cache_dir = File::GetUserPath(D_JITCACHE_IDX);
+  if (!File::Exists(cache_dir))
+    File::CreateDir(cache_dir);
+
+  class CacheReader : public Common::LinearDiskCacheReader<Key, u32>
+  {
+  public:
+    explicit CacheReader(JitBlockDiskCache& cache) : m_cache(cache) {}
+    void Read(const Key& key, const u32* value, u32 value_size) override
+    {
+      if (!m_cache.m_recorded.insert(key).second)
+        return;
+
+      m_cache.m_entries.emplace(key.effective_address,
+                                Entry{key, std::vector<u32>(value, value + value_size)});
+    }
+
+  private:
+    JitBlockDiskCache& m_cache;
+  };
+
+  const std::string filename = fmt::format("{}{}.cache", cache_dir, game_id);
+  CacheReader reader(*this);
+  const u32 count = m_file.OpenAndRead(filename, reader);
+  INFO_LOG_FMT(DYNA_REC, "Loaded {} cached JIT blocks from {}", count, filename);
+
+  m_is_open = true;
+  Requeue();
+  return count;
+}
+
+void JitBlockDiskCache::Close()
+{
+  if (m_is_open)
+  {
+    m_file.Sync();
+    m_file.Close();
+    m_is_open = false;
+  }
+
+  m_recorded.clear();
+  m_entries.clear();
+  m_pending.clear();
+}
+
+void JitBlockDiskCache::Record(const JitBlock& block, u64 guest_code_hash)
+{
+  const Key key{block.effectiveAddress, block.physicalAddress, block.feature_flags,
+                block.originalSize, guest_code_hash};
+  if (!m_recorded.insert(key).second)
+    return;
+
+  std::vector<u32> exits;
+  exits.reserve(block.linkData.size());
+  for (const JitBlock::LinkData& link_data : block.linkData)
+    exits.push_back(link_data.exitAddress);
+
+  m_file.Append(key, exits.data(), static_cast<u32>(exits.size()));
+}
+
+void JitBlockDiskCache::Requeue()
+{
+  m_pending = m_entries;
+}
+
+std::vector<u32> JitBlockDiskCache::GetPendingAddresses() const
+{
+  std::vector<u32> addresses;
+  for (auto it = m_pending.begin(); it != m_pending.end(); it = m_pending.upper_bound(it->first))
+    addresses.push_back(it->first);
+  return addresses;
+}
+
+std::vector<JitBlockDiskCache::Entry> JitBlockDiskCache::TakePending(u32 em_address)
+{
+  std::vector<Entry> entries;
+  auto [begin, end] = m_pending.equal_range(em_address);
+  for (auto it = begin; it != end; ++it)
+    entries.push_back(std::move(it->second));
+  m_pending.erase(begin, end);
+  return entries;
+}
+
+void JitBlockDiskCache::ReturnPending(Entry entry)
+{
+  const u32 em_address = entry.key.effective_address;
+  m_pending.emplace(em_address, std::move(entry));
+}
@@ -0,0 +1,77 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <compare>
+#include <map>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/LinearDiskCache.h"
+#include "Core/PowerPC/PPCAnalyst.h"
+
+struct JitBlock;
+
+// Remembers which blocks a title compiled in earlier sessions, so that they can be compiled up
+// front the next time the title boots instead of one at a time while the game is running.
+//
+// Host code isn't stored, since the emitted code embeds absolute pointers into Dolphin's own code
+// and data, which move between runs. Each entry instead records where a block starts, the feature
+// flags it was compiled with and a hash of the guest code it was compiled from. An entry is only
+// used if the guest code currently in memory hashes to the same value, and the blocks compiled
+// from it are ordinary blocks that InvalidateICache erases like any other.
+class JitBlockDiskCache
+{
+public:
+  struct Key
+  {
+    u32 effective_address;
+    u32 physical_address;
+    u32 feature_flags;
+    u32 num_instructions;
+    u64 guest_code_hash;
+
+    auto operator<=>(const Key&) const = default;
+  };
+  static_assert(std::is_trivially_copyable_v<Key>);
+
+  struct Entry
+  {
+    Key key;
+    // The exit addresses from the block's link data. Compiling these right after the block lets
+    // the block linker connect them immediately.
+    std::vector<u32> exits;
+  };
+
+  static u64 HashGuestCode(const PPCAnalyst::CodeBuffer& code_buffer, u32 num_instructions);
+
+  // Returns the number of entries loaded from disk.
+  u32 Open(const std::string& game_id);
+  void Close();
+  bool IsOpen() const { return m_is_open; }
+
+  // Appends the block to the file unless an identical entry was already recorded.
+  void Record(const JitBlock& block, u64 guest_code_hash);
+
+  // Marks all loaded entries as not yet compiled, e.g. after the JIT cache has been cleared.
+  void Requeue();
+
+  bool HasPending() const { return !m_pending.empty(); }
+  std::vector<u32> GetPendingAddresses() const;
+  // Removes and returns the pending entries for blocks starting at em_address.
+  std::vector<Entry> TakePending(u32 em_address);
+  // Puts back an entry that couldn't be used yet, e.g. because the code isn't loaded yet.
+  void ReturnPending(Entry entry);
+
+private:
+  Common::LinearDiskCache<Key, u32> m_file;
+  bool m_is_open = false;
+
+  std::set<Key> m_recorded;
+  std::multimap<u32, Entry> m_entries;
+  std::multimap<u32, Entry> m_pending;
+};
@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <cstring>
 #include <functional>
 #include <map>
@@ -12,9 +13,11 @@
 #include <set>
 #include <span>
 #include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/JitRegister.h"
+#include "Common/Logging/Log.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/Host.h"
@@ -70,6 +73,8 @@ void JitBaseBlockCache::Shutdown()
 {
   Common::JitRegister::Shutdown();
 
+  CloseDiskCache();
+
   m_entry_points_arena.Release();
 }
 
@@ -80,9 +85,13 @@ void JitBaseBlockCache::Clear()
 #if defined(_DEBUG) || defined(DEBUGFAST)
   Core::DisplayMessage("Clearing code cache.", 3000);
 #endif
+  ++m_clear_count;
+
   m_jit.js.fifoWriteAddresses.clear();
   m_jit.js.pairedQuantizeAddresses.clear();
   m_jit.js.noSpeculativeConstantsAddresses.clear();
+  m_jit.js.tierUpAddresses.clear();
+  m_prefetch_queue.clear();
   for (auto& e : block_map)
   {
     DestroyBlock(e.second);
@@ -132,7 +141,11 @@ void JitBaseBlockCache::WipeBlockProfilingData(const Core::CPUThreadGuard&)
 
 JitBlock* JitBaseBlockCache::AllocateBlock(u32 em_address)
 {
-  const u32 physical_address = m_jit.m_mmu.JitCache_TranslateAddress(em_address).address;
+  return AllocateBlock(em_address, m_jit.m_mmu.JitCache_TranslateAddress(em_address).address);
+}
+
+JitBlock* JitBaseBlockCache::AllocateBlock(u32 em_address, u32 physical_address)
+{
   JitBlock& b = block_map.emplace(physical_address, m_jit.IsProfilingEnabled())->second;
   b.effectiveAddress = em_address;
   b.physicalAddress = physical_address;
@@ -171,6 +184,11 @@ void JitBaseBlockCache::FinalizeBlock(JitBlock& block, bool block_link,
                                  original_buffer_transform_view.end());
   }
 
+  // Baseline tier blocks are cheap to compile on demand, so only record blocks that ran often
+  // enough to be compiled at the full tier.
+  if (m_disk_cache.IsOpen() && !m_jit.IsDebuggingEnabled() && block.tier_up_countdown == 0)
+    m_disk_cache.Record(block, JitBlockDiskCache::HashGuestCode(code_buffer, block.originalSize));
+
   for (u32 addr : block.physical_addresses)
   {
     valid_block.Set(addr / 32);
@@ -185,6 +203,15 @@ void JitBaseBlockCache::FinalizeBlock(JitBlock& block, bool block_link,
     }
 
     LinkBlock(block);
+
+    if (m_jit.IsBlockPrefetchEnabled() && m_prefetch_depth < MAX_PREFETCH_DEPTH)
+    {
+      for (const auto& e : block.linkData)
+      {
+        if (!e.linkStatus && m_prefetch_queue.size() < MAX_PREFETCH_QUEUE_SIZE)
+          m_prefetch_queue.emplace_back(e.exitAddress, m_prefetch_depth + 1);
+      }
+    }
   }
 
   Common::Symbol* symbol = nullptr;
@@ -416,6 +443,125 @@ u32* JitBaseBlockCache::GetBlockBitSet() const
   return valid_block.m_valid_block.get();
 }
 
+void JitBaseBlockCache::OpenDiskCache(const std::string& game_id)
+{
+  m_disk_cache.Open(game_id);
+  m_disk_cache_swept = false;
+  m_disk_cache_stats = {};
+}
+
+void JitBaseBlockCache::CloseDiskCache()
+{
+  if (m_disk_cache.IsOpen())
+  {
+    using std::chrono::duration_cast;
+    using std::chrono::milliseconds;
+    const DiskCacheStats& stats = m_disk_cache_stats;
+    NOTICE_LOG_FMT(DYNA_REC,
+                   "JIT disk cache: {} blocks compiled up front in {} ms, {} blocks compiled on "
+                   "demand in {} ms",
+                   stats.warm_up_blocks, duration_cast<milliseconds>(stats.warm_up_time).count(),
+                   stats.on_demand_blocks,
+                   duration_cast<milliseconds>(stats.on_demand_time).count());
+  }
+
+  m_disk_cache.Close();
+}
+
+void JitBaseBlockCache::RecordOnDemandCompile(Clock::duration time)
+{
+  if (!m_disk_cache.IsOpen())
+    return;
+
+  ++m_disk_cache_stats.on_demand_blocks;
+  m_disk_cache_stats.on_demand_time += time;
+}
+
+void JitBaseBlockCache::RequeueDiskCache()
+{
+  if (!m_disk_cache.IsOpen())
+    return;
+
+  m_disk_cache.Requeue();
+  m_disk_cache_swept = false;
+}
+
+void JitBaseBlockCache::WarmUpFromDiskCache(u32 em_address)
+{
+  if (!m_disk_cache.HasPending())
+    return;
+
+  const CPUEmuFeatureFlags feature_flags = m_jit.m_ppc_state.feature_flags;
+  std::vector<u32> worklist;
+  std::set<u32> visited{em_address};
+
+  // The caller compiles the block at em_address itself, so only its exits are of interest here.
+  for (JitBlockDiskCache::Entry& entry : m_disk_cache.TakePending(em_address))
+  {
+    if (entry.key.feature_flags == feature_flags)
+      worklist.insert(worklist.end(), entry.exits.begin(), entry.exits.end());
+    else
+      m_disk_cache.ReturnPending(std::move(entry));
+  }
+
+  if (!m_disk_cache_swept)
+  {
+    const std::vector<u32> pending = m_disk_cache.GetPendingAddresses();
+    worklist.insert(worklist.end(), pending.rbegin(), pending.rend());
+    m_disk_cache_swept = true;
+  }
+
+  const auto start_time = std::chrono::steady_clock::now();
+  const u32 clear_count = m_clear_count;
+  u32 compiled_count = 0;
+  while (!worklist.empty() && clear_count == m_clear_count)
+  {
+    const u32 address = worklist.back();
+    worklist.pop_back();
+    if (!visited.insert(address).second)
+      continue;
+
+    for (JitBlockDiskCache::Entry& entry : m_disk_cache.TakePending(address))
+    {
+      if (entry.key.feature_flags != feature_flags || !m_jit.CompileCachedBlock(entry.key))
+      {
+        // The code might not have been loaded yet, or the MSR might be different right now.
+        m_disk_cache.ReturnPending(std::move(entry));
+        continue;
+      }
+
+      ++compiled_count;
+      worklist.insert(worklist.end(), entry.exits.begin(), entry.exits.end());
+    }
+  }
+
+  if (compiled_count != 0)
+  {
+    const auto elapsed = std::chrono::steady_clock::now() - start_time;
+    m_disk_cache_stats.warm_up_blocks += compiled_count;
+    m_disk_cache_stats.warm_up_time += elapsed;
+    INFO_LOG_FMT(DYNA_REC, "Compiled {} blocks from the JIT disk cache in {} ms", compiled_count,
+                 std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count());
+  }
+}
+
+void JitBaseBlockCache::CompileQueuedExits(TimePoint deadline)
+{
+  const CPUEmuFeatureFlags feature_flags = m_jit.m_ppc_state.feature_flags;
+  const u32 clear_count = m_clear_count;
+  while (!m_prefetch_queue.empty() && clear_count == m_clear_count && Clock::now() < deadline)
+  {
+    const auto [address, depth] = m_prefetch_queue.front();
+    m_prefetch_queue.pop_front();
+    if (GetBlockFromStartAddress(address, feature_flags))
+      continue;
+
+    m_prefetch_depth = depth;
+    m_jit.CompileSpeculativeBlock(address);
+    m_prefetch_depth = 0;
+  }
+}
+
 void JitBaseBlockCache::WriteDestroyBlock(const JitBlock& block)
 {
 }
@@ -7,10 +7,12 @@
 #include <bitset>
 #include <chrono>
 #include <cstring>
+#include <deque>
 #include <functional>
 #include <map>
 #include <memory>
 #include <set>
+#include <string>
 #include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
@@ -19,6 +21,7 @@
 #include "Common/CommonTypes.h"
 #include "Core/HW/Memmap.h"
 #include "Core/PowerPC/Gekko.h"
+#include "Core/PowerPC/JitCommon/JitBlockDiskCache.h"
 #include "Core/PowerPC/PPCAnalyst.h"
 
 class JitBase;
@@ -108,6 +111,10 @@ struct JitBlock : public JitBlockData
   std::vector<std::pair<u32, UGeckoInstruction>> original_buffer;
 
   std::unique_ptr<ProfileData> profile_data;
+
+  // Runs left before a baseline tier block gets recompiled with full optimization. Decremented by
+  // the block itself; unused for blocks compiled at the full tier.
+  u32 tier_up_countdown = 0;
 };
 
 typedef void (*CompiledCode)();
@@ -167,6 +174,7 @@ public:
   std::size_t GetBlockCount() const { return block_map.size(); }
 
   JitBlock* AllocateBlock(u32 em_address);
+  JitBlock* AllocateBlock(u32 em_address, u32 physical_address);
   void FinalizeBlock(JitBlock& block, bool block_link, const PPCAnalyst::CodeBlock& code_block,
                      const PPCAnalyst::CodeBuffer& code_buffer);
 
@@ -188,6 +196,24 @@ public:
 
   u32* GetBlockBitSet() const;
 
+  // Persistent cache of previously compiled blocks, see JitBlockDiskCache.
+  void OpenDiskCache(const std::string& game_id);
+  void CloseDiskCache();
+  void RequeueDiskCache();
+  // Compiles the cached blocks that are still valid for the current guest code and feature flags.
+  // The first call after the cache was (re)queued considers every cached block; later calls only
+  // follow the exits of the cached block at em_address, which the caller is about to compile.
+  void WarmUpFromDiskCache(u32 em_address);
+  // Counts a block the CPU thread had to wait for while the disk cache is open. Together with the
+  // blocks compiled from the disk cache, this is logged when the disk cache is closed, which gives
+  // the numbers to compare a session with a cold cache to one with a warm cache.
+  void RecordOnDemandCompile(Clock::duration time);
+
+  // Compiles blocks for the exits of recently compiled blocks that don't lead to a block yet, until
+  // the deadline passes. Blocks compiled this way queue their own exits in turn, up to
+  // MAX_PREFETCH_DEPTH branches away from code that has actually run.
+  void CompileQueuedExits(TimePoint deadline);
+
 protected:
   virtual void DestroyBlock(JitBlock& block);
 
@@ -235,4 +261,24 @@ private:
   // in case the shm memory region couldn't be allocated.
   std::array<JitBlock*, FAST_BLOCK_MAP_FALLBACK_ELEMENTS>
       m_fast_block_map_fallback{};  // start_addr & mask -> number
+
+  JitBlockDiskCache m_disk_cache;
+  bool m_disk_cache_swept = false;
+  struct DiskCacheStats
+  {
+    u32 warm_up_blocks = 0;
+    Clock::duration warm_up_time = {};
+    u32 on_demand_blocks = 0;
+    Clock::duration on_demand_time = {};
+  };
+  DiskCacheStats m_disk_cache_stats;
+  // Incremented by Clear(), so that a warm-up can tell that the code space ran out.
+  u32 m_clear_count = 0;
+
+  static constexpr u32 MAX_PREFETCH_DEPTH = 2;
+  static constexpr size_t MAX_PREFETCH_QUEUE_SIZE = 1024;
+  // Exit address and how many branches away it is from code that has actually run.
+  std::deque<std::pair<u32, u32>> m_prefetch_queue;
+  // Depth of the block that is being compiled, 0 unless called from CompileQueuedExits.
+  u32 m_prefetch_depth = 0;
 };
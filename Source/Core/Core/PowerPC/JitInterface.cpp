@@ -45,7 +45,10 @@ void JitInterface::SetJit(std::unique_ptr<JitBase> jit)
 void JitInterface::DoState(PointerWrap& p)
 {
   if (m_jit && p.IsReadMode())
+  {
     m_jit->ClearCache();
+    m_jit->GetBlockCache()->RequeueDiskCache();
+  }
 }
 
 CPUCoreBase* JitInterface::InitJitCore(PowerPC::CPUCore core)
@@ -223,6 +226,12 @@ bool JitInterface::HandleStackFault()
   return m_jit->HandleStackFault();
 }
 
+void JitInterface::OnNewTitleLoad(const Core::CPUThreadGuard&)
+{
+  if (m_jit)
+    m_jit->OnNewTitleLoad();
+}
+
 void JitInterface::ClearCache(const Core::CPUThreadGuard&)
 {
   if (m_jit)
@@ -241,6 +250,12 @@ void JitInterface::EraseSingleBlock(const JitBlock& block)
     m_jit->EraseSingleBlock(block);
 }
 
+void JitInterface::CompileAhead(TimePoint deadline)
+{
+  if (m_jit)
+    m_jit->CompileAhead(deadline);
+}
+
 std::vector<JitBase::MemoryStats> JitInterface::GetMemoryStats() const
 {
   if (m_jit)
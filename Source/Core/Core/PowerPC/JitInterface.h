@@ -55,6 +55,8 @@ public:
   bool HandleFault(uintptr_t access_address, SContext* ctx);
   bool HandleStackFault();
 
+  void OnNewTitleLoad(const Core::CPUThreadGuard& guard);
+
   // Clearing CodeCache
   void ClearCache(const Core::CPUThreadGuard& guard);
 
@@ -76,6 +78,9 @@ public:
   std::size_t DisassembleNearCode(const JitBlock& block, std::ostream& stream) const;
   std::size_t DisassembleFarCode(const JitBlock& block, std::ostream& stream) const;
 
+  // Gives the JIT a chance to compile ahead of time while the CPU thread would otherwise sleep.
+  void CompileAhead(TimePoint deadline);
+
   // If "forced" is true, a recompile is being requested on code that hasn't been modified.
   void InvalidateICache(u32 address, u32 size, bool forced);
   void InvalidateICacheLine(u32 address);
@@ -502,6 +502,27 @@ TryReadInstResult MMU::TryReadInstruction(u32 address)
   return TryReadInstResult{true, from_bat, hex, address};
 }
 
+TryReadInstResult MMU::TryPeekInstruction(u32 address)
+{
+  bool from_bat = true;
+  if (m_ppc_state.msr.IR)
+  {
+    auto tlb_addr = TranslateAddress<XCheckTLBFlag::OpcodeNoException>(address);
+    if (!tlb_addr.Success())
+      return TryReadInstResult{false, false, 0, 0};
+
+    address = tlb_addr.address;
+    from_bat = tlb_addr.result == TranslateAddressResultEnum::BAT_TRANSLATED;
+  }
+
+  u32 hex;
+  if (m_memory.GetFakeVMEM() && ((address & 0xFE000000) == 0x7E000000))
+    hex = Common::swap32(&m_memory.GetFakeVMEM()[address & m_memory.GetFakeVMemMask()]);
+  else
+    hex = m_ppc_state.iCache.PeekInstruction(m_memory, m_ppc_state, address);
+  return TryReadInstResult{true, from_bat, hex, address};
+}
+
 u32 MMU::HostRead_Instruction(const Core::CPUThreadGuard& guard, const u32 address)
 {
   return guard.GetSystem().GetMMU().ReadFromHardware<XCheckTLBFlag::OpcodeNoException, u32>(
@@ -212,6 +212,9 @@ public:
   // Used by interpreter to read instructions, uses iCache
   u32 Read_Opcode(u32 address);
   TryReadInstResult TryReadInstruction(u32 address);
+  // Like TryReadInstruction, but leaves the instruction cache and the TLB untouched. Used for
+  // compiling code before the CPU reaches it, which must not change emulated state.
+  TryReadInstResult TryPeekInstruction(u32 address);
 
   u8 Read_U8(u32 address);
   u16 Read_U16(u32 address);
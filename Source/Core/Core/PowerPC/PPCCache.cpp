@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cstring>
 
 #include "Common/ChunkFile.h"
 #include "Common/Swap.h"
@@ -206,24 +207,21 @@ void Cache::Touch(Memory::MemoryManager& memory, u32 addr, bool store)
   GetCache(memory, addr, false);
 }
 
-std::pair<u32, u32> Cache::GetCache(Memory::MemoryManager& memory, u32 addr, bool locked)
+u32 Cache::FindWay(Memory::MemoryManager& memory, u32 addr) const
 {
-  addr &= ~31;
-  u32 set = (addr >> 5) & 0x7f;
-  u32 way;
-
   if (addr & CACHE_VMEM_BIT)
-  {
-    way = lookup_table_vmem[(addr & memory.GetFakeVMemMask()) >> 5];
-  }
+    return lookup_table_vmem[(addr & memory.GetFakeVMemMask()) >> 5];
   else if (addr & CACHE_EXRAM_BIT)
-  {
-    way = lookup_table_ex[(addr & memory.GetExRamMask()) >> 5];
-  }
+    return lookup_table_ex[(addr & memory.GetExRamMask()) >> 5];
   else
-  {
-    way = lookup_table[(addr & memory.GetRamMask()) >> 5];
-  }
+    return lookup_table[(addr & memory.GetRamMask()) >> 5];
+}
+
+std::pair<u32, u32> Cache::GetCache(Memory::MemoryManager& memory, u32 addr, bool locked)
+{
+  addr &= ~31;
+  u32 set = (addr >> 5) & 0x7f;
+  u32 way = FindWay(memory, addr);
 
   // load to the cache
   if (!locked && way == 0xff)
@@ -386,6 +384,24 @@ u32 InstructionCache::ReadInstruction(Memory::MemoryManager& memory,
   return Common::swap32(value);
 }
 
+u32 InstructionCache::PeekInstruction(Memory::MemoryManager& memory,
+                                      PowerPC::PowerPCState& ppc_state, u32 addr) const
+{
+  if (!HID0(ppc_state).ICE || m_disable_icache)  // instruction cache is disabled
+    return memory.Read_U32(addr);
+
+  // A block that isn't cached would be loaded from memory, so memory holds the same instruction.
+  const u32 way = FindWay(memory, addr & ~31);
+  if (way == 0xff)
+    return memory.Read_U32(addr);
+
+  const u32 set = (addr >> 5) & 0x7f;
+  u32 value;
+  std::memcpy(&value, reinterpret_cast<const u8*>(data[set][way].data()) + (addr & 31),
+              sizeof(value));
+  return Common::swap32(value);
+}
+
 void InstructionCache::Invalidate(Memory::MemoryManager& memory, JitInterface& jit_interface,
                                   u32 addr)
 {
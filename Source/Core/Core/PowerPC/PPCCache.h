@@ -59,6 +59,8 @@ struct Cache
   void FlushAll(Memory::MemoryManager& memory);
 
   std::pair<u32, u32> GetCache(Memory::MemoryManager& memory, u32 addr, bool locked);
+  // Returns the way that holds addr, or 0xff if it isn't cached. Doesn't change the cache.
+  u32 FindWay(Memory::MemoryManager& memory, u32 addr) const;
 
   void Read(Memory::MemoryManager& memory, u32 addr, void* buffer, u32 len, bool locked);
   void Write(Memory::MemoryManager& memory, u32 addr, const void* buffer, u32 len, bool locked);
@@ -78,6 +80,10 @@ struct InstructionCache : public Cache
   InstructionCache() = default;
   ~InstructionCache();
   u32 ReadInstruction(Memory::MemoryManager& memory, PowerPC::PowerPCState& ppc_state, u32 addr);
+  // Returns the same instruction as ReadInstruction, but without loading it into the cache or
+  // updating the PLRU bits.
+  u32 PeekInstruction(Memory::MemoryManager& memory, PowerPC::PowerPCState& ppc_state,
+                      u32 addr) const;
   void Invalidate(Memory::MemoryManager& memory, JitInterface& jit_interface, u32 addr);
   void Init(Memory::MemoryManager& memory);
   void Reset(JitInterface& jit_interface);
@@ -0,0 +1,226 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/RewindBuffer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+namespace State
+{
+// A delta consists of one list of runs per section. Each run consists of a u32 count of 64-bit
+// words that are unchanged, a u32 count of words that changed, and then the XOR of each changed
+// word. An empty run, which the encoder never emits otherwise, ends the list of a section. Both
+// versions of a section are treated as if they were zero-padded to the same length.
+constexpr size_t MAX_RUN_WORDS = std::numeric_limits<u32>::max();
+
+static u64 ReadWord(std::span<const u8> data, size_t word_index)
+{
+  const size_t offset = word_index * sizeof(u64);
+  u64 word = 0;
+  if (offset + sizeof(u64) <= data.size())
+    std::memcpy(&word, data.data() + offset, sizeof(u64));
+  else if (offset < data.size())
+    std::memcpy(&word, data.data() + offset, data.size() - offset);
+  return word;
+}
+
+template <typename T>
+static void Append(std::vector<u8>* out, T value)
+{
+  const size_t offset = out->size();
+  out->resize(offset + sizeof(T));
+  std::memcpy(out->data() + offset, &value, sizeof(T));
+}
+
+template <typename T>
+static T Read(std::span<const u8> data, size_t offset)
+{
+  T value;
+  std::memcpy(&value, data.data() + offset, sizeof(T));
+  return value;
+}
+
+static size_t GetSectionCount(std::span<const size_t> a_starts, std::span<const size_t> b_starts)
+{
+  return std::max(a_starts.size(), b_starts.size()) + 1;
+}
+
+// Returns the offset and size of a section. Sections past the last one of a snapshot are empty.
+static std::pair<size_t, size_t> GetSectionBounds(size_t size, std::span<const size_t> starts,
+                                                  size_t index)
+{
+  const size_t begin = index == 0 ? 0 : index <= starts.size() ? starts[index - 1] : size;
+  const size_t end = index < starts.size() ? starts[index] : size;
+  return {begin, end - begin};
+}
+
+static std::span<const u8> GetSection(std::span<const u8> data, std::span<const size_t> starts,
+                                      size_t index)
+{
+  const auto [offset, size] = GetSectionBounds(data.size(), starts, index);
+  return data.subspan(offset, size);
+}
+
+static void EncodeSection(std::vector<u8>* delta, std::span<const u8> older,
+                          std::span<const u8> newer)
+{
+  const size_t word_count = (std::max(older.size(), newer.size()) + sizeof(u64) - 1) / sizeof(u64);
+  const auto xor_word = [&](size_t i) { return ReadWord(older, i) ^ ReadWord(newer, i); };
+
+  size_t i = 0;
+  while (i < word_count)
+  {
+    const size_t unchanged_start = i;
+    while (i < word_count && i - unchanged_start < MAX_RUN_WORDS && xor_word(i) == 0)
+      ++i;
+
+    const size_t changed_start = i;
+    while (i < word_count && i - changed_start < MAX_RUN_WORDS && xor_word(i) != 0)
+      ++i;
+
+    Append(delta, static_cast<u32>(changed_start - unchanged_start));
+    Append(delta, static_cast<u32>(i - changed_start));
+    for (size_t j = changed_start; j < i; ++j)
+      Append(delta, xor_word(j));
+  }
+
+  Append(delta, u32(0));
+  Append(delta, u32(0));
+}
+
+std::vector<u8> RewindBuffer::EncodeDelta(std::span<const u8> older,
+                                          std::span<const size_t> older_section_starts,
+                                          std::span<const u8> newer,
+                                          std::span<const size_t> newer_section_starts)
+{
+  std::vector<u8> delta;
+  const size_t section_count = GetSectionCount(older_section_starts, newer_section_starts);
+  for (size_t i = 0; i < section_count; ++i)
+  {
+    EncodeSection(&delta, GetSection(older, older_section_starts, i),
+                  GetSection(newer, newer_section_starts, i));
+  }
+  return delta;
+}
+
+std::vector<u8> RewindBuffer::ApplyDelta(std::span<const u8> newer,
+                                         std::span<const size_t> newer_section_starts,
+                                         std::span<const u8> delta, size_t older_size,
+                                         std::span<const size_t> older_section_starts)
+{
+  std::vector<u8> older;
+  older.reserve(older_size);
+
+  const size_t section_count = GetSectionCount(older_section_starts, newer_section_starts);
+  size_t offset = 0;
+  for (size_t section = 0; section < section_count; ++section)
+  {
+    const std::span<const u8> newer_section = GetSection(newer, newer_section_starts, section);
+    const size_t older_section_size =
+        GetSectionBounds(older_size, older_section_starts, section).second;
+
+    const size_t section_begin = older.size();
+    older.insert(older.end(), newer_section.begin(), newer_section.end());
+
+    size_t word = 0;
+    while (offset + 2 * sizeof(u32) <= delta.size())
+    {
+      const u32 unchanged_words = Read<u32>(delta, offset);
+      const u32 changed_words = Read<u32>(delta, offset + sizeof(u32));
+      offset += 2 * sizeof(u32);
+      if (unchanged_words == 0 && changed_words == 0)
+        break;
+
+      word += unchanged_words;
+      const size_t end = section_begin + (word + changed_words) * sizeof(u64);
+      if (older.size() < end)
+        older.resize(end);
+
+      for (u32 i = 0; i < changed_words; ++i, ++word, offset += sizeof(u64))
+      {
+        u8* const target = older.data() + section_begin + word * sizeof(u64);
+        u64 value;
+        std::memcpy(&value, target, sizeof(u64));
+        value ^= Read<u64>(delta, offset);
+        std::memcpy(target, &value, sizeof(u64));
+      }
+    }
+
+    older.resize(section_begin + older_section_size);
+  }
+
+  return older;
+}
+
+void RewindBuffer::SetBudget(size_t budget_bytes)
+{
+  m_budget_bytes = budget_bytes;
+  EnforceBudget();
+}
+
+std::vector<u8> RewindBuffer::Push(std::vector<u8> snapshot, std::vector<size_t> section_starts)
+{
+  std::vector<u8> previous;
+  if (m_has_newest)
+  {
+    Delta delta{EncodeDelta(m_newest, m_newest_section_starts, snapshot, section_starts),
+                m_newest.size(), std::move(m_newest_section_starts)};
+    m_delta_bytes += delta.data.size();
+    m_deltas.push_back(std::move(delta));
+    previous = std::move(m_newest);
+  }
+
+  m_newest = std::move(snapshot);
+  m_newest_section_starts = std::move(section_starts);
+  m_has_newest = true;
+  EnforceBudget();
+  return previous;
+}
+
+bool RewindBuffer::Pop(std::vector<u8>* snapshot)
+{
+  if (!m_has_newest)
+    return false;
+
+  if (m_deltas.empty())
+  {
+    *snapshot = std::move(m_newest);
+    m_newest = {};
+    m_newest_section_starts = {};
+    m_has_newest = false;
+    return true;
+  }
+
+  *snapshot = std::move(m_newest);
+
+  Delta& delta = m_deltas.back();
+  m_newest = ApplyDelta(*snapshot, m_newest_section_starts, delta.data, delta.older_size,
+                        delta.older_section_starts);
+  m_newest_section_starts = std::move(delta.older_section_starts);
+  m_delta_bytes -= delta.data.size();
+  m_deltas.pop_back();
+  return true;
+}
+
+void RewindBuffer::Clear()
+{
+  m_newest = {};
+  m_newest_section_starts = {};
+  m_has_newest = false;
+  m_deltas.clear();
+  m_delta_bytes = 0;
+}
+
+void RewindBuffer::EnforceBudget()
+{
+  // The newest snapshot is always kept, even if it alone exceeds the budget.
+  while (!m_deltas.empty() && GetUsedBytes() > m_budget_bytes)
+  {
+    m_delta_bytes -= m_deltas.front().data.size();
+    m_deltas.pop_front();
+  }
+}
+}  // namespace State
@@ -0,0 +1,76 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <span>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+namespace State
+{
+// Keeps a history of savestates in memory within a fixed budget.
+//
+// Only the newest snapshot is stored in full. Every older snapshot is stored as the XOR of itself
+// and the snapshot after it, run-length encoded. Most of a state (MEM1, MEM2, ARAM, ...) doesn't
+// change between two snapshots taken a fraction of a second apart, so the XOR is almost entirely
+// zeroes and encodes to a tiny fraction of the full size. When the budget is exceeded, the oldest
+// snapshots are dropped first.
+//
+// A snapshot can be split into sections, given as the offsets at which every section after the
+// first one starts. Each section is XORed with the section of the same index, so a section that
+// grows or shrinks doesn't shift the data of the sections after it against each other.
+//
+// Not thread-safe.
+class RewindBuffer
+{
+public:
+  void SetBudget(size_t budget_bytes);
+
+  // Makes snapshot the newest entry. Returns the buffer of the previously newest snapshot so that
+  // its allocation can be reused for the next snapshot, or an empty vector if there was none.
+  std::vector<u8> Push(std::vector<u8> snapshot, std::vector<size_t> section_starts = {});
+
+  // Removes the newest snapshot and stores it in snapshot. Returns false if there is none.
+  bool Pop(std::vector<u8>* snapshot);
+
+  void Clear();
+
+  bool IsEmpty() const { return !m_has_newest; }
+  size_t GetSnapshotCount() const { return m_has_newest ? m_deltas.size() + 1 : 0; }
+  // The total memory used by all snapshots, which is kept within the budget if possible.
+  size_t GetUsedBytes() const { return m_newest.size() + m_delta_bytes; }
+  // The size of the most recently stored delta, or 0 if there is none.
+  size_t GetLastDeltaBytes() const { return m_deltas.empty() ? 0 : m_deltas.back().data.size(); }
+
+  // Exposed for testing.
+  static std::vector<u8> EncodeDelta(std::span<const u8> older,
+                                     std::span<const size_t> older_section_starts,
+                                     std::span<const u8> newer,
+                                     std::span<const size_t> newer_section_starts);
+  static std::vector<u8> ApplyDelta(std::span<const u8> newer,
+                                    std::span<const size_t> newer_section_starts,
+                                    std::span<const u8> delta, size_t older_size,
+                                    std::span<const size_t> older_section_starts);
+
+private:
+  struct Delta
+  {
+    std::vector<u8> data;
+    size_t older_size;
+    std::vector<size_t> older_section_starts;
+  };
+
+  void EnforceBudget();
+
+  std::vector<u8> m_newest;
+  std::vector<size_t> m_newest_section_starts;
+  bool m_has_newest = false;
+  std::deque<Delta> m_deltas;
+  size_t m_delta_bytes = 0;
+  size_t m_budget_bytes = 0;
+};
+}  // namespace State
@@ -7,6 +7,7 @@
 #include <atomic>
 #include <condition_variable>
 #include <filesystem>
+#include <future>
 #include <locale>
 #include <map>
 #include <memory>
@@ -20,7 +21,9 @@
 #include <fmt/format.h>
 
 #include <lz4.h>
+#include <lz4hc.h>
 #include <lzo/lzo1x.h>
+#include <zstd.h>
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
@@ -28,6 +31,7 @@
 #include "Common/Event.h"
 #include "Common/FileUtil.h"
 #include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Common/Thread.h"
 #include "Common/TimeUtil.h"
@@ -37,6 +41,7 @@
 
 #include "Core/AchievementManager.h"
 #include "Core/Config/AchievementSettings.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
@@ -48,6 +53,7 @@
 #include "Core/Movie.h"
 #include "Core/NetPlayClient.h"
 #include "Core/PowerPC/PowerPC.h"
+#include "Core/RewindBuffer.h"
 #include "Core/System.h"
 
 #include "VideoCommon/FrameDumpFFMpeg.h"
@@ -80,6 +86,8 @@ struct CompressAndDumpState_args
 {
   std::vector<u8> buffer_vector;
   std::string filename;
+  CompressionType compression_type;
+  int compression_level;
   std::shared_ptr<Common::Event> state_write_done_event;
 };
 
@@ -98,8 +106,29 @@ static std::mutex s_state_writes_in_queue_mutex;
 static size_t s_state_writes_in_queue;
 static std::condition_variable s_state_write_queue_is_empty;
 
+struct RewindSnapshot_args
+{
+  std::vector<u8> buffer;
+  std::vector<size_t> section_starts;
+  u64 cpu_pause_us;
+  size_t budget_bytes;
+};
+
+// Protects s_rewind_buffer and s_rewind_spare_buffer.
+static std::mutex s_rewind_mutex;
+static RewindBuffer s_rewind_buffer;
+// The allocation of a dropped snapshot, kept around so that capturing doesn't have to allocate and
+// page in a new buffer of the full state size every time.
+static std::vector<u8> s_rewind_spare_buffer;
+
+// Delta encodes captured snapshots into s_rewind_buffer, away from the CPU thread.
+static Common::WorkQueueThread<RewindSnapshot_args> s_rewind_thread;
+
+static std::atomic<u32> s_rewind_fields_until_capture;
+static std::atomic<bool> s_rewind_capture_pending;
+
 // Don't forget to increase this after doing changes on the savestate system
-constexpr u32 STATE_VERSION = 169;  // Last changed in PR 13074
+constexpr u32 STATE_VERSION = 170;  // Last changed for the async AX mixing worker state
 
 // Increase this if the StateExtendedHeader definition changes
 constexpr u32 EXTENDED_HEADER_VERSION = 1;  // Last changed in PR 12217
@@ -109,6 +138,10 @@ constexpr u32 COMPRESSED_DATA_OFFSET = 0;
 
 constexpr u32 COOKIE_BASE = 0xBAADBABE;
 
+// Uncompressed size of each chunk of the chunked compression types. Large enough that the
+// compression ratio barely suffers, small enough that even small states are spread across threads.
+constexpr u32 CHUNKED_PAYLOAD_CHUNK_SIZE = 2 * 1024 * 1024;
+
 // Maps savestate versions to Dolphin versions.
 // Versions after 42 don't need to be added to this list,
 // because they save the exact Dolphin version to savestates.
@@ -139,8 +172,36 @@ void EnableCompression(bool compression)
   s_use_compression = compression;
 }
 
-static void DoState(Core::System& system, PointerWrap& p)
+// Called on the CPU thread, so that the worker thread doesn't have to touch the config.
+static CompressionType GetCompressionTypeForSaving()
+{
+  if (!s_use_compression)
+    return CompressionType::Uncompressed;
+
+  switch (Config::Get(Config::MAIN_SAVESTATE_COMPRESSION_METHOD))
+  {
+  case CompressionMethod::None:
+    return CompressionType::Uncompressed;
+  case CompressionMethod::Zstd:
+    return CompressionType::ChunkedZstd;
+  case CompressionMethod::LZ4:
+  default:
+    return CompressionType::ChunkedLZ4;
+  }
+}
+
+// When writing, section_starts (if not null) receives the offsets from base at which the parts of
+// the state after variable-length data start. The rewind buffer delta encodes each part on its
+// own, so that the event queue growing by one entry doesn't shift all of RAM against the previous
+// snapshot.
+static void DoState(Core::System& system, PointerWrap& p, u8* base = nullptr,
+                    std::vector<size_t>* section_starts = nullptr)
 {
+  const auto start_section = [&] {
+    if (section_starts && p.IsWriteMode())
+      section_starts->push_back(p.GetOffsetFromPreviousPosition(base));
+  };
+
   bool is_wii = system.IsWii() || system.IsMIOS();
   const bool is_wii_currently = is_wii;
   p.Do(is_wii);
@@ -177,20 +238,24 @@ static void DoState(Core::System& system, PointerWrap& p)
   system.GetMovie().DoState(p);
   p.DoMarker("Movie");
 
+  start_section();
   // Begin with video backend, so that it gets a chance to clear its caches and writeback modified
   // things to RAM
   g_video_backend->DoState(p);
   p.DoMarker("video_backend");
 
+  start_section();
   // CoreTiming needs to be restored before restoring Hardware because
   // the controller code might need to schedule an event if the controller has changed.
   system.GetCoreTiming().DoState(p);
   p.DoMarker("CoreTiming");
 
+  start_section();
   // HW needs to be restored before PowerPC because the data cache might need to be flushed.
   HW::DoState(system, p);
   p.DoMarker("HW");
 
+  start_section();
   system.GetPowerPC().DoState(p);
   p.DoMarker("PowerPC");
 
@@ -203,6 +268,10 @@ static void DoState(Core::System& system, PointerWrap& p)
 #ifdef USE_RETRO_ACHIEVEMENTS
   AchievementManager::GetInstance().DoState(p);
 #endif  // USE_RETRO_ACHIEVEMENTS
+
+  // Every savestate is a checkpoint for dirty page tracking.
+  if (!p.IsMeasureMode())
+    memory.ResetDirtyPages();
 }
 
 void LoadFromBuffer(Core::System& system, std::vector<u8>& buffer)
@@ -229,7 +298,8 @@ void LoadFromBuffer(Core::System& system, std::vector<u8>& buffer)
       true);
 }
 
-void SaveToBuffer(Core::System& system, std::vector<u8>& buffer)
+static void SaveToBuffer(Core::System& system, std::vector<u8>& buffer,
+                         std::vector<size_t>* section_starts)
 {
   Core::RunOnCPUThread(
       system,
@@ -243,11 +313,89 @@ void SaveToBuffer(Core::System& system, std::vector<u8>& buffer)
 
         ptr = buffer.data();
         PointerWrap p(&ptr, buffer_size, PointerWrap::Mode::Write);
-        DoState(system, p);
+        DoState(system, p, buffer.data(), section_starts);
       },
       true);
 }
 
+// NOTE: Host Thread
+static void CaptureRewindSnapshot(Core::System& system)
+{
+  if (NetPlay::IsNetPlayRunning() || AchievementManager::GetInstance().IsHardcoreModeActive())
+  {
+    s_rewind_capture_pending = false;
+    return;
+  }
+
+  std::vector<u8> buffer;
+  {
+    std::lock_guard lk(s_rewind_mutex);
+    buffer = std::move(s_rewind_spare_buffer);
+  }
+
+  // This is how long the CPU thread is paused for. Encoding happens on the rewind worker.
+  std::vector<size_t> section_starts;
+  const u64 start_us = Common::Timer::NowUs();
+  SaveToBuffer(system, buffer, &section_starts);
+  const u64 cpu_pause_us = Common::Timer::NowUs() - start_us;
+
+  const size_t budget_bytes =
+      static_cast<size_t>(Config::Get(Config::MAIN_REWIND_BUFFER_SIZE)) * 1024 * 1024;
+  s_rewind_thread.EmplaceItem(RewindSnapshot_args{std::move(buffer), std::move(section_starts),
+                                                  cpu_pause_us, budget_bytes});
+}
+
+void RewindOnNewField(Core::System& system)
+{
+  if (!Config::Get(Config::MAIN_REWIND_ENABLE))
+    return;
+
+  if (s_rewind_fields_until_capture > 0)
+  {
+    --s_rewind_fields_until_capture;
+    return;
+  }
+
+  // Skip this capture if the previous one hasn't been encoded yet.
+  if (s_rewind_capture_pending.exchange(true))
+    return;
+
+  s_rewind_fields_until_capture = Config::Get(Config::MAIN_REWIND_INTERVAL);
+  Core::QueueHostJob(CaptureRewindSnapshot);
+}
+
+void Rewind(Core::System& system)
+{
+  if (!Core::IsRunningOrStarting(system))
+    return;
+
+  s_rewind_thread.WaitForCompletion();
+
+  std::vector<u8> buffer;
+  {
+    std::lock_guard lk(s_rewind_mutex);
+    if (!s_rewind_buffer.Pop(&buffer))
+    {
+      OSD::AddMessage("No rewind snapshots are left");
+      return;
+    }
+  }
+
+  LoadFromBuffer(system, buffer);
+
+  // Without this, a capture right after the load would store the state that was just loaded, and
+  // rewinding again would load it a second time instead of going further back.
+  s_rewind_fields_until_capture = Config::Get(Config::MAIN_REWIND_INTERVAL);
+
+  std::lock_guard lk(s_rewind_mutex);
+  s_rewind_spare_buffer = std::move(buffer);
+}
+
+void SaveToBuffer(Core::System& system, std::vector<u8>& buffer)
+{
+  SaveToBuffer(system, buffer, nullptr);
+}
+
 namespace
 {
 struct SlotWithTimestamp
@@ -349,19 +497,119 @@ static void CompressBufferToFile(const u8* raw_buffer, u64 size, File::IOFile& f
   }
 }
 
-static void CreateExtendedHeader(StateExtendedHeader& extended_header, size_t uncompressed_size)
+// Calls func for every index in [0, count), spread across as many threads as there are cores.
+// The calling thread participates too. Returns false if any call to func returned false.
+template <typename Func>
+static bool ForEachChunkInParallel(u32 count, const Func& func)
+{
+  const u32 thread_count = std::clamp(std::thread::hardware_concurrency(), 1u, std::max(count, 1u));
+
+  std::atomic<u32> next_index = 0;
+  std::atomic<bool> success = true;
+  const auto worker = [&] {
+    for (u32 i = next_index++; i < count && success.load(std::memory_order_relaxed);
+         i = next_index++)
+    {
+      if (!func(i))
+        success = false;
+    }
+  };
+
+  std::vector<std::future<void>> futures;
+  futures.reserve(thread_count - 1);
+  for (u32 i = 1; i < thread_count; ++i)
+    futures.push_back(std::async(std::launch::async, worker));
+  worker();
+  for (std::future<void>& future : futures)
+    future.wait();
+
+  return success;
+}
+
+static std::vector<u8> CompressChunk(const u8* data, u32 size, CompressionType compression_type,
+                                     int compression_level)
+{
+  std::vector<u8> compressed;
+  if (compression_type == CompressionType::ChunkedZstd)
+  {
+    compressed.resize(ZSTD_compressBound(size));
+    const size_t compressed_len =
+        ZSTD_compress(compressed.data(), compressed.size(), data, size, compression_level);
+    if (ZSTD_isError(compressed_len))
+      return {};
+    compressed.resize(compressed_len);
+  }
+  else
+  {
+    compressed.resize(LZ4_compressBound(static_cast<int>(size)));
+    const char* src = reinterpret_cast<const char*>(data);
+    char* dst = reinterpret_cast<char*>(compressed.data());
+    const int dst_size = static_cast<int>(compressed.size());
+    const int compressed_len =
+        compression_level >= LZ4HC_CLEVEL_MIN ?
+            LZ4_compress_HC(src, dst, static_cast<int>(size), dst_size, compression_level) :
+            LZ4_compress_default(src, dst, static_cast<int>(size), dst_size);
+    if (compressed_len <= 0)
+      return {};
+    compressed.resize(compressed_len);
+  }
+
+  // Chunks that don't shrink are stored as is. The loader recognizes them by their size.
+  if (compressed.size() >= size)
+    compressed.assign(data, data + size);
+
+  return compressed;
+}
+
+static void CompressChunkedBufferToFile(const u8* raw_buffer, u64 size,
+                                        CompressionType compression_type, int compression_level,
+                                        File::IOFile& f)
+{
+  const u32 chunk_count = static_cast<u32>((size + CHUNKED_PAYLOAD_CHUNK_SIZE - 1) /
+                                           CHUNKED_PAYLOAD_CHUNK_SIZE);
+
+  std::vector<std::vector<u8>> chunks(chunk_count);
+  const bool success = ForEachChunkInParallel(chunk_count, [&](u32 i) {
+    const u64 offset = static_cast<u64>(i) * CHUNKED_PAYLOAD_CHUNK_SIZE;
+    const u32 chunk_size =
+        static_cast<u32>(std::min<u64>(CHUNKED_PAYLOAD_CHUNK_SIZE, size - offset));
+    chunks[i] = CompressChunk(raw_buffer + offset, chunk_size, compression_type, compression_level);
+    return !chunks[i].empty();
+  });
+
+  if (!success)
+  {
+    PanicAlertFmt("Internal compression error - savestate compression failed");
+    return;
+  }
+
+  const ChunkedPayloadHeader chunked_header{CHUNKED_PAYLOAD_CHUNK_SIZE, chunk_count};
+  f.WriteArray(&chunked_header, 1);
+
+  std::vector<u32> compressed_sizes;
+  compressed_sizes.reserve(chunk_count);
+  for (const std::vector<u8>& chunk : chunks)
+    compressed_sizes.push_back(static_cast<u32>(chunk.size()));
+  f.WriteArray(compressed_sizes.data(), compressed_sizes.size());
+
+  for (const std::vector<u8>& chunk : chunks)
+    f.WriteBytes(chunk.data(), chunk.size());
+}
+
+static void CreateExtendedHeader(StateExtendedHeader& extended_header, size_t uncompressed_size,
+                                 CompressionType compression_type)
 {
   StateExtendedBaseHeader& base_header = extended_header.base_header;
   base_header.header_version = EXTENDED_HEADER_VERSION;
-  base_header.compression_type =
-      s_use_compression ? CompressionType::LZ4 : CompressionType::Uncompressed;
+  base_header.compression_type = compression_type;
   base_header.payload_offset = COMPRESSED_DATA_OFFSET;
   base_header.uncompressed_size = uncompressed_size;
 
   // If more fields are added to StateExtendedHeader, set them here.
 }
 
-static void WriteHeadersToFile(size_t uncompressed_size, File::IOFile& f)
+static void WriteHeadersToFile(size_t uncompressed_size, CompressionType compression_type,
+                               File::IOFile& f)
 {
   StateHeader header{};
   SConfig::GetInstance().GetGameID().copy(header.legacy_header.game_id,
@@ -373,7 +621,7 @@ static void WriteHeadersToFile(size_t uncompressed_size, File::IOFile& f)
   header.version_header.version_string_length = static_cast<u32>(header.version_string.length());
 
   StateExtendedHeader extended_header{};
-  CreateExtendedHeader(extended_header, uncompressed_size);
+  CreateExtendedHeader(extended_header, uncompressed_size, compression_type);
 
   f.WriteArray(&header.legacy_header, 1);
   f.WriteArray(&header.version_header, 1);
@@ -407,12 +655,22 @@ static void CompressAndDumpState(Core::System& system, CompressAndDumpState_args
     return;
   }
 
-  WriteHeadersToFile(buffer_size, f);
+  WriteHeadersToFile(buffer_size, save_args.compression_type, f);
 
-  if (s_use_compression)
+  switch (save_args.compression_type)
+  {
+  case CompressionType::LZ4:
     CompressBufferToFile(buffer_data, buffer_size, f);
-  else
+    break;
+  case CompressionType::ChunkedLZ4:
+  case CompressionType::ChunkedZstd:
+    CompressChunkedBufferToFile(buffer_data, buffer_size, save_args.compression_type,
+                                save_args.compression_level, f);
+    break;
+  default:
     f.WriteBytes(buffer_data, buffer_size);
+    break;
+  }
 
   if (!f.IsGood())
     Core::DisplayMessage("Failed to write state file", 2000);
@@ -505,6 +763,8 @@ void SaveAs(Core::System& system, const std::string& filename, bool wait)
           CompressAndDumpState_args save_args;
           save_args.buffer_vector = std::move(current_buffer);
           save_args.filename = filename;
+          save_args.compression_type = GetCompressionTypeForSaving();
+          save_args.compression_level = Config::Get(Config::MAIN_SAVESTATE_COMPRESSION_LEVEL);
           if (wait)
           {
             sync_event = std::make_shared<Common::Event>();
@@ -722,6 +982,85 @@ static bool DecompressLZ4(std::vector<u8>& raw_buffer, u64 size, File::IOFile& f
   }
 }
 
+static bool DecompressChunked(std::vector<u8>& raw_buffer, u64 size,
+                              CompressionType compression_type, File::IOFile& f)
+{
+  ChunkedPayloadHeader chunked_header;
+  if (!f.ReadArray(&chunked_header, 1))
+  {
+    PanicAlertFmt("Could not read state data length");
+    return false;
+  }
+
+  const u32 chunk_size = chunked_header.chunk_size;
+  const u32 chunk_count = chunked_header.chunk_count;
+  if (chunk_size == 0 || chunk_size > LZ4_MAX_INPUT_SIZE ||
+      chunk_count != (size + chunk_size - 1) / chunk_size)
+  {
+    PanicAlertFmt("State header corrupted");
+    return false;
+  }
+
+  std::vector<u32> compressed_sizes(chunk_count);
+  if (!f.ReadArray(compressed_sizes.data(), chunk_count))
+  {
+    PanicAlertFmt("Could not read state data length");
+    return false;
+  }
+
+  std::vector<u64> compressed_offsets;
+  compressed_offsets.reserve(chunk_count);
+  u64 total_compressed_size = 0;
+  for (const u32 compressed_size : compressed_sizes)
+  {
+    compressed_offsets.push_back(total_compressed_size);
+    total_compressed_size += compressed_size;
+  }
+
+  if (total_compressed_size > f.GetSize() - f.Tell())
+  {
+    PanicAlertFmt("State header length corrupted");
+    return false;
+  }
+
+  std::vector<u8> compressed_data(total_compressed_size);
+  if (!f.ReadBytes(compressed_data.data(), compressed_data.size()))
+  {
+    PanicAlertFmt("Could not read state data");
+    return false;
+  }
+
+  raw_buffer.resize(size);
+  const bool success = ForEachChunkInParallel(chunk_count, [&](u32 i) {
+    const u64 raw_offset = static_cast<u64>(i) * chunk_size;
+    const u32 raw_size = static_cast<u32>(std::min<u64>(chunk_size, size - raw_offset));
+    const u8* src = compressed_data.data() + compressed_offsets[i];
+    const u32 src_size = compressed_sizes[i];
+    u8* dst = raw_buffer.data() + raw_offset;
+
+    if (src_size == raw_size)
+    {
+      std::copy_n(src, raw_size, dst);
+      return true;
+    }
+
+    if (compression_type == CompressionType::ChunkedZstd)
+      return ZSTD_decompress(dst, raw_size, src, src_size) == raw_size;
+
+    return LZ4_decompress_safe(reinterpret_cast<const char*>(src), reinterpret_cast<char*>(dst),
+                               static_cast<int>(src_size),
+                               static_cast<int>(raw_size)) == static_cast<int>(raw_size);
+  });
+
+  if (!success)
+  {
+    PanicAlertFmt("Internal compression error - savestate decompression failed");
+    return false;
+  }
+
+  return true;
+}
+
 static bool ValidateHeaders(const StateHeader& header)
 {
   bool success = true;
@@ -819,6 +1158,20 @@ static void LoadFileStateData(const std::string& filename, std::vector<u8>& ret_
 
     break;
   }
+  case CompressionType::ChunkedLZ4:
+  case CompressionType::ChunkedZstd:
+  {
+    const auto compression_type =
+        static_cast<CompressionType>(extended_header.base_header.compression_type);
+    Core::DisplayMessage("Decompressing State...", 500);
+    if (!DecompressChunked(buffer, extended_header.base_header.uncompressed_size, compression_type,
+                           f))
+    {
+      return;
+    }
+
+    break;
+  }
   case CompressionType::Uncompressed:
   {
     u64 header_len = sizeof(StateHeaderLegacy) + sizeof(StateHeaderVersion) +
@@ -953,11 +1306,36 @@ void Init(Core::System& system)
     if (args.state_write_done_event)
       args.state_write_done_event->Set();
   });
+
+  s_rewind_fields_until_capture = 0;
+  s_rewind_capture_pending = false;
+  s_rewind_thread.Reset("Rewind Worker", [](RewindSnapshot_args args) {
+    const size_t raw_bytes = args.buffer.size();
+
+    std::lock_guard lk(s_rewind_mutex);
+    s_rewind_buffer.SetBudget(args.budget_bytes);
+    s_rewind_spare_buffer =
+        s_rewind_buffer.Push(std::move(args.buffer), std::move(args.section_starts));
+    s_rewind_capture_pending = false;
+
+    INFO_LOG_FMT(CORE,
+                 "Rewind snapshot: {} bytes raw, {} bytes as delta, CPU thread paused for {} us. "
+                 "{} snapshots using {} bytes",
+                 raw_bytes, s_rewind_buffer.GetLastDeltaBytes(), args.cpu_pause_us,
+                 s_rewind_buffer.GetSnapshotCount(), s_rewind_buffer.GetUsedBytes());
+  });
 }
 
 void Shutdown()
 {
   s_save_thread.Shutdown();
+  s_rewind_thread.Shutdown();
+
+  {
+    std::lock_guard lk(s_rewind_mutex);
+    s_rewind_buffer.Clear();
+    std::vector<u8>().swap(s_rewind_spare_buffer);
+  }
 
   // swapping with an empty vector, rather than clear()ing
   // this gives a better guarantee to free the allocated memory right NOW (as opposed to, actually,
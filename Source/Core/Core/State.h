@@ -55,10 +55,24 @@ enum CompressionType : u16
 {
   Uncompressed = 0,
   LZ4 = 1,
+  // The payload is split into independently compressed chunks, which lets saving and loading
+  // spread the work across threads. See ChunkedPayloadHeader.
+  ChunkedLZ4 = 2,
+  ChunkedZstd = 3,
   // Add new compression types after this, as the compression type
   // is numerically stored in the state file.
 };
 
+// Selects how new savestates are compressed. Every CompressionType can be loaded regardless.
+enum class CompressionMethod
+{
+  None,
+  // Levels below LZ4HC_CLEVEL_MIN use the regular LZ4 compressor, higher levels use LZ4-HC.
+  LZ4,
+  // The level is passed on to zstd; 0 selects zstd's default level.
+  Zstd,
+};
+
 struct StateExtendedBaseHeader
 {
   u16 header_version;
@@ -72,6 +86,16 @@ static_assert(offsetof(StateExtendedBaseHeader, payload_offset) == 4);
 static_assert(offsetof(StateExtendedBaseHeader, uncompressed_size) == 8);
 static_assert(std::is_trivially_copyable_v<StateExtendedBaseHeader>);
 
+// Starts the payload of chunked compression types. It is followed by chunk_count u32 compressed
+// chunk sizes and then the chunks themselves. Every chunk except for the last one decompresses to
+// chunk_size bytes. A chunk whose compressed size equals its uncompressed size is stored as is.
+struct ChunkedPayloadHeader
+{
+  u32 chunk_size;
+  u32 chunk_count;
+};
+static_assert(std::is_trivially_copyable_v<ChunkedPayloadHeader>);
+
 struct StateExtendedHeader
 {
   StateExtendedBaseHeader base_header;
@@ -109,6 +133,12 @@ void LoadAs(Core::System& system, const std::string& filename);
 void SaveToBuffer(Core::System& system, std::vector<u8>& buffer);
 void LoadFromBuffer(Core::System& system, std::vector<u8>& buffer);
 
+// Called on the CPU thread at the start of every field. Schedules capturing a rewind snapshot when
+// rewind is enabled and one is due. Snapshots are delta encoded on a worker thread.
+void RewindOnNewField(Core::System& system);
+// Loads the most recent rewind snapshot and drops it, so every call goes further back in time.
+void Rewind(Core::System& system);
+
 void LoadLastSaved(Core::System& system, int i = 1);
 void SaveFirstSaved(Core::System& system);
 void UndoSaveState(Core::System& system);
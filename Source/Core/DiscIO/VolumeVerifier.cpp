@@ -10,6 +10,7 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <unordered_set>
 
 #include <mbedtls/md5.h>
@@ -358,20 +359,25 @@ RedumpVerifier::Result RedumpVerifier::Finish(const Hashes<std::vector<u8>>& has
 constexpr u64 DEFAULT_READ_SIZE = 0x20000;  // Arbitrary value
 
 VolumeVerifier::VolumeVerifier(const Volume& volume, bool redump_verification,
-                               Hashes<bool> hashes_to_calculate)
+                               Hashes<bool> hashes_to_calculate, unsigned int threads)
     : m_volume(volume), m_redump_verification(redump_verification),
       m_hashes_to_calculate(hashes_to_calculate),
       m_calculating_any_hash(hashes_to_calculate.crc32 || hashes_to_calculate.md5 ||
                              hashes_to_calculate.sha1),
+      m_check_thread_count(threads != 0 ? threads :
+                                          std::max(std::thread::hardware_concurrency(), 1u)),
       m_max_progress(volume.GetDataSize()), m_data_size_type(volume.GetDataSizeType())
 {
   if (!m_calculating_any_hash)
     m_redump_verification = false;
+
+  // Enough to keep every check thread busy while the hash threads catch up, plus m_data
+  m_max_chunks_in_flight = m_check_thread_count * 2 + 2;
 }
 
 VolumeVerifier::~VolumeVerifier()
 {
-  WaitForAsyncOperations();
+  ShutDownAsyncOperations();
 }
 
 Hashes<bool> VolumeVerifier::GetDefaultHashesToCalculate()
@@ -1056,58 +1062,145 @@ void VolumeVerifier::SetUpHashing()
   std::sort(m_groups.begin(), m_groups.end(),
             [](const GroupToVerify& a, const GroupToVerify& b) { return a.offset < b.offset; });
 
+  const auto run = [](std::function<void()> work) { work(); };
+
   if (m_hashes_to_calculate.crc32)
+  {
     m_crc32_context = Common::StartCRC32();
+    m_crc32_thread.Reset("CRC32 Hashing", run);
+  }
 
   if (m_hashes_to_calculate.md5)
   {
     mbedtls_md5_init(&m_md5_context);
     mbedtls_md5_starts_ret(&m_md5_context);
+    m_md5_thread.Reset("MD5 Hashing", run);
   }
 
   if (m_hashes_to_calculate.sha1)
   {
     m_sha1_context = Common::SHA1::CreateContext();
+    m_sha1_thread.Reset("SHA1 Hashing", run);
+  }
+
+  if (!m_groups.empty() || !m_content_offsets.empty())
+  {
+    m_check_threads.resize(m_check_thread_count);
+    for (auto& thread : m_check_threads)
+      thread = std::make_unique<Common::WorkQueueThread<std::function<void()>>>("Verifying", run);
   }
 }
 
-void VolumeVerifier::WaitForAsyncOperations() const
+void VolumeVerifier::WaitForAsyncOperations()
 {
-  if (m_crc32_future.valid())
-    m_crc32_future.wait();
-  if (m_md5_future.valid())
-    m_md5_future.wait();
-  if (m_sha1_future.valid())
-    m_sha1_future.wait();
-  if (m_content_future.valid())
-    m_content_future.wait();
-  if (m_group_future.valid())
-    m_group_future.wait();
+  m_crc32_thread.WaitForCompletion();
+  m_md5_thread.WaitForCompletion();
+  m_sha1_thread.WaitForCompletion();
+  for (auto& thread : m_check_threads)
+    thread->WaitForCompletion();
 }
 
-bool VolumeVerifier::ReadChunkAndWaitForAsyncOperations(u64 bytes_to_read)
+void VolumeVerifier::ShutDownAsyncOperations()
 {
-  std::vector<u8> data(bytes_to_read);
+  // Work that hasn't started yet is dropped, in case verification was cancelled
+  m_crc32_thread.Shutdown(true);
+  m_md5_thread.Shutdown(true);
+  m_sha1_thread.Shutdown(true);
+  for (auto& thread : m_check_threads)
+    thread->Shutdown(true);
+  m_check_threads.clear();
+
+  // The chunk's deleter uses m_chunks_mutex, so make sure it runs first
+  m_data.reset();
+}
+
+std::shared_ptr<std::vector<u8>> VolumeVerifier::AllocateChunk(size_t size)
+{
+  {
+    std::unique_lock lk(m_chunks_mutex);
+    m_chunks_cv.wait(lk, [this] { return m_chunks_in_flight < m_max_chunks_in_flight; });
+    ++m_chunks_in_flight;
+  }
+
+  // The chunk is freed once the reader and every worker thread that uses it are done with it
+  return std::shared_ptr<std::vector<u8>>(new std::vector<u8>(size), [this](std::vector<u8>* p) {
+    delete p;
+    {
+      std::lock_guard lk(m_chunks_mutex);
+      --m_chunks_in_flight;
+    }
+    m_chunks_cv.notify_one();
+  });
+}
+
+bool VolumeVerifier::ReadChunk(u64 bytes_to_read)
+{
+  std::shared_ptr<std::vector<u8>> data = AllocateChunk(bytes_to_read);
 
   const u64 bytes_to_copy = std::min(m_excess_bytes, bytes_to_read);
   if (bytes_to_copy > 0)
-    std::memcpy(data.data(), m_data.data() + m_data.size() - m_excess_bytes, bytes_to_copy);
+    std::memcpy(data->data(), m_data->data() + m_data->size() - m_excess_bytes, bytes_to_copy);
   bytes_to_read -= bytes_to_copy;
 
   if (bytes_to_read > 0)
   {
-    if (!m_volume.Read(m_progress + bytes_to_copy, bytes_to_read, data.data() + bytes_to_copy,
+    if (!m_volume.Read(m_progress + bytes_to_copy, bytes_to_read, data->data() + bytes_to_copy,
                        PARTITION_NONE))
     {
       return false;
     }
   }
 
-  WaitForAsyncOperations();
   m_data = std::move(data);
   return true;
 }
 
+void VolumeVerifier::PushCheck(std::function<void()> check)
+{
+  m_check_threads[m_next_check_thread]->Push(std::move(check));
+  m_next_check_thread = (m_next_check_thread + 1) % m_check_threads.size();
+}
+
+void VolumeVerifier::CheckGroup(const GroupToVerify& group, const u8* data)
+{
+  // CheckPartition has already loaded the key and H3 table of the partition, so calling
+  // CheckBlockIntegrity from several threads at once doesn't race on loading them.
+  u64 biggest_verified_offset = 0;
+  size_t block_errors = 0;
+  size_t unused_block_errors = 0;
+
+  u64 offset_in_group = 0;
+  for (u64 block_index = group.block_index_start; block_index < group.block_index_end;
+       ++block_index, offset_in_group += VolumeWii::BLOCK_TOTAL_SIZE)
+  {
+    const u64 block_offset = group.offset + offset_in_group;
+
+    if (data && m_volume.CheckBlockIntegrity(block_index, data + offset_in_group, group.partition))
+    {
+      biggest_verified_offset = block_offset + VolumeWii::BLOCK_TOTAL_SIZE;
+    }
+    else
+    {
+      if (m_scrubber.CanBlockBeScrubbed(block_offset))
+      {
+        WARN_LOG_FMT(DISCIO, "Integrity check failed for unused block at {:#x}", block_offset);
+        unused_block_errors++;
+      }
+      else
+      {
+        WARN_LOG_FMT(DISCIO, "Integrity check failed for block at {:#x}", block_offset);
+        block_errors++;
+      }
+    }
+  }
+
+  std::lock_guard lk(m_check_results_mutex);
+  m_biggest_verified_offset = std::max(m_biggest_verified_offset, biggest_verified_offset);
+  m_block_errors[group.partition] += block_errors;
+  if (unused_block_errors > 0)
+    m_unused_block_errors[group.partition] += unused_block_errors;
+}
+
 void VolumeVerifier::Process()
 {
   ASSERT(m_started);
@@ -1179,7 +1272,7 @@ void VolumeVerifier::Process()
   }
 
   const bool is_data_needed = m_calculating_any_hash || content_read || group_read;
-  const bool read_failed = is_data_needed && !ReadChunkAndWaitForAsyncOperations(bytes_to_read);
+  const bool read_failed = is_data_needed && !ReadChunk(bytes_to_read);
 
   if (read_failed)
   {
@@ -1196,33 +1289,34 @@ void VolumeVerifier::Process()
   {
     if (m_hashes_to_calculate.crc32)
     {
-      m_crc32_future = std::async(std::launch::async, [this, byte_increment] {
-        m_crc32_context = Common::UpdateCRC32(m_crc32_context, m_data.data(),
+      m_crc32_thread.Push([this, data = m_data, byte_increment] {
+        m_crc32_context = Common::UpdateCRC32(m_crc32_context, data->data(),
                                               static_cast<size_t>(byte_increment));
       });
     }
 
     if (m_hashes_to_calculate.md5)
     {
-      m_md5_future = std::async(std::launch::async, [this, byte_increment] {
-        mbedtls_md5_update_ret(&m_md5_context, m_data.data(), byte_increment);
+      m_md5_thread.Push([this, data = m_data, byte_increment] {
+        mbedtls_md5_update_ret(&m_md5_context, data->data(), byte_increment);
       });
     }
 
     if (m_hashes_to_calculate.sha1)
     {
-      m_sha1_future = std::async(std::launch::async, [this, byte_increment] {
-        m_sha1_context->Update(m_data.data(), byte_increment);
+      m_sha1_thread.Push([this, data = m_data, byte_increment] {
+        m_sha1_context->Update(data->data(), byte_increment);
       });
     }
   }
 
   if (content_read)
   {
-    m_content_future = std::async(std::launch::async, [this, read_failed, content] {
-      if (read_failed || !m_volume.CheckContentIntegrity(content, m_data, m_ticket))
+    PushCheck([this, data = m_data, read_failed, content] {
+      if (read_failed || !m_volume.CheckContentIntegrity(content, *data, m_ticket))
       {
-        AddProblem(Severity::High, Common::FmtFormatT("Content {0:08x} is corrupt.", content.id));
+        std::lock_guard lk(m_check_results_mutex);
+        m_corrupt_contents.emplace(content.index, content.id);
       }
     });
 
@@ -1231,35 +1325,8 @@ void VolumeVerifier::Process()
 
   if (group_read)
   {
-    m_group_future = std::async(std::launch::async, [this, read_failed,
-                                                     group_index = m_group_index] {
-      const GroupToVerify& group = m_groups[group_index];
-      u64 offset_in_group = 0;
-      for (u64 block_index = group.block_index_start; block_index < group.block_index_end;
-           ++block_index, offset_in_group += VolumeWii::BLOCK_TOTAL_SIZE)
-      {
-        const u64 block_offset = group.offset + offset_in_group;
-
-        if (!read_failed && m_volume.CheckBlockIntegrity(
-                                block_index, m_data.data() + offset_in_group, group.partition))
-        {
-          m_biggest_verified_offset =
-              std::max(m_biggest_verified_offset, block_offset + VolumeWii::BLOCK_TOTAL_SIZE);
-        }
-        else
-        {
-          if (m_scrubber.CanBlockBeScrubbed(block_offset))
-          {
-            WARN_LOG_FMT(DISCIO, "Integrity check failed for unused block at {:#x}", block_offset);
-            m_unused_block_errors[group.partition]++;
-          }
-          else
-          {
-            WARN_LOG_FMT(DISCIO, "Integrity check failed for block at {:#x}", block_offset);
-            m_block_errors[group.partition]++;
-          }
-        }
-      }
+    PushCheck([this, data = m_data, read_failed, group_index = m_group_index] {
+      CheckGroup(m_groups[group_index], read_failed ? nullptr : data->data());
     });
 
     m_group_index++;
@@ -1286,6 +1353,9 @@ void VolumeVerifier::Finish()
 
   WaitForAsyncOperations();
 
+  for (const auto& [index, id] : m_corrupt_contents)
+    AddProblem(Severity::High, Common::FmtFormatT("Content {0:08x} is corrupt.", id));
+
   if (m_calculating_any_hash)
   {
     if (m_hashes_to_calculate.crc32)
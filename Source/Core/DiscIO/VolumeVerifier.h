@@ -3,9 +3,12 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <functional>
 #include <future>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <vector>
@@ -14,6 +17,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/Crypto/SHA1.h"
+#include "Common/WorkQueueThread.h"
 #include "Core/IOS/ES/Formats.h"
 #include "DiscIO/DiscScrubber.h"
 #include "DiscIO/Volume.h"
@@ -29,6 +33,10 @@
 //
 // Start, Process and Finish may take some time to run.
 //
+// Process reads the data and hands it off to worker threads. Each hash is calculated on a thread of
+// its own, and Wii blocks and WAD contents are checked by a pool of threads. All of them share the
+// buffers that the data is read into. Finish waits for the worker threads.
+//
 // GetResult() can be called before the processing is finished, but the result will be incomplete.
 
 namespace DiscIO
@@ -124,7 +132,10 @@ public:
     RedumpVerifier::Result redump;
   };
 
-  VolumeVerifier(const Volume& volume, bool redump_verification, Hashes<bool> hashes_to_calculate);
+  // threads is the number of threads that check Wii blocks and WAD contents.
+  // 0 means one thread per CPU core.
+  VolumeVerifier(const Volume& volume, bool redump_verification, Hashes<bool> hashes_to_calculate,
+                 unsigned int threads = 0);
   ~VolumeVerifier();
 
   static Hashes<bool> GetDefaultHashesToCalculate();
@@ -156,8 +167,12 @@ private:
   void CheckMisc();
   void CheckSuperPaperMario();
   void SetUpHashing();
-  void WaitForAsyncOperations() const;
-  bool ReadChunkAndWaitForAsyncOperations(u64 bytes_to_read);
+  void WaitForAsyncOperations();
+  void ShutDownAsyncOperations();
+  std::shared_ptr<std::vector<u8>> AllocateChunk(size_t size);
+  bool ReadChunk(u64 bytes_to_read);
+  void PushCheck(std::function<void()> check);
+  void CheckGroup(const GroupToVerify& group, const u8* data);
 
   void AddProblem(Severity severity, std::string text);
 
@@ -179,12 +194,29 @@ private:
   std::unique_ptr<Common::SHA1::Context> m_sha1_context;
 
   u64 m_excess_bytes = 0;
-  std::vector<u8> m_data;
-  std::future<void> m_crc32_future;
-  std::future<void> m_md5_future;
-  std::future<void> m_sha1_future;
-  std::future<void> m_content_future;
-  std::future<void> m_group_future;
+
+  // Limits how many chunks of data have been read but not yet processed by all worker threads
+  std::mutex m_chunks_mutex;
+  std::condition_variable m_chunks_cv;
+  size_t m_chunks_in_flight = 0;
+  size_t m_max_chunks_in_flight = 0;
+
+  // The most recently read chunk
+  std::shared_ptr<const std::vector<u8>> m_data;
+
+  // Each hash is updated with the chunks in the order they were read
+  Common::WorkQueueThread<std::function<void()>> m_crc32_thread;
+  Common::WorkQueueThread<std::function<void()>> m_md5_thread;
+  Common::WorkQueueThread<std::function<void()>> m_sha1_thread;
+  // Groups and contents are independent of each other and get checked in parallel
+  std::vector<std::unique_ptr<Common::WorkQueueThread<std::function<void()>>>> m_check_threads;
+  size_t m_next_check_thread = 0;
+  unsigned int m_check_thread_count;
+
+  // Protects m_corrupt_contents, m_block_errors, m_unused_block_errors and
+  // m_biggest_verified_offset, which are written by the check threads
+  std::mutex m_check_results_mutex;
+  std::map<u16, u32> m_corrupt_contents;  // Content index to content ID
 
   DiscScrubber m_scrubber;
   IOS::ES::TicketReader m_ticket;
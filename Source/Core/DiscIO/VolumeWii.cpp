@@ -11,6 +11,7 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <thread>
 #include <utility>
@@ -512,71 +513,69 @@ bool VolumeWii::HashGroup(const std::array<u8, BLOCK_DATA_SIZE> in[BLOCKS_PER_GR
                           HashBlock out[BLOCKS_PER_GROUP],
                           const std::function<bool(size_t block)>& read_function)
 {
-  std::array<std::future<void>, BLOCKS_PER_GROUP> hash_futures;
+  // Each H1 hash covers the H0 hashes of 8 blocks, so the 8 subgroups of a group can be hashed
+  // independently of each other until the H2 hashes get copied. Hashing a subgroup on its own
+  // thread as soon as it has been read keeps the number of threads started per group low.
+  constexpr size_t BLOCKS_PER_SUBGROUP = 8;
+  constexpr size_t SUBGROUPS_PER_GROUP = BLOCKS_PER_GROUP / BLOCKS_PER_SUBGROUP;
+  std::array<std::future<void>, SUBGROUPS_PER_GROUP> hash_futures;
   bool success = true;
 
-  for (size_t i = 0; i < BLOCKS_PER_GROUP; ++i)
+  for (size_t i = 0; i < SUBGROUPS_PER_GROUP && success; ++i)
   {
-    if (read_function && success)
-      success = read_function(i);
+    const size_t h1_base = i * BLOCKS_PER_SUBGROUP;
 
-    hash_futures[i] = std::async(std::launch::async, [&in, &out, &hash_futures, success, i]() {
-      const size_t h1_base = Common::AlignDown(i, 8);
+    if (read_function)
+    {
+      for (size_t j = h1_base; j < h1_base + BLOCKS_PER_SUBGROUP && success; ++j)
+        success = read_function(j);
+      if (!success)
+        break;
+    }
 
-      if (success)
+    hash_futures[i] = std::async(std::launch::async, [&in, &out, h1_base, i]() {
+      for (size_t j = h1_base; j < h1_base + BLOCKS_PER_SUBGROUP; ++j)
       {
         // H0 hashes
-        for (size_t j = 0; j < 31; ++j)
-          out[i].h0[j] = Common::SHA1::CalculateDigest(in[i].data() + j * 0x400, 0x400);
+        Common::SHA1::CalculateDigests(in[j].data(), 0x400, out[j].h0.size(), out[j].h0.data());
 
         // H0 padding
-        out[i].padding_0 = {};
+        out[j].padding_0 = {};
 
         // H1 hash
-        out[h1_base].h1[i - h1_base] = Common::SHA1::CalculateDigest(out[i].h0);
+        out[h1_base].h1[j - h1_base] = Common::SHA1::CalculateDigest(out[j].h0);
       }
 
-      if (i % 8 == 7)
-      {
-        for (size_t j = 0; j < 7; ++j)
-          hash_futures[h1_base + j].get();
-
-        if (success)
-        {
-          // H1 padding
-          out[h1_base].padding_1 = {};
-
-          // H1 copies
-          for (size_t j = 1; j < 8; ++j)
-            out[h1_base + j].h1 = out[h1_base].h1;
-
-          // H2 hash
-          out[0].h2[h1_base / 8] = Common::SHA1::CalculateDigest(out[i].h1);
-        }
-
-        if (i == BLOCKS_PER_GROUP - 1)
-        {
-          for (size_t j = 0; j < 7; ++j)
-            hash_futures[j * 8 + 7].get();
+      // H1 padding
+      out[h1_base].padding_1 = {};
 
-          if (success)
-          {
-            // H2 padding
-            out[0].padding_2 = {};
+      // H1 copies
+      for (size_t j = 1; j < BLOCKS_PER_SUBGROUP; ++j)
+        out[h1_base + j].h1 = out[h1_base].h1;
 
-            // H2 copies
-            for (size_t j = 1; j < BLOCKS_PER_GROUP; ++j)
-              out[j].h2 = out[0].h2;
-          }
-        }
-      }
+      // H2 hash
+      out[0].h2[i] = Common::SHA1::CalculateDigest(out[h1_base].h1);
     });
   }
 
   // Wait for all the async tasks to finish
-  hash_futures.back().get();
+  for (std::future<void>& future : hash_futures)
+  {
+    if (future.valid())
+      future.get();
+  }
 
-  return success;
+  if (!success)
+    return false;
+
+  // H2 padding
+  out[0].padding_2 = {};
+
+  // H2 copies
+  for (size_t j = 1; j < BLOCKS_PER_GROUP; ++j)
+    out[j].h2 = out[0].h2;
+
+  return true;
 }
 
 bool VolumeWii::EncryptGroup(
@@ -611,10 +610,14 @@ bool VolumeWii::EncryptGroup(
   if (hash_exception_callback)
     hash_exception_callback(unencrypted_hashes.data());
 
-  const unsigned int threads =
-      std::min(BLOCKS_PER_GROUP, std::max<unsigned int>(1, std::thread::hardware_concurrency()));
+  // Each thread gets whole batches, so that the blocks can be interleaved.
+  constexpr size_t BATCH_SIZE = Common::AES::Context::BATCH_SIZE;
+  constexpr size_t BATCHES_PER_GROUP = BLOCKS_PER_GROUP / BATCH_SIZE;
+  static_assert(BLOCKS_PER_GROUP % BATCH_SIZE == 0);
+  const size_t threads =
+      std::min(BATCHES_PER_GROUP, std::max<size_t>(1, std::thread::hardware_concurrency()));
 
-  std::vector<std::future<void>> encryption_futures(threads);
+  std::vector<std::future<bool>> encryption_futures(threads);
 
   auto aes_context = Common::AES::CreateContextEncrypt(key.data());
 
@@ -623,24 +626,37 @@ bool VolumeWii::EncryptGroup(
     encryption_futures[i] = std::async(
         std::launch::async,
         [&unencrypted_data, &unencrypted_hashes, &aes_context, &out](size_t start, size_t end) {
+          // The blocks are independent of each other, so they are encrypted as batches. The data
+          // of each block uses part of its encrypted header as IV, so the headers go first.
+          std::array<Common::AES::Context::BatchItem, BLOCKS_PER_GROUP> items;
+          const std::span<Common::AES::Context::BatchItem> batch(items.data(), end - start);
+
           for (size_t j = start; j < end; ++j)
           {
-            u8* out_ptr = out->data() + j * BLOCK_TOTAL_SIZE;
-
-            aes_context->CryptIvZero(reinterpret_cast<u8*>(&unencrypted_hashes[j]), out_ptr,
-                                     BLOCK_HEADER_SIZE);
+            batch[j - start] = {nullptr, reinterpret_cast<const u8*>(&unencrypted_hashes[j]),
+                                out->data() + j * BLOCK_TOTAL_SIZE};
+          }
+          if (!aes_context->CryptBatch(batch, BLOCK_HEADER_SIZE))
+            return false;
 
-            aes_context->Crypt(out_ptr + 0x3D0, unencrypted_data[j].data(),
-                               out_ptr + BLOCK_HEADER_SIZE, BLOCK_DATA_SIZE);
+          for (size_t j = start; j < end; ++j)
+          {
+            u8* out_ptr = out->data() + j * BLOCK_TOTAL_SIZE;
+            batch[j - start] = {out_ptr + 0x3D0, unencrypted_data[j].data(),
+                                out_ptr + BLOCK_HEADER_SIZE};
           }
+          return aes_context->CryptBatch(batch, BLOCK_DATA_SIZE);
         },
-        i * BLOCKS_PER_GROUP / threads, (i + 1) * BLOCKS_PER_GROUP / threads);
+        i * BATCHES_PER_GROUP / threads * BATCH_SIZE,
+        (i + 1) * BATCHES_PER_GROUP / threads * BATCH_SIZE);
   }
 
-  for (std::future<void>& future : encryption_futures)
-    future.get();
+  // Wait for all of them before returning, as they write to out.
+  bool encrypted = true;
+  for (std::future<bool>& future : encryption_futures)
+    encrypted &= future.get();
 
-  return true;
+  return encrypted;
 }
 
 void VolumeWii::DecryptBlockHashes(const u8* in, HashBlock* out, Common::AES::Context* aes_context)
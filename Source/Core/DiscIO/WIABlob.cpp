@@ -11,6 +11,7 @@
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <thread>
 #include <type_traits>
 #include <utility>
 
@@ -85,7 +86,12 @@ WIARVZFileReader<RVZ>::WIARVZFileReader(File::IOFile file, const std::string& pa
 }
 
 template <bool RVZ>
-WIARVZFileReader<RVZ>::~WIARVZFileReader() = default;
+WIARVZFileReader<RVZ>::~WIARVZFileReader()
+{
+  // Don't finish decompressing groups that nobody is going to read.
+  for (auto& worker : m_read_ahead_workers)
+    worker->thread.Shutdown(true);
+}
 
 template <bool RVZ>
 bool WIARVZFileReader<RVZ>::Initialize(const std::string& path)
@@ -207,9 +213,9 @@ bool WIARVZFileReader<RVZ>::Initialize(const std::string& path)
   const u32 number_of_raw_data_entries = Common::swap32(m_header_2.number_of_raw_data_entries);
   m_raw_data_entries.resize(number_of_raw_data_entries);
   Chunk& raw_data_entries =
-      ReadCompressedData(Common::swap64(m_header_2.raw_data_entries_offset),
-                         Common::swap32(m_header_2.raw_data_entries_size),
-                         number_of_raw_data_entries * sizeof(RawDataEntry), m_compression_type);
+      ReadCompressedData({Common::swap64(m_header_2.raw_data_entries_offset),
+                          Common::swap32(m_header_2.raw_data_entries_size),
+                          number_of_raw_data_entries * sizeof(RawDataEntry), m_compression_type});
   if (!raw_data_entries.ReadAll(&m_raw_data_entries))
     return false;
 
@@ -224,9 +230,9 @@ bool WIARVZFileReader<RVZ>::Initialize(const std::string& path)
   const u32 number_of_group_entries = Common::swap32(m_header_2.number_of_group_entries);
   m_group_entries.resize(number_of_group_entries);
   Chunk& group_entries =
-      ReadCompressedData(Common::swap64(m_header_2.group_entries_offset),
-                         Common::swap32(m_header_2.group_entries_size),
-                         number_of_group_entries * sizeof(GroupEntry), m_compression_type);
+      ReadCompressedData({Common::swap64(m_header_2.group_entries_offset),
+                          Common::swap32(m_header_2.group_entries_size),
+                          number_of_group_entries * sizeof(GroupEntry), m_compression_type});
   if (!group_entries.ReadAll(&m_group_entries))
     return false;
 
@@ -507,38 +513,44 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
     if (total_group_index >= m_group_entries.size())
       return false;
 
-    const GroupEntry group = m_group_entries[total_group_index];
     const u64 group_offset_in_data = i * chunk_size;
     const u64 offset_in_group = *offset - group_offset_in_data - data_offset;
 
-    chunk_size = std::min(chunk_size, data_size - group_offset_in_data);
+    const ChunkParameters parameters = GetGroupChunkParameters(
+        total_group_index, std::min(chunk_size, data_size - group_offset_in_data), exception_lists,
+        group_offset_in_data);
 
-    const u64 bytes_to_read = std::min(chunk_size - offset_in_group, *size);
-    u32 group_data_size = Common::swap32(group.data_size);
+    const u64 bytes_to_read = std::min(parameters.decompressed_size - offset_in_group, *size);
 
-    WIARVZCompressionType compression_type = m_compression_type;
-    u32 rvz_packed_size = 0;
-    if constexpr (RVZ)
+    if (total_group_index != m_last_read_group_index)
     {
-      if ((group_data_size & 0x80000000) == 0)
-        compression_type = WIARVZCompressionType::None;
+      m_sequential_groups =
+          total_group_index == m_last_read_group_index + 1 ? m_sequential_groups + 1 : 1;
+      m_last_read_group_index = total_group_index;
 
-      group_data_size &= 0x7FFFFFFF;
-
-      rvz_packed_size = Common::swap32(group.rvz_packed_size);
+      if (m_sequential_groups >= SEQUENTIAL_GROUPS_FOR_READ_AHEAD)
+      {
+        std::vector<ChunkParameters> next_groups;
+        for (u64 j = i + 1; j <= i + READ_AHEAD_GROUPS && j < number_of_groups &&
+                            group_index + j < m_group_entries.size();
+             ++j)
+        {
+          const u64 next_group_offset_in_data = j * chunk_size;
+          next_groups.push_back(GetGroupChunkParameters(
+              group_index + j, std::min(chunk_size, data_size - next_group_offset_in_data),
+              exception_lists, next_group_offset_in_data));
+        }
+        UpdateReadAhead(next_groups);
+      }
     }
 
-    if (group_data_size == 0)
+    if (parameters.compressed_size == 0)
     {
       std::memset(*out_ptr, 0, bytes_to_read);
     }
     else
     {
-      const u64 group_offset_in_file = static_cast<u64>(Common::swap32(group.data_offset)) << 2;
-
-      Chunk& chunk =
-          ReadCompressedData(group_offset_in_file, group_data_size, chunk_size, compression_type,
-                             exception_lists, rvz_packed_size, group_offset_in_data);
+      Chunk& chunk = ReadCompressedData(parameters);
 
       if (!chunk.Read(offset_in_group, bytes_to_read, *out_ptr))
       {
@@ -565,25 +577,59 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
   return true;
 }
 
+template <bool RVZ>
+typename WIARVZFileReader<RVZ>::ChunkParameters
+WIARVZFileReader<RVZ>::GetGroupChunkParameters(u64 total_group_index, u64 decompressed_size,
+                                               u32 exception_lists, u64 data_offset) const
+{
+  const GroupEntry& group = m_group_entries[total_group_index];
+  u32 group_data_size = Common::swap32(group.data_size);
+
+  WIARVZCompressionType compression_type = m_compression_type;
+  u32 rvz_packed_size = 0;
+  if constexpr (RVZ)
+  {
+    if ((group_data_size & 0x80000000) == 0)
+      compression_type = WIARVZCompressionType::None;
+
+    group_data_size &= 0x7FFFFFFF;
+
+    rvz_packed_size = Common::swap32(group.rvz_packed_size);
+  }
+
+  const u64 group_offset_in_file = static_cast<u64>(Common::swap32(group.data_offset)) << 2;
+
+  return {group_offset_in_file, group_data_size, decompressed_size, compression_type,
+          exception_lists,      rvz_packed_size, data_offset};
+}
+
 template <bool RVZ>
 typename WIARVZFileReader<RVZ>::Chunk&
-WIARVZFileReader<RVZ>::ReadCompressedData(u64 offset_in_file, u64 compressed_size,
-                                          u64 decompressed_size,
-                                          WIARVZCompressionType compression_type,
-                                          u32 exception_lists, u32 rvz_packed_size, u64 data_offset)
+WIARVZFileReader<RVZ>::ReadCompressedData(const ChunkParameters& parameters)
 {
-  if (offset_in_file == m_cached_chunk_offset)
+  if (parameters.offset_in_file == m_cached_chunk_offset)
     return m_cached_chunk;
 
+  if (!TakeReadAheadChunk(parameters.offset_in_file))
+    m_cached_chunk = CreateChunk(&m_file, parameters);
+  m_cached_chunk_offset = parameters.offset_in_file;
+  return m_cached_chunk;
+}
+
+template <bool RVZ>
+typename WIARVZFileReader<RVZ>::Chunk
+WIARVZFileReader<RVZ>::CreateChunk(File::IOFile* file, const ChunkParameters& parameters) const
+{
   std::unique_ptr<Decompressor> decompressor;
-  switch (compression_type)
+  switch (parameters.compression_type)
   {
   case WIARVZCompressionType::None:
     decompressor = std::make_unique<NoneDecompressor>();
     break;
   case WIARVZCompressionType::Purge:
-    decompressor = std::make_unique<PurgeDecompressor>(rvz_packed_size == 0 ? decompressed_size :
-                                                                              rvz_packed_size);
+    decompressor = std::make_unique<PurgeDecompressor>(
+        parameters.rvz_packed_size == 0 ? parameters.decompressed_size :
+                                          parameters.rvz_packed_size);
     break;
   case WIARVZCompressionType::Bzip2:
     decompressor = std::make_unique<Bzip2Decompressor>();
@@ -601,13 +647,100 @@ WIARVZFileReader<RVZ>::ReadCompressedData(u64 offset_in_file, u64 compressed_siz
     break;
   }
 
-  const bool compressed_exception_lists = compression_type > WIARVZCompressionType::Purge;
+  const bool compressed_exception_lists =
+      parameters.compression_type > WIARVZCompressionType::Purge;
 
-  m_cached_chunk =
-      Chunk(&m_file, offset_in_file, compressed_size, decompressed_size, exception_lists,
-            compressed_exception_lists, rvz_packed_size, data_offset, std::move(decompressor));
-  m_cached_chunk_offset = offset_in_file;
-  return m_cached_chunk;
+  return Chunk(file, parameters.offset_in_file, parameters.compressed_size,
+               parameters.decompressed_size, parameters.exception_lists,
+               compressed_exception_lists, parameters.rvz_packed_size, parameters.data_offset,
+               std::move(decompressor));
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::UpdateReadAhead(const std::vector<ChunkParameters>& next_groups)
+{
+  std::lock_guard lk(m_read_ahead_mutex);
+
+  // Drop groups that were read ahead for an access pattern the game has stopped following.
+  std::erase_if(m_read_ahead_chunks, [&next_groups](const auto& pair) {
+    return std::none_of(next_groups.begin(), next_groups.end(), [&pair](const ChunkParameters& p) {
+      return p.offset_in_file == pair.first;
+    });
+  });
+
+  if (m_read_ahead_workers.empty())
+  {
+    // The workers are only created once they're needed, as many readers are only used for reading
+    // a few bytes (e.g. by the game list).
+    const u32 num_workers = std::clamp(std::thread::hardware_concurrency(), 1u, READ_AHEAD_GROUPS);
+    for (u32 i = 0; i < num_workers; ++i)
+    {
+      auto worker = std::make_unique<ReadAheadWorker>();
+      worker->file = m_file.Duplicate("rb");
+      worker->thread.Reset("WIA/RVZ Read-Ahead",
+                           [this, file = &worker->file](ReadAheadRequest request) {
+                             DecompressReadAheadChunk(file, std::move(request));
+                           });
+      m_read_ahead_workers.push_back(std::move(worker));
+    }
+  }
+
+  for (const ChunkParameters& parameters : next_groups)
+  {
+    if (parameters.compressed_size == 0 || parameters.offset_in_file == m_cached_chunk_offset ||
+        m_read_ahead_chunks.contains(parameters.offset_in_file))
+    {
+      continue;
+    }
+
+    auto chunk = std::make_shared<ReadAheadChunk>();
+    m_read_ahead_chunks.emplace(parameters.offset_in_file, chunk);
+    m_read_ahead_workers[m_next_read_ahead_worker]->thread.Push(
+        ReadAheadRequest{std::move(chunk), parameters});
+    m_next_read_ahead_worker = (m_next_read_ahead_worker + 1) % m_read_ahead_workers.size();
+  }
+}
+
+template <bool RVZ>
+bool WIARVZFileReader<RVZ>::TakeReadAheadChunk(u64 offset_in_file)
+{
+  std::shared_ptr<ReadAheadChunk> read_ahead_chunk;
+  {
+    std::unique_lock lk(m_read_ahead_mutex);
+    const auto it = m_read_ahead_chunks.find(offset_in_file);
+    if (it == m_read_ahead_chunks.end())
+      return false;
+
+    read_ahead_chunk = std::move(it->second);
+    m_read_ahead_chunks.erase(it);
+
+    // If a worker is still decompressing the group, waiting for it is faster than starting over.
+    m_read_ahead_cv.wait(lk, [&read_ahead_chunk] { return read_ahead_chunk->done; });
+  }
+
+  if (!read_ahead_chunk->success)
+    return false;
+
+  m_cached_chunk = std::move(read_ahead_chunk->chunk);
+  m_cached_chunk.SetFile(&m_file);
+  return true;
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::DecompressReadAheadChunk(File::IOFile* file, ReadAheadRequest request)
+{
+  // Skip groups that were dropped from m_read_ahead_chunks before we got to them.
+  if (request.chunk.use_count() == 1)
+    return;
+
+  Chunk chunk = CreateChunk(file, request.parameters);
+  const bool success = chunk.DecompressAll();
+
+  std::lock_guard lk(m_read_ahead_mutex);
+  request.chunk->chunk = std::move(chunk);
+  request.chunk->success = success;
+  request.chunk->done = true;
+  m_read_ahead_cv.notify_all();
 }
 
 template <bool RVZ>
@@ -657,10 +790,29 @@ bool WIARVZFileReader<RVZ>::Chunk::Read(u64 offset, u64 size, u8* out_ptr)
     return false;
   }
 
-  while (offset + size > GetOutBytesWrittenExcludingExceptions())
+  if (!DecompressUntil(offset + size))
+    return false;
+
+  std::memcpy(out_ptr, m_out.data.data() + offset + m_out_bytes_used_for_exceptions, size);
+  return true;
+}
+
+template <bool RVZ>
+bool WIARVZFileReader<RVZ>::Chunk::DecompressAll()
+{
+  if (!m_decompressor || !m_file)
+    return false;
+
+  return DecompressUntil(m_out.data.size() - m_out_bytes_allocated_for_exceptions);
+}
+
+template <bool RVZ>
+bool WIARVZFileReader<RVZ>::Chunk::DecompressUntil(u64 end_offset)
+{
+  while (end_offset > GetOutBytesWrittenExcludingExceptions())
   {
     u64 bytes_to_read;
-    if (offset + size == m_out.data.size())
+    if (end_offset == m_out.data.size())
     {
       // Read all the remaining data.
       bytes_to_read = m_in.data.size() - m_in.bytes_written;
@@ -673,7 +825,7 @@ bool WIARVZFileReader<RVZ>::Chunk::Read(u64 offset, u64 size, u8* out_ptr)
 
       // The compressed data is probably not much bigger than the decompressed data.
       // Add a few bytes for possible compression overhead and for any hash exceptions.
-      bytes_to_read = offset + size - GetOutBytesWrittenExcludingExceptions() + 0x100;
+      bytes_to_read = end_offset - GetOutBytesWrittenExcludingExceptions() + 0x100;
 
       // Align the access in an attempt to gain speed. But we don't actually know the
       // block size of the underlying storage device, so we just use the Wii block size.
@@ -753,7 +905,6 @@ bool WIARVZFileReader<RVZ>::Chunk::Read(u64 offset, u64 size, u8* out_ptr)
     }
   }
 
-  std::memcpy(out_ptr, m_out.data.data() + offset + m_out_bytes_used_for_exceptions, size);
   return true;
 }
 
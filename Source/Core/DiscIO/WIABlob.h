@@ -4,17 +4,20 @@
 #pragma once
 
 #include <array>
+#include <condition_variable>
 #include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/Crypto/SHA1.h"
 #include "Common/IOFile.h"
 #include "Common/Swap.h"
+#include "Common/WorkQueueThread.h"
 #include "DiscIO/Blob.h"
 #include "DiscIO/MultithreadedCompressor.h"
 #include "DiscIO/WIACompression.h"
@@ -184,6 +187,17 @@ private:
     }
   };
 
+  struct ChunkParameters
+  {
+    u64 offset_in_file;
+    u64 compressed_size;
+    u64 decompressed_size;
+    WIARVZCompressionType compression_type;
+    u32 exception_lists = 0;
+    u32 rvz_packed_size = 0;
+    u64 data_offset = 0;
+  };
+
   class Chunk
   {
   public:
@@ -193,6 +207,10 @@ private:
           u64 data_offset, std::unique_ptr<Decompressor> decompressor);
 
     bool Read(u64 offset, u64 size, u8* out_ptr);
+    bool DecompressAll();
+
+    // Changes the file that the remaining compressed data is read from.
+    void SetFile(File::IOFile* file) { m_file = file; }
 
     // This can only be called once at least one byte of data has been read
     void GetHashExceptions(std::vector<HashExceptionEntry>* exception_list,
@@ -205,6 +223,7 @@ private:
     }
 
   private:
+    bool DecompressUntil(u64 end_offset);
     bool Decompress();
     bool HandleExceptions(const u8* data, size_t bytes_allocated, size_t bytes_written,
                           size_t* bytes_used, bool align);
@@ -237,9 +256,32 @@ private:
   bool ReadFromGroups(u64* offset, u64* size, u8** out_ptr, u64 chunk_size, u32 sector_size,
                       u64 data_offset, u64 data_size, u32 group_index, u32 number_of_groups,
                       u32 exception_lists);
-  Chunk& ReadCompressedData(u64 offset_in_file, u64 compressed_size, u64 decompressed_size,
-                            WIARVZCompressionType compression_type, u32 exception_lists = 0,
-                            u32 rvz_packed_size = 0, u64 data_offset = 0);
+  ChunkParameters GetGroupChunkParameters(u64 total_group_index, u64 decompressed_size,
+                                          u32 exception_lists, u64 data_offset) const;
+  Chunk& ReadCompressedData(const ChunkParameters& parameters);
+  Chunk CreateChunk(File::IOFile* file, const ChunkParameters& parameters) const;
+
+  // Read-ahead of groups following a sequential access
+  struct ReadAheadChunk
+  {
+    Chunk chunk;
+    bool done = false;
+    bool success = false;
+  };
+  struct ReadAheadRequest
+  {
+    std::shared_ptr<ReadAheadChunk> chunk;
+    ChunkParameters parameters;
+  };
+  struct ReadAheadWorker
+  {
+    File::IOFile file;
+    Common::WorkQueueThread<ReadAheadRequest> thread;
+  };
+
+  void UpdateReadAhead(const std::vector<ChunkParameters>& next_groups);
+  bool TakeReadAheadChunk(u64 offset_in_file);
+  void DecompressReadAheadChunk(File::IOFile* file, ReadAheadRequest request);
 
   static bool ApplyHashExceptions(const std::vector<HashExceptionEntry>& exception_list,
                                   VolumeWii::HashBlock hash_blocks[VolumeWii::BLOCKS_PER_GROUP]);
@@ -382,6 +424,22 @@ private:
 
   std::map<u64, DataEntry> m_data_entries;
 
+  // Once this many consecutive groups have been read, the following groups are decompressed on
+  // worker threads ahead of time.
+  static constexpr u32 SEQUENTIAL_GROUPS_FOR_READ_AHEAD = 2;
+  static constexpr u32 READ_AHEAD_GROUPS = 4;
+
+  u64 m_last_read_group_index = std::numeric_limits<u64>::max();
+  u32 m_sequential_groups = 0;
+
+  // Groups that are being or have been decompressed ahead of time, indexed by their offset in the
+  // file. This holds at most READ_AHEAD_GROUPS entries, which are removed once they're used.
+  std::map<u64, std::shared_ptr<ReadAheadChunk>> m_read_ahead_chunks;
+  std::mutex m_read_ahead_mutex;
+  std::condition_variable m_read_ahead_cv;
+  std::vector<std::unique_ptr<ReadAheadWorker>> m_read_ahead_workers;
+  size_t m_next_read_ahead_worker = 0;
+
   // Perhaps we could set WIA_VERSION_WRITE_COMPATIBLE to 0.9, but WIA version 0.9 was never in
   // any official release of wit, and interim versions (either source or binaries) are hard to find.
   // Since we've been unable to check if we're write compatible with 0.9, we set it 1.0 to be safe.
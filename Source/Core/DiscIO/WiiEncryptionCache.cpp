@@ -3,6 +3,7 @@
 
 #include "DiscIO/WiiEncryptionCache.h"
 
+#include <algorithm>
 #include <array>
 #include <cstring>
 #include <limits>
@@ -26,20 +27,30 @@ WiiEncryptionCache::EncryptGroup(u64 offset, u64 partition_data_offset,
                                  u64 partition_data_decrypted_size, const Key& key,
                                  const HashExceptionCallback& hash_exception_callback)
 {
-  // Only allocate memory if this function actually ends up getting called
-  if (!m_cache)
-  {
-    m_cache = std::make_unique<std::array<u8, VolumeWii::GROUP_TOTAL_SIZE>>();
-    m_cached_offset = std::numeric_limits<u64>::max();
-  }
-
   ASSERT(offset % VolumeWii::GROUP_TOTAL_SIZE == 0);
   const u64 group_offset_in_partition =
       offset / VolumeWii::GROUP_TOTAL_SIZE * VolumeWii::GROUP_DATA_SIZE;
   const u64 group_offset_on_disc = partition_data_offset + offset;
 
-  if (m_cached_offset != group_offset_on_disc)
+  auto it = std::find_if(m_cache.begin(), m_cache.end(), [&](const CachedGroup& group) {
+    return group.offset == group_offset_on_disc;
+  });
+
+  if (it == m_cache.end())
   {
+    // Only allocate memory for as many groups as actually end up being used
+    if (m_cache.size() < CACHED_GROUPS)
+    {
+      m_cache.push_back({std::make_unique<std::array<u8, VolumeWii::GROUP_TOTAL_SIZE>>()});
+      it = m_cache.end() - 1;
+    }
+    else
+    {
+      it = std::min_element(m_cache.begin(), m_cache.end(), [](const auto& a, const auto& b) {
+        return a.last_used < b.last_used;
+      });
+    }
+
     std::function<void(VolumeWii::HashBlock * hash_blocks)> hash_exception_callback_2;
 
     if (hash_exception_callback)
@@ -52,17 +63,18 @@ WiiEncryptionCache::EncryptGroup(u64 offset, u64 partition_data_offset,
     }
 
     if (!VolumeWii::EncryptGroup(group_offset_in_partition, partition_data_offset,
-                                 partition_data_decrypted_size, key, m_blob, m_cache.get(),
+                                 partition_data_decrypted_size, key, m_blob, it->data.get(),
                                  hash_exception_callback_2))
     {
-      m_cached_offset = std::numeric_limits<u64>::max();  // Invalidate the cache
+      it->offset = std::numeric_limits<u64>::max();  // Invalidate the cache entry
       return nullptr;
     }
 
-    m_cached_offset = group_offset_on_disc;
+    it->offset = group_offset_on_disc;
   }
 
-  return m_cache.get();
+  it->last_used = ++m_use_counter;
+  return it->data.get();
 }
 
 bool WiiEncryptionCache::EncryptGroups(u64 offset, u64 size, u8* out_ptr, u64 partition_data_offset,
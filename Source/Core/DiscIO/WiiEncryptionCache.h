@@ -6,6 +6,7 @@
 #include <array>
 #include <limits>
 #include <memory>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "DiscIO/VolumeWii.h"
@@ -48,9 +49,20 @@ public:
                      const HashExceptionCallback& hash_exception_callback = {});
 
 private:
+  struct CachedGroup
+  {
+    std::unique_ptr<std::array<u8, VolumeWii::GROUP_TOTAL_SIZE>> data;
+    u64 offset = std::numeric_limits<u64>::max();
+    u64 last_used = 0;
+  };
+
+  // Random accesses often alternate between a few groups (for instance in different partitions),
+  // so several groups are kept, and the least recently used one is replaced.
+  static constexpr size_t CACHED_GROUPS = 8;
+
   BlobReader* m_blob;
-  std::unique_ptr<std::array<u8, VolumeWii::GROUP_TOTAL_SIZE>> m_cache;
-  u64 m_cached_offset = 0;
+  std::vector<CachedGroup> m_cache;
+  u64 m_use_counter = 0;
 };
 
 }  // namespace DiscIO
@@ -416,9 +416,10 @@ void AdvancedWidget::AddDescriptions()
       "any issue with this.<br><br><dolphin_emphasis>If unsure, leave this "
       "unchecked.</dolphin_emphasis>");
   static const char TR_BACKEND_MULTITHREADING_DESCRIPTION[] =
-      QT_TR_NOOP("Enables multithreaded command submission in backends where supported. Enabling "
-                 "this option may result in a performance improvement on systems with more than "
-                 "two CPU cores. Currently, this is limited to the Vulkan backend.<br><br>"
+      QT_TR_NOOP("Enables multithreaded command submission in backends where supported, and "
+                 "multithreaded rasterization in the Software Renderer. Enabling this option may "
+                 "result in a performance improvement on systems with more than two CPU cores. "
+                 "Currently, this is limited to the Vulkan and Software Renderer backends.<br><br>"
                  "<dolphin_emphasis>If unsure, leave this checked.</dolphin_emphasis>");
   static const char TR_PREFER_VS_FOR_POINT_LINE_EXPANSION_DESCRIPTION[] =
       QT_TR_NOOP("On backends that support both using the geometry shader and the vertex shader "
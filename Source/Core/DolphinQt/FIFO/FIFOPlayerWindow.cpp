@@ -310,9 +310,9 @@ void FIFOPlayerWindow::UpdateInfo()
 
     for (u32 i = 0; i < file->GetFrameCount(); ++i)
     {
-      fifo_bytes += file->GetFrame(i).fifoData.size();
-      for (const auto& mem_update : file->GetFrame(i).memoryUpdates)
-        mem_bytes += mem_update.data.size();
+      const auto [frame_fifo_bytes, frame_mem_bytes] = file->GetFrameDataSizes(i);
+      fifo_bytes += frame_fifo_bytes;
+      mem_bytes += frame_mem_bytes;
     }
 
     m_info_label->setText(tr("%1 FIFO bytes\n%2 memory bytes\n%3 frames")
@@ -0,0 +1,223 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/FifoBenchCommand.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <OptionParser.h>
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+#include <picojson.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
+#include "Common/FileUtil.h"
+#include "Common/Flag.h"
+#include "Common/ScopeGuard.h"
+#include "Common/WindowSystemInfo.h"
+#include "Core/Boot/Boot.h"
+#include "Core/BootManager.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/Core.h"
+#include "Core/FifoPlayer/FifoDataFile.h"
+#include "Core/FifoPlayer/FifoPlayer.h"
+#include "Core/System.h"
+#include "UICommon/UICommon.h"
+#include "VideoCommon/FrontendTimers.h"
+
+namespace DolphinTool
+{
+namespace
+{
+struct FrameTimes
+{
+  u64 wall_ns;
+  FrontendTimers::Totals frontend_ns;
+};
+
+picojson::object FrameTimesToJson(const FrameTimes& times)
+{
+  picojson::object object;
+  object["wall_us"] = picojson::value(times.wall_ns / 1000.0);
+  for (size_t i = 0; i < FrontendTimers::NUM_TIMERS; i++)
+  {
+    const char* name = FrontendTimers::GetName(static_cast<FrontendTimers::Timer>(i));
+    object[fmt::format("{}_us", name)] = picojson::value(times.frontend_ns[i] / 1000.0);
+  }
+  return object;
+}
+}  // namespace
+
+int FifoBenchCommand(const std::vector<std::string>& args)
+{
+  optparse::OptionParser parser;
+
+  parser.usage("usage: fifobench [options]...");
+
+  parser.add_option("-u", "--user")
+      .type("string")
+      .action("store")
+      .help("User folder path, required for temporary processing files. "
+            "Will be automatically created if this option is not set.")
+      .set_default("");
+
+  parser.add_option("-i", "--input")
+      .type("string")
+      .action("store")
+      .help("Path to the FIFO log (.dff) to play back.")
+      .metavar("FILE");
+
+  parser.add_option("-o", "--output")
+      .type("string")
+      .action("store")
+      .help("Optional. Path to write the JSON report to. Printed to stdout if not set.")
+      .metavar("FILE");
+
+  parser.add_option("-b", "--backend")
+      .type("string")
+      .action("store")
+      .help("Video backend to replay the log with [%choices]")
+      .choices({"Null", "Software Renderer"})
+      .set_default("Null");
+
+  parser.add_option("-l", "--loops")
+      .type("int")
+      .action("store")
+      .help("Number of times to play back the log. Default: 1")
+      .set_default(1);
+
+  const optparse::Values& options = parser.parse_args(args);
+
+  // Initialize the dolphin user directory, required for temporary processing files
+  // If this is not set, destructive file operations could occur due to path confusion
+  UICommon::SetUserDirectory(options["user"]);
+  UICommon::Init();
+  Common::ScopeGuard ui_common_guard([] { UICommon::Shutdown(); });
+
+  // Validate options
+  if (!options.is_set("input"))
+  {
+    fmt::print(std::cerr, "Error: No input set\n");
+    return EXIT_FAILURE;
+  }
+  const std::string& input_file_path = options["input"];
+
+  const int loops = static_cast<int>(options.get("loops"));
+  if (loops < 1)
+  {
+    fmt::print(std::cerr, "Error: The number of loops must be at least 1\n");
+    return EXIT_FAILURE;
+  }
+
+  // Only the header is read here. The frames are loaded by the FIFO player once the core boots.
+  if (!FifoDataFile::Load(input_file_path, true))
+  {
+    fmt::print(std::cerr, "Error: The input file is not a valid FIFO log\n");
+    return EXIT_FAILURE;
+  }
+
+  // Replay on the CPU thread as fast as possible, so that all GPU work for a frame is done by the
+  // time the FIFO player starts writing the next one.
+  const std::string& backend = options["backend"];
+  Config::SetCurrent(Config::MAIN_GFX_BACKEND, backend);
+  Config::SetCurrent(Config::MAIN_CPU_THREAD, false);
+  Config::SetCurrent(Config::MAIN_EMULATION_SPEED, 0.0f);
+  Config::SetCurrent(Config::MAIN_AUDIO_BACKEND, BACKEND_NULLSOUND);
+  Config::SetCurrent(Config::MAIN_FIFOPLAYER_LOOP_REPLAY, true);
+
+  auto& system = Core::System::GetInstance();
+
+  // The callback runs on the CPU thread right before each frame is written, so the time since the
+  // previous call belongs to the previous frame.
+  std::vector<FrameTimes> frames;
+  u32 frame_count = 0;
+  Common::Flag done;
+  auto last_frame_time = std::chrono::steady_clock::now();
+  system.GetFifoPlayer().SetFrameWrittenCallback([&] {
+    const auto now = std::chrono::steady_clock::now();
+    const FrontendTimers::Totals totals = FrontendTimers::TakeTotals();
+    if (done.IsSet())
+      return;
+
+    if (frame_count == 0)
+    {
+      // Setting up the initial state isn't part of any frame.
+      frame_count = system.GetFifoPlayer().GetFile()->GetFrameCount();
+      frames.reserve(u64(frame_count) * loops);
+    }
+    else
+    {
+      const auto wall = std::chrono::duration_cast<std::chrono::nanoseconds>(now - last_frame_time);
+      frames.push_back({static_cast<u64>(wall.count()), totals});
+      if (frames.size() == u64(frame_count) * loops)
+        done.Set();
+    }
+    last_frame_time = now;
+  });
+  Common::ScopeGuard callback_guard(
+      [&system] { system.GetFifoPlayer().SetFrameWrittenCallback(nullptr); });
+
+  FrontendTimers::SetEnabled(true);
+  Common::ScopeGuard timers_guard([] { FrontendTimers::SetEnabled(false); });
+
+  if (!BootManager::BootCore(system, BootParameters::GenerateFromFile(input_file_path),
+                             WindowSystemInfo{}))
+  {
+    fmt::print(std::cerr, "Error: Could not play back the FIFO log\n");
+    return EXIT_FAILURE;
+  }
+
+  while (!done.IsSet() && !Core::IsUninitialized(system))
+  {
+    Core::HostDispatchJobs(system);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  Core::Stop(system);
+  Core::Shutdown(system);
+
+  if (!done.IsSet())
+  {
+    fmt::print(std::cerr, "Error: Playback stopped after {} of {} frames\n", frames.size(),
+               u64(frame_count) * loops);
+    return EXIT_FAILURE;
+  }
+
+  FrameTimes totals{};
+  picojson::array json_frames;
+  for (const FrameTimes& frame : frames)
+  {
+    totals.wall_ns += frame.wall_ns;
+    for (size_t i = 0; i < FrontendTimers::NUM_TIMERS; i++)
+      totals.frontend_ns[i] += frame.frontend_ns[i];
+    json_frames.emplace_back(FrameTimesToJson(frame));
+  }
+
+  picojson::object json_root;
+  json_root["file"] = picojson::value(input_file_path);
+  json_root["backend"] = picojson::value(backend);
+  json_root["frame_count"] = picojson::value(static_cast<double>(frame_count));
+  json_root["loops"] = picojson::value(static_cast<double>(loops));
+  json_root["totals"] = picojson::value(FrameTimesToJson(totals));
+  json_root["frames"] = picojson::value(json_frames);
+  const std::string json = picojson::value(json_root).serialize(true);
+
+  if (!options.is_set("output"))
+  {
+    fmt::print(std::cout, "{}", json);
+  }
+  else if (!File::WriteStringToFile(options["output"], json))
+  {
+    fmt::print(std::cerr, "Error: Could not write the report\n");
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
+}  // namespace DolphinTool
@@ -3,6 +3,8 @@
 
 #include "DolphinTool/VerifyCommand.h"
 
+#include <algorithm>
+#include <chrono>
 #include <cstdlib>
 #include <string>
 #include <vector>
@@ -100,6 +102,13 @@ int VerifyCommand(const std::vector<std::string>& args)
             "[%choices]")
       .choices({"crc32", "md5", "sha1", "rchash"});
 
+  parser.add_option("-t", "--threads")
+      .type("int")
+      .action("store")
+      .help("Optional. Number of threads used for checking the integrity of Wii partition data "
+            "and WAD contents. Defaults to the number of CPU cores.")
+      .set_default(0);
+
   const optparse::Values& options = parser.parse_args(args);
 
   // Initialize the dolphin user directory, required for temporary processing files
@@ -115,6 +124,13 @@ int VerifyCommand(const std::vector<std::string>& args)
   }
   const std::string& input_file_path = options["input"];
 
+  const int threads = static_cast<int>(options.get("threads"));
+  if (threads < 0)
+  {
+    fmt::print(std::cerr, "Error: The number of threads must not be negative\n");
+    return EXIT_FAILURE;
+  }
+
   bool rc_hash_calculate = false;
   std::string rc_hash_result = "0";
 
@@ -156,13 +172,16 @@ int VerifyCommand(const std::vector<std::string>& args)
   }
 
   // Verify the volume
-  DiscIO::VolumeVerifier verifier(*volume, false, hashes_to_calculate);
+  DiscIO::VolumeVerifier verifier(*volume, false, hashes_to_calculate,
+                                  static_cast<unsigned int>(threads));
+  const auto start_time = std::chrono::steady_clock::now();
   verifier.Start();
   while (verifier.GetBytesProcessed() != verifier.GetTotalBytes())
   {
     verifier.Process();
   }
   verifier.Finish();
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_time;
   const DiscIO::VolumeVerifier::Result& result = verifier.GetResult();
 
 #ifdef USE_RETRO_ACHIEVEMENTS
@@ -177,6 +196,10 @@ int VerifyCommand(const std::vector<std::string>& args)
   if (!algorithm_is_set)
   {
     PrintFullReport(result);
+
+    const double megabytes = verifier.GetTotalBytes() / 1000000.0;
+    fmt::print(std::cout, "Verified {:.1f} MB in {:.1f} seconds ({:.1f} MB/s)\n", megabytes,
+               elapsed.count(), megabytes / std::max(elapsed.count(), 0.001));
   }
   else
   {
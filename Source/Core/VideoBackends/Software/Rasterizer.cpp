@@ -4,14 +4,23 @@
 #include "VideoBackends/Software/Rasterizer.h"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
 #include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 #include "Common/Assert.h"
+#include "Common/CPUDetect.h"
 #include "Common/CommonTypes.h"
+#include "Common/Thread.h"
 
 #include "VideoBackends/Software/EfbInterface.h"
 #include "VideoBackends/Software/NativeVertexFormat.h"
+#include "VideoBackends/Software/SWBoundingBox.h"
 #include "VideoBackends/Software/Tev.h"
 #include "VideoCommon/BPFunctions.h"
 #include "VideoCommon/BPMemory.h"
@@ -25,6 +34,16 @@ namespace Rasterizer
 {
 static constexpr int BLOCK_SIZE = 2;
 
+// When rasterizing on several threads, the EFB is split into horizontal bins of this many rows.
+// Every bin is drawn by a single thread, which draws the triangles overlapping it in the order they
+// were submitted. Bins don't share any pixels, so the result is identical to drawing on one thread.
+static constexpr int BIN_HEIGHT = 16;
+static constexpr int NUM_BINS = (EFB_HEIGHT + BIN_HEIGHT - 1) / BIN_HEIGHT;
+static_assert(BIN_HEIGHT % BLOCK_SIZE == 0);
+
+// Batches covering fewer pixels than this aren't worth waking up the worker threads for.
+static constexpr s64 MIN_PARALLEL_AREA = 64 * 64;
+
 struct SlopeContext
 {
   SlopeContext(const OutputVertexData* v0, const OutputVertexData* v1, const OutputVertexData* v2,
@@ -96,21 +115,101 @@ struct Slope
   }
 };
 
-static Slope ZSlope;
-static Slope WSlope;
-static Slope ColorSlopes[2][4];
-static Slope TexSlopes[8][3];
+// Everything needed to draw a triangle within a scissor rectangle. This is computed once, on the
+// thread submitting the triangle, and can then be used by any number of threads.
+struct TriangleSetup
+{
+  Slope ZSlope;
+  Slope WSlope;
+  Slope ColorSlopes[2][4];
+  Slope TexSlopes[8][3];
+
+  // Half-edge constants and deltas, in 28.4 fixed-point
+  s32 C1, C2, C3;
+  s32 DX12, DX23, DX31;
+  s32 DY12, DY23, DY31;
+
+  // Bounding rectangle, clipped to the scissor rectangle
+  s32 minx, maxx, miny, maxy;
+};
+
+// State used by a single rasterizing thread
+struct RasterContext
+{
+  Tev tev;
+  RasterBlock rasterBlock;
+  int rasterized_pixels = 0;
+};
 
-static Tev tev;
-static RasterBlock rasterBlock;
+static Slope ZSlope;
 
 static std::vector<BPFunctions::ScissorRect> scissors;
 
+// The thread submitting triangles uses s_contexts[0], and worker thread i uses s_contexts[i + 1].
+// Tev stores references to its own members, so the contexts must never be moved.
+static std::vector<std::unique_ptr<RasterContext>> s_contexts;
+
+// Triangles submitted since the last Flush(), only used when there are worker threads
+static std::vector<TriangleSetup> s_triangles;
+static std::array<std::vector<u32>, NUM_BINS> s_bins;
+static s64 s_batch_area = 0;
+
+static std::vector<std::thread> s_workers;
+static std::mutex s_workers_mutex;
+static std::condition_variable s_work_available;
+static std::condition_variable s_work_done;
+static u64 s_work_generation = 0;
+static u32 s_workers_busy = 0;
+static bool s_workers_exit = false;
+static std::atomic<int> s_next_bin;
+
+static void WorkerThread(u32 index);
+
 void Init()
+{
+  // Backend Multithreading is on by default, so the workers are used unless the user turns it off.
+  // Two cores are left for the CPU and GPU threads.
+  u32 num_workers = 0;
+  if (g_Config.bBackendMultithreading)
+    num_workers = static_cast<u32>(std::clamp(cpu_info.num_cores - 2, 0, 7));
+
+  Init(num_workers);
+}
+
+void Init(u32 num_workers)
 {
   // The other slopes are set each for each primitive drawn, but zfreeze means that the z slope
   // needs to be set to an (untested) default value.
   ZSlope = Slope();
+
+  s_contexts.clear();
+  for (u32 i = 0; i < num_workers + 1; i++)
+    s_contexts.push_back(std::make_unique<RasterContext>());
+
+  s_work_generation = 0;
+  s_workers_busy = 0;
+  s_workers_exit = false;
+  for (u32 i = 0; i < num_workers; i++)
+    s_workers.emplace_back(WorkerThread, i + 1);
+}
+
+void Shutdown()
+{
+  {
+    std::lock_guard lk(s_workers_mutex);
+    s_workers_exit = true;
+  }
+  s_work_available.notify_all();
+
+  for (std::thread& worker : s_workers)
+    worker.join();
+  s_workers.clear();
+
+  s_contexts.clear();
+  s_triangles.clear();
+  for (std::vector<u32>& bin : s_bins)
+    bin.clear();
+  s_batch_area = 0;
 }
 
 void ScissorChanged()
@@ -142,29 +241,33 @@ static inline int iround(float x)
 
 void SetTevKonstColors()
 {
-  tev.SetKonstColors();
+  for (const auto& context : s_contexts)
+    context->tev.SetKonstColors();
 }
 
-static void Draw(s32 x, s32 y, s32 xi, s32 yi)
+static void Draw(RasterContext& context, const TriangleSetup& tri, s32 x, s32 y, s32 xi, s32 yi)
 {
-  INCSTAT(g_stats.this_frame.rasterized_pixels);
+  Tev& tev = context.tev;
+  const RasterBlock& rasterBlock = context.rasterBlock;
 
-  s32 z = (s32)std::clamp<float>(ZSlope.GetValue(x, y), 0.0f, 16777215.0f);
+  context.rasterized_pixels++;
+
+  s32 z = (s32)std::clamp<float>(tri.ZSlope.GetValue(x, y), 0.0f, 16777215.0f);
 
   if (bpmem.GetEmulatedZ() == EmulatedZ::Early)
   {
     // TODO: Test if perf regs are incremented even if test is disabled
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_INPUT_ZCOMPLOC);
+    tev.counters.perf_quads[PQ_ZCOMP_INPUT_ZCOMPLOC]++;
     if (bpmem.zmode.testenable)
     {
       // early z
       if (!EfbInterface::ZCompare(x, y, z))
         return;
     }
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_OUTPUT_ZCOMPLOC);
+    tev.counters.perf_quads[PQ_ZCOMP_OUTPUT_ZCOMPLOC]++;
   }
 
-  RasterBlockPixel& pixel = rasterBlock.Pixel[xi][yi];
+  const RasterBlockPixel& pixel = rasterBlock.Pixel[xi][yi];
 
   tev.Position[0] = x;
   tev.Position[1] = y;
@@ -175,7 +278,7 @@ static void Draw(s32 x, s32 y, s32 xi, s32 yi)
   {
     for (int comp = 0; comp < 4; comp++)
     {
-      u16 color = (u16)ColorSlopes[i][comp].GetValue(x, y);
+      u16 color = (u16)tri.ColorSlopes[i][comp].GetValue(x, y);
 
       // clamp color value to 0
       u16 mask = ~(color >> 8);
@@ -207,7 +310,8 @@ static void Draw(s32 x, s32 y, s32 xi, s32 yi)
   tev.Draw();
 }
 
-static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoord)
+static inline void CalculateLOD(const RasterBlock& rasterBlock, s32* lodp, bool* linear,
+                                u32 texmap, u32 texcoord)
 {
   auto texUnit = bpmem.tex.GetUnit(texmap);
 
@@ -218,9 +322,9 @@ static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoor
 
   float sDelta, tDelta;
 
-  float* uv00 = rasterBlock.Pixel[0][0].Uv[texcoord];
-  float* uv10 = rasterBlock.Pixel[1][0].Uv[texcoord];
-  float* uv01 = rasterBlock.Pixel[0][1].Uv[texcoord];
+  const float* uv00 = rasterBlock.Pixel[0][0].Uv[texcoord];
+  const float* uv10 = rasterBlock.Pixel[1][0].Uv[texcoord];
+  const float* uv01 = rasterBlock.Pixel[0][1].Uv[texcoord];
 
   float dudx = fabsf(uv00[0] - uv10[0]);
   float dvdx = fabsf(uv00[1] - uv10[1]);
@@ -258,7 +362,7 @@ static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoor
   *lodp = lod;
 }
 
-static void BuildBlock(s32 blockX, s32 blockY)
+static void BuildBlock(RasterBlock& rasterBlock, const TriangleSetup& tri, s32 blockX, s32 blockY)
 {
   for (s32 yi = 0; yi < BLOCK_SIZE; yi++)
   {
@@ -269,19 +373,19 @@ static void BuildBlock(s32 blockX, s32 blockY)
       s32 x = xi + blockX;
       s32 y = yi + blockY;
 
-      float invW = 1.0f / WSlope.GetValue(x, y);
+      float invW = 1.0f / tri.WSlope.GetValue(x, y);
       pixel.InvW = invW;
 
       // tex coords
       for (unsigned int i = 0; i < bpmem.genMode.numtexgens; i++)
       {
         float projection = invW;
-        float q = TexSlopes[i][2].GetValue(x, y) * invW;
+        float q = tri.TexSlopes[i][2].GetValue(x, y) * invW;
         if (q != 0.0f)
           projection = invW / q;
 
-        pixel.Uv[i][0] = TexSlopes[i][0].GetValue(x, y) * projection;
-        pixel.Uv[i][1] = TexSlopes[i][1].GetValue(x, y) * projection;
+        pixel.Uv[i][0] = tri.TexSlopes[i][0].GetValue(x, y) * projection;
+        pixel.Uv[i][1] = tri.TexSlopes[i][1].GetValue(x, y) * projection;
       }
     }
   }
@@ -291,7 +395,8 @@ static void BuildBlock(s32 blockX, s32 blockY)
     u32 texmap = bpmem.tevindref.getTexMap(i);
     u32 texcoord = bpmem.tevindref.getTexCoord(i);
 
-    CalculateLOD(&rasterBlock.IndirectLod[i], &rasterBlock.IndirectLinear[i], texmap, texcoord);
+    CalculateLOD(rasterBlock, &rasterBlock.IndirectLod[i], &rasterBlock.IndirectLinear[i], texmap,
+                 texcoord);
   }
 
   for (unsigned int i = 0; i <= bpmem.genMode.numtevstages; i++)
@@ -303,7 +408,8 @@ static void BuildBlock(s32 blockX, s32 blockY)
       u32 texmap = order.getTexMap(stageOdd);
       u32 texcoord = order.getTexCoord(stageOdd);
 
-      CalculateLOD(&rasterBlock.TextureLod[i], &rasterBlock.TextureLinear[i], texmap, texcoord);
+      CalculateLOD(rasterBlock, &rasterBlock.TextureLod[i], &rasterBlock.TextureLinear[i], texmap,
+                   texcoord);
     }
   }
 }
@@ -320,14 +426,11 @@ void UpdateZSlope(const OutputVertexData* v0, const OutputVertexData* v1,
   }
 }
 
-static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
-                                  const OutputVertexData* v2,
-                                  const BPFunctions::ScissorRect& scissor)
+// Returns false if the triangle is entirely outside of the scissor rectangle.
+static bool SetupTriangle(const OutputVertexData* v0, const OutputVertexData* v1,
+                          const OutputVertexData* v2, const BPFunctions::ScissorRect& scissor,
+                          TriangleSetup* tri)
 {
-  // The zslope should be updated now, even if the triangle is rejected by the scissor test, as
-  // zfreeze depends on it
-  UpdateZSlope(v0, v1, v2, scissor.x_off, scissor.y_off);
-
   // adapted from http://devmaster.net/posts/6145/advanced-rasterization
 
   // 28.4 fixed-point coordinates. rounded to nearest and adjusted to match hardware output
@@ -349,15 +452,6 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
   const s32 DY23 = Y2 - Y3;
   const s32 DY31 = Y3 - Y1;
 
-  // Fixed-point deltas
-  const s32 FDX12 = DX12 * 16;
-  const s32 FDX23 = DX23 * 16;
-  const s32 FDX31 = DX31 * 16;
-
-  const s32 FDY12 = DY12 * 16;
-  const s32 FDY23 = DY23 * 16;
-  const s32 FDY31 = DY31 * 16;
-
   // Bounding rectangle
   s32 minx = (std::min(std::min(X1, X2), X3) + 0xF) >> 4;
   s32 maxx = (std::max(std::max(X1, X2), X3) + 0xF) >> 4;
@@ -376,28 +470,38 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
   maxy = std::min(maxy, scissor.rect.bottom);
 
   if (minx >= maxx || miny >= maxy)
-    return;
+    return false;
+
+  tri->minx = minx;
+  tri->maxx = maxx;
+  tri->miny = miny;
+  tri->maxy = maxy;
 
   // Set up the remaining slopes
   const SlopeContext ctx(v0, v1, v2, (X1 + 0xF) >> 4, (Y1 + 0xF) >> 4, scissor.x_off,
                          scissor.y_off);
 
+  tri->ZSlope = ZSlope;
+
   float w[3] = {1.0f / v0->projectedPosition.w, 1.0f / v1->projectedPosition.w,
                 1.0f / v2->projectedPosition.w};
-  WSlope = Slope(w[0], w[1], w[2], ctx);
+  tri->WSlope = Slope(w[0], w[1], w[2], ctx);
 
   for (unsigned int i = 0; i < bpmem.genMode.numcolchans; i++)
   {
     for (int comp = 0; comp < 4; comp++)
-      ColorSlopes[i][comp] = Slope(v0->color[i][comp], v1->color[i][comp], v2->color[i][comp], ctx);
+    {
+      tri->ColorSlopes[i][comp] =
+          Slope(v0->color[i][comp], v1->color[i][comp], v2->color[i][comp], ctx);
+    }
   }
 
   for (unsigned int i = 0; i < bpmem.genMode.numtexgens; i++)
   {
     for (int comp = 0; comp < 3; comp++)
     {
-      TexSlopes[i][comp] = Slope(v0->texCoords[i][comp] * w[0], v1->texCoords[i][comp] * w[1],
-                                 v2->texCoords[i][comp] * w[2], ctx);
+      tri->TexSlopes[i][comp] = Slope(v0->texCoords[i][comp] * w[0], v1->texCoords[i][comp] * w[1],
+                                      v2->texCoords[i][comp] * w[2], ctx);
     }
   }
 
@@ -414,12 +518,57 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
   if (DY31 < 0 || (DY31 == 0 && DX31 > 0))
     C3++;
 
+  tri->C1 = C1;
+  tri->C2 = C2;
+  tri->C3 = C3;
+  tri->DX12 = DX12;
+  tri->DX23 = DX23;
+  tri->DX31 = DX31;
+  tri->DY12 = DY12;
+  tri->DY23 = DY23;
+  tri->DY31 = DY31;
+
+  return true;
+}
+
+// Draws the part of the triangle between rows top (inclusive) and bottom (exclusive). top must be
+// a multiple of BLOCK_SIZE.
+static void RasterizeTriangle(RasterContext& context, const TriangleSetup& tri, s32 top,
+                              s32 bottom)
+{
+  const s32 minx = tri.minx;
+  const s32 maxx = tri.maxx;
+  const s32 miny = tri.miny;
+  const s32 maxy = tri.maxy;
+
+  const s32 C1 = tri.C1;
+  const s32 C2 = tri.C2;
+  const s32 C3 = tri.C3;
+
+  const s32 DX12 = tri.DX12;
+  const s32 DX23 = tri.DX23;
+  const s32 DX31 = tri.DX31;
+
+  const s32 DY12 = tri.DY12;
+  const s32 DY23 = tri.DY23;
+  const s32 DY31 = tri.DY31;
+
+  // Fixed-point deltas
+  const s32 FDX12 = DX12 * 16;
+  const s32 FDX23 = DX23 * 16;
+  const s32 FDX31 = DX31 * 16;
+
+  const s32 FDY12 = DY12 * 16;
+  const s32 FDY23 = DY23 * 16;
+  const s32 FDY31 = DY31 * 16;
+
   // Start in corner of 2x2 block
   s32 block_minx = minx & ~(BLOCK_SIZE - 1);
-  s32 block_miny = miny & ~(BLOCK_SIZE - 1);
+  s32 block_miny = std::max(miny & ~(BLOCK_SIZE - 1), top);
+  s32 block_maxy = std::min(maxy, bottom);
 
   // Loop through blocks
-  for (s32 y = block_miny & ~(BLOCK_SIZE - 1); y < maxy; y += BLOCK_SIZE)
+  for (s32 y = block_miny; y < block_maxy; y += BLOCK_SIZE)
   {
     for (s32 x = block_minx; x < maxx; x += BLOCK_SIZE)
     {
@@ -455,7 +604,7 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
       if (a == 0x0 || b == 0x0 || c == 0x0)
         continue;
 
-      BuildBlock(x, y);
+      BuildBlock(context.rasterBlock, tri, x, y);
 
       // Accept whole block when totally covered
       // We still need to check min/max x/y because of the scissor
@@ -465,7 +614,7 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
         {
           for (s32 ix = 0; ix < BLOCK_SIZE; ix++)
           {
-            Draw(x + ix, y + iy, ix, iy);
+            Draw(context, tri, x + ix, y + iy, ix, iy);
           }
         }
       }
@@ -488,7 +637,7 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
               // This check enforces the scissor rectangle, since it might not be aligned with the
               // blocks
               if (x + ix >= minx && x + ix < maxx && y + iy >= miny && y + iy < maxy)
-                Draw(x + ix, y + iy, ix, iy);
+                Draw(context, tri, x + ix, y + iy, ix, iy);
             }
 
             CX1 -= FDY12;
@@ -505,6 +654,36 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
   }
 }
 
+static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
+                                  const OutputVertexData* v2,
+                                  const BPFunctions::ScissorRect& scissor)
+{
+  // The zslope should be updated now, even if the triangle is rejected by the scissor test, as
+  // zfreeze depends on it
+  UpdateZSlope(v0, v1, v2, scissor.x_off, scissor.y_off);
+
+  if (s_workers.empty())
+  {
+    TriangleSetup tri;
+    if (SetupTriangle(v0, v1, v2, scissor, &tri))
+      RasterizeTriangle(*s_contexts[0], tri, 0, EFB_HEIGHT);
+    return;
+  }
+
+  TriangleSetup& tri = s_triangles.emplace_back();
+  if (!SetupTriangle(v0, v1, v2, scissor, &tri))
+  {
+    s_triangles.pop_back();
+    return;
+  }
+
+  const u32 index = static_cast<u32>(s_triangles.size() - 1);
+  for (s32 bin = tri.miny / BIN_HEIGHT; bin <= (tri.maxy - 1) / BIN_HEIGHT; bin++)
+    s_bins[bin].push_back(index);
+
+  s_batch_area += static_cast<s64>(tri.maxx - tri.minx) * (tri.maxy - tri.miny);
+}
+
 void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
                            const OutputVertexData* v2)
 {
@@ -513,4 +692,100 @@ void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v
   for (const auto& scissor : scissors)
     DrawTriangleFrontFace(v0, v1, v2, scissor);
 }
+
+static void RasterizeBins(RasterContext& context)
+{
+  for (int bin = s_next_bin++; bin < NUM_BINS; bin = s_next_bin++)
+  {
+    const s32 top = bin * BIN_HEIGHT;
+    const s32 bottom = std::min(top + BIN_HEIGHT, static_cast<s32>(EFB_HEIGHT));
+    for (const u32 index : s_bins[bin])
+      RasterizeTriangle(context, s_triangles[index], top, bottom);
+  }
+}
+
+static void WorkerThread(u32 index)
+{
+  Common::SetCurrentThreadName("SW Rasterizer");
+
+  RasterContext& context = *s_contexts[index];
+  u64 generation = 0;
+  while (true)
+  {
+    {
+      std::unique_lock lk(s_workers_mutex);
+      s_work_available.wait(lk, [&] { return s_workers_exit || s_work_generation != generation; });
+      if (s_workers_exit)
+        return;
+      generation = s_work_generation;
+    }
+
+    RasterizeBins(context);
+
+    {
+      std::lock_guard lk(s_workers_mutex);
+      if (--s_workers_busy == 0)
+        s_work_done.notify_one();
+    }
+  }
+}
+
+void Flush()
+{
+  if (!s_triangles.empty())
+  {
+    s_next_bin = 0;
+    if (s_batch_area < MIN_PARALLEL_AREA)
+    {
+      RasterizeBins(*s_contexts[0]);
+    }
+    else
+    {
+      {
+        std::lock_guard lk(s_workers_mutex);
+        s_work_generation++;
+        s_workers_busy = static_cast<u32>(s_workers.size());
+      }
+      s_work_available.notify_all();
+
+      RasterizeBins(*s_contexts[0]);
+
+      std::unique_lock lk(s_workers_mutex);
+      s_work_done.wait(lk, [] { return s_workers_busy == 0; });
+    }
+
+    s_triangles.clear();
+    for (std::vector<u32>& bin : s_bins)
+      bin.clear();
+    s_batch_area = 0;
+  }
+
+  // Only the EFB is written to while drawing, everything else is applied here. Adding up the
+  // counters is order-independent, so this gives the same result no matter how the pixels were
+  // split between threads.
+  for (const auto& context : s_contexts)
+  {
+    Tev::Counters& counters = context->tev.counters;
+
+    ADDSTAT(g_stats.this_frame.rasterized_pixels, context->rasterized_pixels);
+    ADDSTAT(g_stats.this_frame.tev_pixels_in, counters.pixels_in);
+    ADDSTAT(g_stats.this_frame.tev_pixels_out, counters.pixels_out);
+
+    for (int i = 0; i < PQ_NUM_MEMBERS; i++)
+    {
+      if (counters.perf_quads[i] != 0)
+        EfbInterface::IncPerfCounterQuadCount(static_cast<PerfQueryType>(i),
+                                              counters.perf_quads[i]);
+    }
+
+    if (counters.bbox_left <= counters.bbox_right)
+    {
+      BBoxManager::Update(counters.bbox_left, counters.bbox_right, counters.bbox_top,
+                          counters.bbox_bottom);
+    }
+
+    context->rasterized_pixels = 0;
+    counters = {};
+  }
+}
 }  // namespace Rasterizer
@@ -10,12 +10,18 @@ struct OutputVertexData;
 namespace Rasterizer
 {
 void Init();
+// Exposed for testing; Init() picks the number of worker threads from the config.
+void Init(u32 num_workers);
+void Shutdown();
 void ScissorChanged();
 
 void UpdateZSlope(const OutputVertexData* v0, const OutputVertexData* v1,
                   const OutputVertexData* v2, s32 x_off, s32 y_off);
 void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
                            const OutputVertexData* v2);
+// Waits until all triangles submitted so far have been drawn to the EFB, and updates the
+// statistics, performance counters and bounding box accordingly.
+void Flush();
 
 void SetTevKonstColors();
 
@@ -71,7 +71,7 @@ void VideoSoftware::InitBackendInfo(const WindowSystemInfo& wsi)
   g_Config.backend_info.bSupportsDualSourceBlend = true;
   g_Config.backend_info.bSupportsEarlyZ = true;
   g_Config.backend_info.bSupportsPrimitiveRestart = false;
-  g_Config.backend_info.bSupportsMultithreading = false;
+  g_Config.backend_info.bSupportsMultithreading = true;
   g_Config.backend_info.bSupportsComputeShaders = false;
   g_Config.backend_info.bSupportsGPUTextureDecoding = false;
   g_Config.backend_info.bSupportsST3CTextures = false;
@@ -114,6 +114,7 @@ bool VideoSoftware::Initialize(const WindowSystemInfo& wsi)
 
 void VideoSoftware::Shutdown()
 {
+  Rasterizer::Shutdown();
   ShutdownShared();
 }
 }  // namespace SW
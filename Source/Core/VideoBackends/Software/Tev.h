@@ -5,8 +5,10 @@
 
 #include <array>
 
+#include "Common/CommonTypes.h"
 #include "Common/EnumMap.h"
 #include "VideoCommon/BPMemory.h"
+#include "VideoCommon/PerfQueryBase.h"
 
 class Tev
 {
@@ -221,6 +223,23 @@ public:
   s32 TextureLod[16]{};
   bool TextureLinear[16]{};
 
+  // Draw() doesn't modify any global state other than the EFB, so that several instances can draw
+  // different parts of the EFB at the same time. Everything else it would update is accumulated
+  // here instead, and applied by the rasterizer once a batch has been drawn.
+  struct Counters
+  {
+    int pixels_in = 0;
+    int pixels_out = 0;
+    std::array<u32, PQ_NUM_MEMBERS> perf_quads{};
+
+    // Bounding box of the drawn pixels, empty if bbox_left > bbox_right
+    u16 bbox_left = 0xffff;
+    u16 bbox_right = 0;
+    u16 bbox_top = 0xffff;
+    u16 bbox_bottom = 0;
+  };
+  Counters counters;
+
   enum
   {
     ALP_C,
@@ -0,0 +1,284 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/DecodedTextureDiskCache.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
+#include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
+#include "Common/ScopeGuard.h"
+
+namespace VideoCommon
+{
+constexpr u32 CACHE_FILE_MAGIC = 0x43545844;  // DXTC
+// Increment this whenever the texture decoders change their output.
+constexpr u32 CACHE_FILE_VERSION = 1;
+
+struct FileHeader
+{
+  u32 magic;
+  u32 version;
+  // Incremented every time the cache is opened, used to find the least recently used entries.
+  u64 session;
+};
+
+DecodedTextureDiskCache::DecodedTextureDiskCache() = default;
+
+DecodedTextureDiskCache::~DecodedTextureDiskCache()
+{
+  Close();
+}
+
+bool DecodedTextureDiskCache::Open(const std::string& filename, u64 size_budget)
+{
+  Close();
+
+  FileHeader header{};
+  const bool valid = m_file.Open(filename, "r+b") && m_file.ReadBytes(&header, sizeof(header)) &&
+                     header.magic == CACHE_FILE_MAGIC && header.version == CACHE_FILE_VERSION;
+  if (!valid)
+  {
+    // Start over if the file doesn't exist, is corrupted or was written by another version.
+    header = {CACHE_FILE_MAGIC, CACHE_FILE_VERSION, 0};
+    if (!m_file.Open(filename, "w+b") || !m_file.WriteBytes(&header, sizeof(header)))
+    {
+      ERROR_LOG_FMT(VIDEO, "Failed to create decoded texture cache '{}'", filename);
+      m_file.Close();
+      return false;
+    }
+  }
+
+  m_size_budget = size_budget;
+  m_session = header.session + 1;
+  header.session = m_session;
+  if (!m_file.Seek(0, File::SeekOrigin::Begin) || !m_file.WriteBytes(&header, sizeof(header)) ||
+      !ReadIndex())
+  {
+    ERROR_LOG_FMT(VIDEO, "Failed to read decoded texture cache '{}'", filename);
+    Close();
+    return false;
+  }
+
+  // Leave some room for new entries, so that this doesn't have to be done every session.
+  if (m_file_size > m_size_budget && !Compact(filename, m_size_budget / 4 * 3))
+  {
+    ERROR_LOG_FMT(VIDEO, "Failed to compact decoded texture cache '{}'", filename);
+    Close();
+    return false;
+  }
+
+  if (!m_read_file.Open(filename, "rb"))
+  {
+    ERROR_LOG_FMT(VIDEO, "Failed to open decoded texture cache '{}' for reading", filename);
+    Close();
+    return false;
+  }
+
+  INFO_LOG_FMT(VIDEO, "Loaded {} cached decoded textures ({} bytes) from {}", m_entries.size(),
+               m_file_size, filename);
+
+  m_write_thread.Reset("Texture Disk Cache",
+                       [this](PendingWrite write) { WriteEntry(std::move(write)); });
+  return true;
+}
+
+void DecodedTextureDiskCache::Close()
+{
+  m_write_thread.Shutdown();
+
+  std::vector<u64> used_offsets;
+  {
+    std::lock_guard lk(m_lock);
+    used_offsets = std::move(m_used_offsets);
+  }
+  for (const u64 offset : used_offsets)
+  {
+    if (!m_file.Seek(offset + offsetof(EntryHeader, last_used), File::SeekOrigin::Begin) ||
+        !m_file.WriteBytes(&m_session, sizeof(m_session)))
+    {
+      m_file.ClearError();
+    }
+  }
+
+  {
+    std::lock_guard read_lk(m_read_lock);
+    m_read_file.Close();
+  }
+  m_file.Close();
+
+  std::lock_guard lk(m_lock);
+  m_entries.clear();
+  m_pending_keys.clear();
+  m_used_offsets.clear();
+  m_file_size = 0;
+  m_pending_size = 0;
+}
+
+bool DecodedTextureDiskCache::ReadIndex()
+{
+  m_entries.clear();
+
+  const u64 file_size = m_file.GetSize();
+  u64 offset = sizeof(FileHeader);
+  while (offset < file_size)
+  {
+    EntryHeader header;
+    if (!m_file.Seek(offset, File::SeekOrigin::Begin) ||
+        !m_file.ReadBytes(&header, sizeof(header)) ||
+        header.size > file_size - offset - sizeof(header))
+    {
+      // A write was interrupted, drop the partial entry.
+      WARN_LOG_FMT(VIDEO, "Truncating decoded texture cache at offset {}", offset);
+      m_file.ClearError();
+      if (!m_file.Resize(offset))
+        return false;
+      break;
+    }
+
+    m_entries[header.key] = {offset, header.size, header.last_used};
+    offset += sizeof(header) + header.size;
+  }
+
+  m_file_size = offset;
+  return true;
+}
+
+bool DecodedTextureDiskCache::Compact(const std::string& filename, u64 target_size)
+{
+  std::vector<std::pair<Key, Entry>> entries(m_entries.begin(), m_entries.end());
+  std::sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) {
+    return a.second.last_used > b.second.last_used;
+  });
+
+  const std::string temp_filename = filename + ".tmp";
+  File::IOFile temp_file(temp_filename, "wb");
+  Common::ScopeGuard remove_temp_file{[&] {
+    temp_file.Close();
+    File::Delete(temp_filename, File::IfAbsentBehavior::NoConsoleWarning);
+  }};
+  const FileHeader header{CACHE_FILE_MAGIC, CACHE_FILE_VERSION, m_session};
+  if (!temp_file.WriteBytes(&header, sizeof(header)))
+    return false;
+
+  u64 size = sizeof(header);
+  std::vector<u8> buffer;
+  for (const auto& [key, entry] : entries)
+  {
+    const u64 entry_size = sizeof(EntryHeader) + entry.size;
+    if (size + entry_size > target_size)
+      break;
+
+    buffer.resize(entry_size);
+    if (!m_file.Seek(entry.offset, File::SeekOrigin::Begin) ||
+        !m_file.ReadBytes(buffer.data(), buffer.size()) ||
+        !temp_file.WriteBytes(buffer.data(), buffer.size()))
+    {
+      return false;
+    }
+    size += entry_size;
+  }
+
+  INFO_LOG_FMT(VIDEO, "Compacted decoded texture cache from {} to {} bytes", m_file_size, size);
+
+  temp_file.Close();
+  m_file.Close();
+  if (!File::Rename(temp_filename, filename))
+    return false;
+  remove_temp_file.Dismiss();
+
+  if (!m_file.Open(filename, "r+b"))
+    return false;
+
+  return ReadIndex();
+}
+
+bool DecodedTextureDiskCache::Read(const Key& key, std::span<u8> dst)
+{
+  u64 offset;
+  {
+    std::lock_guard lk(m_lock);
+    const auto iter = m_entries.find(key);
+    if (iter == m_entries.end() || iter->second.size != dst.size())
+      return false;
+    offset = iter->second.offset;
+  }
+
+  bool success;
+  {
+    std::lock_guard read_lk(m_read_lock);
+    success = m_read_file.Seek(offset + sizeof(EntryHeader), File::SeekOrigin::Begin) &&
+              m_read_file.ReadBytes(dst.data(), dst.size());
+    if (!success)
+      m_read_file.ClearError();
+  }
+
+  std::lock_guard lk(m_lock);
+  const auto iter = m_entries.find(key);
+  if (iter == m_entries.end())
+    return false;
+
+  Entry& entry = iter->second;
+  if (!success)
+  {
+    ERROR_LOG_FMT(VIDEO, "Failed to read decoded texture at offset {}", entry.offset);
+    m_entries.erase(iter);
+    return false;
+  }
+
+  if (entry.last_used != m_session)
+  {
+    entry.last_used = m_session;
+    m_used_offsets.push_back(entry.offset);
+  }
+
+  return true;
+}
+
+void DecodedTextureDiskCache::Write(const Key& key, std::span<const u8> data)
+{
+  {
+    std::lock_guard lk(m_lock);
+    if (!m_file.IsOpen() || m_entries.contains(key) || m_pending_keys.contains(key))
+      return;
+
+    const u64 entry_size = sizeof(EntryHeader) + data.size();
+    if (m_file_size + m_pending_size + entry_size > m_size_budget)
+      return;
+    m_pending_size += entry_size;
+    m_pending_keys.insert(key);
+  }
+
+  m_write_thread.Push(PendingWrite{key, std::vector<u8>(data.begin(), data.end())});
+}
+
+void DecodedTextureDiskCache::WriteEntry(PendingWrite write)
+{
+  const EntryHeader header{write.key, m_session, write.data.size()};
+  const u64 entry_size = sizeof(header) + header.size;
+
+  // Only this thread appends to the file, so m_file_size can't change while writing. The entry
+  // has to be flushed before it's added to the index, as lookups use a separate handle.
+  const u64 offset = m_file_size;
+  const bool success = m_file.Seek(offset, File::SeekOrigin::Begin) &&
+                       m_file.WriteBytes(&header, sizeof(header)) &&
+                       m_file.WriteBytes(write.data.data(), write.data.size()) && m_file.Flush();
+  if (!success)
+  {
+    ERROR_LOG_FMT(VIDEO, "Failed to write decoded texture at offset {}", offset);
+    m_file.ClearError();
+    m_file.Resize(offset);
+  }
+
+  std::lock_guard lk(m_lock);
+  m_pending_size -= entry_size;
+  m_pending_keys.erase(header.key);
+  if (!success)
+    return;
+
+  m_entries[header.key] = {offset, header.size, header.last_used};
+  m_file_size += entry_size;
+}
+}  // namespace VideoCommon
@@ -0,0 +1,106 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/IOFile.h"
+#include "Common/WorkQueueThread.h"
+
+namespace VideoCommon
+{
+// Persistent cache of textures decoded on the CPU, so that they don't have to be decoded again in
+// later sessions. Entries are keyed by a hash of everything the decoded data depends on and are
+// appended to a single file per game. Only the index is read when the cache is opened; the data of
+// an entry is read from the file when it is looked up.
+//
+// Once the file has grown past its size budget no more entries are added, and the least recently
+// used entries are dropped the next time the cache is opened.
+class DecodedTextureDiskCache
+{
+public:
+  struct Key
+  {
+    u64 low = 0;
+    u64 high = 0;
+
+    bool operator==(const Key&) const = default;
+  };
+
+  DecodedTextureDiskCache();
+  ~DecodedTextureDiskCache();
+
+  bool Open(const std::string& filename, u64 size_budget);
+  void Close();
+  bool IsOpen() const { return m_file.IsOpen(); }
+
+  // Copies the data stored for the given key to dst. Returns false if there is no entry with
+  // exactly dst.size() bytes of data.
+  bool Read(const Key& key, std::span<u8> dst);
+
+  // Adds an entry. The data is copied and written to the file on a worker thread.
+  void Write(const Key& key, std::span<const u8> data);
+
+private:
+  struct EntryHeader
+  {
+    Key key;
+    u64 last_used;
+    u64 size;
+  };
+
+  struct Entry
+  {
+    u64 offset;  // Offset of the entry header in the file.
+    u64 size;
+    u64 last_used;
+  };
+
+  struct KeyHash
+  {
+    size_t operator()(const Key& key) const { return static_cast<size_t>(key.low); }
+  };
+
+  struct PendingWrite
+  {
+    Key key;
+    std::vector<u8> data;
+  };
+
+  bool ReadIndex();
+  bool Compact(const std::string& filename, u64 target_size);
+  void WriteEntry(PendingWrite write);
+
+  // Only used by the writer thread once the cache is open, except for IsOpen.
+  File::IOFile m_file;
+  u64 m_size_budget = 0;
+  u64 m_session = 0;
+
+  // A separate handle for lookups, so that they never wait for a write to finish.
+  std::mutex m_read_lock;
+  File::IOFile m_read_file;
+
+  // Protects the index. File I/O is never done while holding it.
+  std::mutex m_lock;
+  std::unordered_map<Key, Entry, KeyHash> m_entries;
+  // Keys queued for writing, so that an entry isn't written twice if it's added again before the
+  // writer thread gets to it.
+  std::unordered_set<Key, KeyHash> m_pending_keys;
+  // Offsets of entries used this session, whose last_used is updated when the cache is closed.
+  std::vector<u64> m_used_offsets;
+  u64 m_file_size = 0;
+  // Bytes queued for writing but not yet written, so that the budget isn't overshot by a burst of
+  // writes.
+  u64 m_pending_size = 0;
+
+  Common::WorkQueueThread<PendingWrite> m_write_thread;
+};
+}  // namespace VideoCommon
@@ -0,0 +1,49 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/FrontendTimers.h"
+
+namespace FrontendTimers
+{
+std::atomic<bool> g_enabled = false;
+
+// Shader compilation can happen on worker threads, so every timer is atomic.
+static std::array<std::atomic<u64>, NUM_TIMERS> s_totals;
+
+void SetEnabled(bool enabled)
+{
+  g_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void AddTime(Timer timer, u64 nanoseconds)
+{
+  s_totals[static_cast<size_t>(timer)].fetch_add(nanoseconds, std::memory_order_relaxed);
+}
+
+Totals TakeTotals()
+{
+  Totals totals;
+  for (size_t i = 0; i < NUM_TIMERS; i++)
+    totals[i] = s_totals[i].exchange(0, std::memory_order_relaxed);
+  return totals;
+}
+
+const char* GetName(Timer timer)
+{
+  switch (timer)
+  {
+  case Timer::OpcodeDecoding:
+    return "opcode_decoding";
+  case Timer::VertexLoading:
+    return "vertex_loading";
+  case Timer::VertexManagerFlush:
+    return "vertex_manager_flush";
+  case Timer::TextureCache:
+    return "texture_cache";
+  case Timer::ShaderGeneration:
+    return "shader_generation";
+  default:
+    return "unknown";
+  }
+}
+}  // namespace FrontendTimers
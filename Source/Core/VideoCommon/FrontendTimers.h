@@ -0,0 +1,80 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+
+#include "Common/CommonTypes.h"
+
+// Measures the time spent in the main parts of the GPU frontend, for benchmarking tools. Timing is
+// disabled by default, in which case a ScopedTimer costs a single relaxed atomic load.
+//
+// Timers are inclusive and may nest. For example, a flush triggered while decoding opcodes counts
+// towards both OpcodeDecoding and VertexManagerFlush.
+namespace FrontendTimers
+{
+enum class Timer
+{
+  OpcodeDecoding,
+  VertexLoading,
+  VertexManagerFlush,
+  TextureCache,
+  ShaderGeneration,
+  NumTimers
+};
+
+constexpr size_t NUM_TIMERS = static_cast<size_t>(Timer::NumTimers);
+
+// Nanoseconds spent in each timer
+using Totals = std::array<u64, NUM_TIMERS>;
+
+extern std::atomic<bool> g_enabled;
+
+void SetEnabled(bool enabled);
+inline bool IsEnabled()
+{
+  return g_enabled.load(std::memory_order_relaxed);
+}
+
+void AddTime(Timer timer, u64 nanoseconds);
+
+// Returns the time accumulated since the last call, and resets it.
+Totals TakeTotals();
+
+// A short snake_case name, suitable as a key in machine-readable output.
+const char* GetName(Timer timer);
+
+class ScopedTimer
+{
+public:
+  // Does nothing if active is false, e.g. for work done on behalf of the CPU thread.
+  explicit ScopedTimer(Timer timer, bool active = true)
+      : m_timer(timer), m_enabled(active && IsEnabled())
+  {
+    if (m_enabled)
+      m_start = Clock::now();
+  }
+  ~ScopedTimer()
+  {
+    if (m_enabled)
+    {
+      const auto elapsed = Clock::now() - m_start;
+      AddTime(m_timer, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+  }
+
+  ScopedTimer(const ScopedTimer&) = delete;
+  ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  Timer m_timer;
+  bool m_enabled;
+  Clock::time_point m_start;
+};
+}  // namespace FrontendTimers
@@ -0,0 +1,176 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstring>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+
+namespace VideoCommon
+{
+// The pipeline UIDs a game has used, saved so that their pipelines can be compiled before they are
+// needed in later sessions. The UIDs are stored in the order they were first used in a .uidcache
+// file. The frame each of them was first used in is stored in a separate trace file, one for each
+// UID, so that UID caches written before the trace existed stay valid.
+template <typename SerializedUid>
+class PipelineUIDCacheFile
+{
+public:
+  static_assert(std::is_trivially_copyable_v<SerializedUid>);
+
+  // Frame number for UIDs whose first use wasn't recorded.
+  static constexpr u32 UNKNOWN_FIRST_USE_FRAME = 0xFFFFFFFF;
+
+  struct Entry
+  {
+    SerializedUid uid;
+    u32 first_use_frame;
+  };
+
+  // Returns the UIDs saved by previous sessions and opens the files for appending. If the files
+  // are missing, corrupted or don't match each other, they are rewritten with the UIDs that could
+  // be read, so that those are never lost.
+  std::vector<Entry> Open(const std::string& uid_filename, const std::string& trace_filename,
+                          u32 uid_version)
+  {
+    Close();
+
+    const std::vector<u32> first_use_frames = ReadTrace(trace_filename);
+
+    std::vector<Entry> entries;
+    bool uid_file_valid = false;
+    if (m_uid_file.Open(uid_filename, "rb+"))
+    {
+      u32 magic;
+      u32 version;
+      if (m_uid_file.ReadBytes(&magic, sizeof(magic)) &&
+          m_uid_file.ReadBytes(&version, sizeof(version)) && magic == UID_FILE_MAGIC &&
+          version == uid_version)
+      {
+        // If the size doesn't match, the file is corrupted or a write was interrupted. The UIDs
+        // which were written completely are kept.
+        const u64 file_size = m_uid_file.GetSize();
+        const size_t uid_count =
+            static_cast<size_t>((file_size - HEADER_SIZE) / sizeof(SerializedUid));
+        uid_file_valid = file_size == HEADER_SIZE + uid_count * sizeof(SerializedUid);
+
+        for (size_t i = 0; i < uid_count; ++i)
+        {
+          SerializedUid uid;
+          if (!m_uid_file.ReadBytes(&uid, sizeof(uid)))
+          {
+            uid_file_valid = false;
+            break;
+          }
+
+          // Duplicates are dropped by rewriting the file.
+          if (!m_recorded_uids.insert(uid).second)
+          {
+            uid_file_valid = false;
+            continue;
+          }
+          entries.push_back({uid, i < first_use_frames.size() ? first_use_frames[i] :
+                                                                UNKNOWN_FIRST_USE_FRAME});
+        }
+
+        // New frames are only appended if the trace lines up with the UIDs.
+        uid_file_valid = uid_file_valid && first_use_frames.size() == uid_count &&
+                         m_uid_file.Seek(0, File::SeekOrigin::End) &&
+                         m_trace_file.Open(trace_filename, "ab");
+      }
+    }
+
+    if (!uid_file_valid)
+    {
+      m_uid_file.Close();
+      m_trace_file.Close();
+      if (m_uid_file.Open(uid_filename, "wb") && m_trace_file.Open(trace_filename, "wb") &&
+          m_uid_file.WriteBytes(&UID_FILE_MAGIC, sizeof(UID_FILE_MAGIC)) &&
+          m_uid_file.WriteBytes(&uid_version, sizeof(uid_version)) &&
+          m_trace_file.WriteBytes(&TRACE_FILE_MAGIC, sizeof(TRACE_FILE_MAGIC)) &&
+          m_trace_file.WriteBytes(&TRACE_FILE_VERSION, sizeof(TRACE_FILE_VERSION)))
+      {
+        for (size_t i = 0; i < entries.size() && IsOpen(); ++i)
+          Write(entries[i].uid, entries[i].first_use_frame);
+      }
+      else
+      {
+        WARN_LOG_FMT(VIDEO, "Failed to create pipeline UID cache {}", uid_filename);
+        Close();
+      }
+    }
+
+    return entries;
+  }
+
+  void Close()
+  {
+    m_uid_file.Close();
+    m_trace_file.Close();
+    m_recorded_uids.clear();
+  }
+
+  bool IsOpen() const { return m_uid_file.IsOpen(); }
+
+  // Appends a UID unless it has already been saved.
+  void Append(const SerializedUid& uid, u32 first_use_frame)
+  {
+    if (IsOpen() && m_recorded_uids.insert(uid).second)
+      Write(uid, first_use_frame);
+  }
+
+private:
+  static constexpr u32 UID_FILE_MAGIC = 0x44495550;    // PUID
+  static constexpr u32 TRACE_FILE_MAGIC = 0x43525450;  // PTRC
+  static constexpr u32 TRACE_FILE_VERSION = 1;
+  static constexpr u64 HEADER_SIZE = sizeof(u32) + sizeof(u32);
+
+  struct UidLess
+  {
+    bool operator()(const SerializedUid& a, const SerializedUid& b) const
+    {
+      return std::memcmp(&a, &b, sizeof(SerializedUid)) < 0;
+    }
+  };
+
+  static std::vector<u32> ReadTrace(const std::string& filename)
+  {
+    File::IOFile file(filename, "rb");
+    u32 magic;
+    u32 version;
+    const u64 file_size = file.GetSize();
+    if (file_size < HEADER_SIZE || !file.ReadBytes(&magic, sizeof(magic)) ||
+        !file.ReadBytes(&version, sizeof(version)) || magic != TRACE_FILE_MAGIC ||
+        version != TRACE_FILE_VERSION)
+    {
+      return {};
+    }
+
+    std::vector<u32> frames(static_cast<size_t>((file_size - HEADER_SIZE) / sizeof(u32)));
+    if (!file.ReadArray(frames.data(), frames.size()))
+      return {};
+    return frames;
+  }
+
+  void Write(const SerializedUid& uid, u32 first_use_frame)
+  {
+    if (!m_uid_file.WriteBytes(&uid, sizeof(uid)) ||
+        !m_trace_file.WriteBytes(&first_use_frame, sizeof(first_use_frame)))
+    {
+      WARN_LOG_FMT(VIDEO, "Writing pipeline UID to cache failed, closing file.");
+      Close();
+    }
+  }
+
+  File::IOFile m_uid_file;
+  File::IOFile m_trace_file;
+  std::set<SerializedUid, UidLess> m_recorded_uids;
+};
+}  // namespace VideoCommon
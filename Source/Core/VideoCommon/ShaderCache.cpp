@@ -3,6 +3,8 @@
 
 #include "VideoCommon/ShaderCache.h"
 
+#include <algorithm>
+
 #include <fmt/format.h>
 
 #include "Common/Assert.h"
@@ -15,6 +17,7 @@
 #include "VideoCommon/DriverDetails.h"
 #include "VideoCommon/FramebufferManager.h"
 #include "VideoCommon/FramebufferShaderGen.h"
+#include "VideoCommon/FrontendTimers.h"
 #include "VideoCommon/Present.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexLoaderManager.h"
@@ -46,8 +49,12 @@ bool ShaderCache::Initialize()
     return false;
 
   m_async_shader_compiler = g_gfx->CreateAsyncShaderCompiler();
-  m_frame_end_handler = AfterFrameEvent::Register([this](Core::System&) { RetrieveAsyncShaders(); },
-                                                  "RetrieveAsyncShaders");
+  m_frame_end_handler = AfterFrameEvent::Register(
+      [this](Core::System&) {
+        RetrieveAsyncShaders();
+        ++m_frame_count;
+      },
+      "RetrieveAsyncShaders");
   return true;
 }
 
@@ -125,8 +132,8 @@ const AbstractPipeline* ShaderCache::GetPipelineForUid(const GXPipelineUid& uid)
   std::optional<AbstractPipelineConfig> pipeline_config = GetGXPipelineConfig(uid);
   if (pipeline_config)
     pipeline = g_gfx->CreatePipeline(*pipeline_config);
-  if (g_ActiveConfig.bShaderCache && !exists_in_cache)
-    AppendGXPipelineUID(uid);
+  if (!exists_in_cache)
+    RecordGXPipelineUID(uid);
   return InsertGXPipeline(uid, std::move(pipeline));
 }
 
@@ -142,7 +149,7 @@ std::optional<const AbstractPipeline*> ShaderCache::GetPipelineForUidAsync(const
       return {};
   }
 
-  AppendGXPipelineUID(uid);
+  RecordGXPipelineUID(uid);
   QueuePipelineCompile(uid, COMPILE_PRIORITY_ONDEMAND_PIPELINE);
   return {};
 }
@@ -417,11 +424,26 @@ void ShaderCache::ClearCaches()
 
 void ShaderCache::CompileMissingPipelines()
 {
-  // Queue all uids with a null pipeline for compilation.
+  const auto get_priority = [](u32 first_use_frame) {
+    return COMPILE_PRIORITY_SHADERCACHE_PIPELINE +
+           std::min(first_use_frame,
+                    UNKNOWN_FIRST_USE_FRAME - COMPILE_PRIORITY_SHADERCACHE_PIPELINE);
+  };
+
+  // Queue all uids with a null pipeline for compilation, in the order the game first used them.
+  // Items with the same priority are compiled in the order they were queued.
+  for (const PipelineFirstUse& first_use : m_gx_pipeline_trace)
+  {
+    const auto it = m_gx_pipeline_cache.find(*first_use.uid);
+    if (it == m_gx_pipeline_cache.end())
+      continue;
+    if (!it->second.first && !it->second.second)
+      QueuePipelineCompile(it->first, get_priority(first_use.frame));
+  }
   for (auto& it : m_gx_pipeline_cache)
   {
-    if (!it.second.first)
-      QueuePipelineCompile(it.first, COMPILE_PRIORITY_SHADERCACHE_PIPELINE);
+    if (!it.second.first && !it.second.second)
+      QueuePipelineCompile(it.first, get_priority(UNKNOWN_FIRST_USE_FRAME));
   }
   for (auto& it : m_gx_uber_pipeline_cache)
   {
@@ -432,6 +454,8 @@ void ShaderCache::CompileMissingPipelines()
 
 std::unique_ptr<AbstractShader> ShaderCache::CompileVertexShader(const VertexShaderUid& uid) const
 {
+  FrontendTimers::ScopedTimer timer(FrontendTimers::Timer::ShaderGeneration);
+
   const ShaderCode source_code =
       GenerateVertexShaderCode(m_api_type, m_host_config, uid.GetUidData());
   return g_gfx->CreateShaderFromSource(ShaderStage::Vertex, source_code.GetBuffer());
@@ -440,6 +464,8 @@ std::unique_ptr<AbstractShader> ShaderCache::CompileVertexShader(const VertexSha
 std::unique_ptr<AbstractShader>
 ShaderCache::CompileVertexUberShader(const UberShader::VertexShaderUid& uid) const
 {
+  FrontendTimers::ScopedTimer timer(FrontendTimers::Timer::ShaderGeneration);
+
   const ShaderCode source_code =
       UberShader::GenVertexShader(m_api_type, m_host_config, uid.GetUidData());
   return g_gfx->CreateShaderFromSource(ShaderStage::Vertex, source_code.GetBuffer(),
@@ -448,6 +474,8 @@ ShaderCache::CompileVertexUberShader(const UberShader::VertexShaderUid& uid) con
 
 std::unique_ptr<AbstractShader> ShaderCache::CompilePixelShader(const PixelShaderUid& uid) const
 {
+  FrontendTimers::ScopedTimer timer(FrontendTimers::Timer::ShaderGeneration);
+
   const ShaderCode source_code =
       GeneratePixelShaderCode(m_api_type, m_host_config, uid.GetUidData(), {});
   return g_gfx->CreateShaderFromSource(ShaderStage::Pixel, source_code.GetBuffer());
@@ -456,6 +484,8 @@ std::unique_ptr<AbstractShader> ShaderCache::CompilePixelShader(const PixelShade
 std::unique_ptr<AbstractShader>
 ShaderCache::CompilePixelUberShader(const UberShader::PixelShaderUid& uid) const
 {
+  FrontendTimers::ScopedTimer timer(FrontendTimers::Timer::ShaderGeneration);
+
   const ShaderCode source_code =
       UberShader::GenPixelShader(m_api_type, m_host_config, uid.GetUidData(), {});
   return g_gfx->CreateShaderFromSource(ShaderStage::Pixel, source_code.GetBuffer(),
@@ -552,6 +582,8 @@ const AbstractShader* ShaderCache::InsertPixelUberShader(const UberShader::Pixel
 
 const AbstractShader* ShaderCache::CreateGeometryShader(const GeometryShaderUid& uid)
 {
+  FrontendTimers::ScopedTimer timer(FrontendTimers::Timer::ShaderGeneration);
+
   const ShaderCode source_code =
       GenerateGeometryShaderCode(m_api_type, m_host_config, uid.GetUidData());
   std::unique_ptr<AbstractShader> shader =
@@ -922,109 +954,49 @@ ShaderCache::InsertGXUberPipeline(const GXUberPipelineUid& config,
 
 void ShaderCache::LoadPipelineUIDCache()
 {
-  constexpr u32 CACHE_FILE_MAGIC = 0x44495550;  // PUID
-  constexpr size_t CACHE_HEADER_SIZE = sizeof(u32) + sizeof(u32);
-  std::string filename =
-      File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID() + ".uidcache";
-  if (m_gx_pipeline_uid_cache_file.Open(filename, "rb+"))
+  const std::string base_filename =
+      File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID();
+  const std::string filename = base_filename + ".uidcache";
+  const auto entries = m_gx_pipeline_uid_cache.Open(filename, base_filename + ".pipelinetrace",
+                                                    GX_PIPELINE_UID_VERSION);
+  for (const auto& entry : entries)
   {
-    // If an existing case exists, validate the version before reading entries.
-    u32 existing_magic;
-    u32 existing_version;
-    bool uid_file_valid = false;
-    if (m_gx_pipeline_uid_cache_file.ReadBytes(&existing_magic, sizeof(existing_magic)) &&
-        m_gx_pipeline_uid_cache_file.ReadBytes(&existing_version, sizeof(existing_version)) &&
-        existing_magic == CACHE_FILE_MAGIC && existing_version == GX_PIPELINE_UID_VERSION)
-    {
-      // Ensure the expected size matches the actual size of the file. If it doesn't, it means
-      // the cache file may be corrupted, and we should not proceed with loading potentially
-      // garbage or invalid UIDs.
-      const u64 file_size = m_gx_pipeline_uid_cache_file.GetSize();
-      const size_t uid_count =
-          static_cast<size_t>(file_size - CACHE_HEADER_SIZE) / sizeof(SerializedGXPipelineUid);
-      const size_t expected_size = uid_count * sizeof(SerializedGXPipelineUid) + CACHE_HEADER_SIZE;
-      uid_file_valid = file_size == expected_size;
-      if (uid_file_valid)
-      {
-        for (size_t i = 0; i < uid_count; i++)
-        {
-          SerializedGXPipelineUid serialized_uid;
-          if (m_gx_pipeline_uid_cache_file.ReadBytes(&serialized_uid, sizeof(serialized_uid)))
-          {
-            // This just adds the pipeline to the map, it is compiled later.
-            AddSerializedGXPipelineUID(serialized_uid);
-          }
-          else
-          {
-            uid_file_valid = false;
-            break;
-          }
-        }
-      }
+    GXPipelineUid real_uid;
+    UnserializePipelineUid(entry.uid, real_uid);
 
-      // We open the file for reading and writing, so we must seek to the end before writing.
-      if (uid_file_valid)
-        uid_file_valid = m_gx_pipeline_uid_cache_file.Seek(expected_size, File::SeekOrigin::Begin);
-    }
-
-    // If the file is invalid, close it. We re-open and truncate it below.
-    if (!uid_file_valid)
-      m_gx_pipeline_uid_cache_file.Close();
+    // This just adds the pipeline to the map, it is compiled later. The UID may already be there
+    // if its pipeline was loaded from the pipeline cache, in which case it's only traced.
+    const auto iter = m_gx_pipeline_cache.try_emplace(real_uid).first;
+    m_gx_pipeline_trace.push_back({&iter->first, entry.first_use_frame});
   }
 
-  // If the file is not open, it means it was either corrupted or didn't exist.
-  if (!m_gx_pipeline_uid_cache_file.IsOpen())
+  // Pipelines loaded from the pipeline cache whose UIDs weren't saved yet are added as well, so
+  // that the UID cache keeps covering everything the game has used.
+  for (const auto& it : m_gx_pipeline_cache)
   {
-    if (m_gx_pipeline_uid_cache_file.Open(filename, "wb"))
-    {
-      // Write the version identifier.
-      m_gx_pipeline_uid_cache_file.WriteBytes(&CACHE_FILE_MAGIC, sizeof(GX_PIPELINE_UID_VERSION));
-      m_gx_pipeline_uid_cache_file.WriteBytes(&GX_PIPELINE_UID_VERSION,
-                                              sizeof(GX_PIPELINE_UID_VERSION));
-
-      // Write any current UIDs out to the file.
-      // This way, if we load a UID cache where the data was incomplete (e.g. Dolphin crashed),
-      // we don't lose the existing UIDs which were previously at the beginning.
-      for (const auto& it : m_gx_pipeline_cache)
-        AppendGXPipelineUID(it.first);
-    }
+    SerializedGXPipelineUid disk_uid;
+    SerializePipelineUid(it.first, disk_uid);
+    m_gx_pipeline_uid_cache.Append(disk_uid, UNKNOWN_FIRST_USE_FRAME);
   }
 
-  INFO_LOG_FMT(VIDEO, "Read {} pipeline UIDs from {}", m_gx_pipeline_cache.size(), filename);
+  INFO_LOG_FMT(VIDEO, "Read {} pipeline UIDs from {}", entries.size(), filename);
 }
 
 void ShaderCache::ClosePipelineUIDCache()
 {
   // This is left as a method in case we need to append extra data to the file in the future.
-  m_gx_pipeline_uid_cache_file.Close();
+  m_gx_pipeline_uid_cache.Close();
 }
 
-void ShaderCache::AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid)
+void ShaderCache::RecordGXPipelineUID(const GXPipelineUid& config)
 {
-  GXPipelineUid real_uid;
-  UnserializePipelineUid(uid, real_uid);
-
-  auto iter = m_gx_pipeline_cache.find(real_uid);
-  if (iter != m_gx_pipeline_cache.end())
-    return;
-
-  // Flag it as empty with a null pipeline object, for later compilation.
-  auto& entry = m_gx_pipeline_cache[real_uid];
-  entry.second = false;
-}
-
-void ShaderCache::AppendGXPipelineUID(const GXPipelineUid& config)
-{
-  if (!m_gx_pipeline_uid_cache_file.IsOpen())
-    return;
+  // The pipeline itself is inserted by the caller.
+  const auto iter = m_gx_pipeline_cache.try_emplace(config).first;
+  m_gx_pipeline_trace.push_back({&iter->first, m_frame_count});
 
   SerializedGXPipelineUid disk_uid;
   SerializePipelineUid(config, disk_uid);
-  if (!m_gx_pipeline_uid_cache_file.WriteBytes(&disk_uid, sizeof(disk_uid)))
-  {
-    WARN_LOG_FMT(VIDEO, "Writing pipeline UID to cache failed, closing file.");
-    m_gx_pipeline_uid_cache_file.Close();
-  }
+  m_gx_pipeline_uid_cache.Append(disk_uid, m_frame_count);
 }
 
 void ShaderCache::QueueVertexShaderCompile(const VertexShaderUid& uid, u32 priority)
@@ -12,9 +12,9 @@
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
-#include "Common/IOFile.h"
 #include "Common/LinearDiskCache.h"
 
 #include "VideoCommon/AbstractPipeline.h"
@@ -22,6 +22,7 @@
 #include "VideoCommon/AsyncShaderCompiler.h"
 #include "VideoCommon/GXPipelineTypes.h"
 #include "VideoCommon/GeometryShaderGen.h"
+#include "VideoCommon/PipelineUIDCacheFile.h"
 #include "VideoCommon/PixelShaderGen.h"
 #include "VideoCommon/RenderState.h"
 #include "VideoCommon/TextureCacheBase.h"
@@ -159,8 +160,7 @@ private:
                                            std::unique_ptr<AbstractPipeline> pipeline);
   const AbstractPipeline* InsertGXUberPipeline(const GXUberPipelineUid& config,
                                                std::unique_ptr<AbstractPipeline> pipeline);
-  void AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid);
-  void AppendGXPipelineUID(const GXPipelineUid& config);
+  void RecordGXPipelineUID(const GXPipelineUid& config);
 
   // ASync Compiler Methods
   void QueueVertexShaderCompile(const VertexShaderUid& uid, u32 priority);
@@ -185,6 +185,8 @@ private:
   // The shader cache is compiled last, as it is the least likely to be required. On demand
   // shaders are always compiled before pending ubershaders, as we want to use the ubershader
   // for as few frames as possible, otherwise we risk framerate drops.
+  // Pipelines from the shader cache are offset by the frame they were first used in, so that the
+  // ones a game needs right after booting are ready first.
   enum : u32
   {
     COMPILE_PRIORITY_ONDEMAND_PIPELINE = 100,
@@ -192,6 +194,9 @@ private:
     COMPILE_PRIORITY_SHADERCACHE_PIPELINE = 300
   };
 
+  static constexpr u32 UNKNOWN_FIRST_USE_FRAME =
+      VideoCommon::PipelineUIDCacheFile<SerializedGXPipelineUid>::UNKNOWN_FIRST_USE_FRAME;
+
   // Configuration bits.
   APIType m_api_type;
   ShaderHostConfig m_host_config = {};
@@ -228,7 +233,19 @@ private:
   std::map<GXPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>> m_gx_pipeline_cache;
   std::map<GXUberPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>>
       m_gx_uber_pipeline_cache;
-  File::IOFile m_gx_pipeline_uid_cache_file;
+  VideoCommon::PipelineUIDCacheFile<SerializedGXPipelineUid> m_gx_pipeline_uid_cache;
+
+  // Usage trace of the GX pipelines: every UID in the order it was first used, along with the
+  // frame it was first used in. The keys point into m_gx_pipeline_cache, which never removes
+  // entries. The frames are saved next to the UID cache, one for each UID in that file.
+  struct PipelineFirstUse
+  {
+    const GXPipelineUid* uid;
+    u32 frame;
+  };
+  std::vector<PipelineFirstUse> m_gx_pipeline_trace;
+  u32 m_frame_count = 0;
+
   Common::LinearDiskCache<SerializedGXPipelineUid, u8> m_gx_pipeline_disk_cache;
   Common::LinearDiskCache<SerializedGXUberPipelineUid, u8> m_gx_uber_pipeline_disk_cache;
 
@@ -9,6 +9,7 @@
 #include <imgui.h>
 
 #include "Core/DolphinAnalytics.h"
+#include "Core/HW/Memmap.h"
 #include "Core/HW/SystemTimers.h"
 #include "Core/System.h"
 
@@ -37,6 +38,8 @@ static bool clear_scissors;
 void Statistics::ResetFrame()
 {
   this_frame = {};
+  num_new_dirty_memory_pages =
+      static_cast<int>(Core::System::GetInstance().GetMemory().TakeNumNewlyDirtyPages());
   clear_scissors = true;
   if (scissors.size() > 1)
   {
@@ -114,6 +117,14 @@ void Statistics::Display() const
   draw_statistic("EFB pokes:", "%d", this_frame.num_efb_pokes);
   draw_statistic("Draw dones:", "%d", this_frame.num_draw_done);
   draw_statistic("Tokens:", "%d/%d", this_frame.num_token, this_frame.num_token_int);
+  const auto& memory = Core::System::GetInstance().GetMemory();
+  if (memory.IsDirtyPageTrackingEnabled())
+  {
+    // The total counts pages dirtied since the last checkpoint (savestate), the other those that
+    // became dirty during the last frame.
+    draw_statistic("Dirty RAM pages:", "%u (+%d)", memory.GetNumDirtyPages(),
+                   num_new_dirty_memory_pages);
+  }
 
   ImGui::Columns(1);
 
@@ -20,6 +20,8 @@ struct Statistics
   int num_textures_alive = 0;
 
   int num_vertex_loaders = 0;
+  // Emulated memory pages that became dirty during the last frame, see Memory::MemoryManager.
+  int num_new_dirty_memory_pages = 0;
 
   std::array<float, 6> proj{};
   std::array<float, 16> gproj{};
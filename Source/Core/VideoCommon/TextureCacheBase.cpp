@@ -4,6 +4,7 @@
 #include "VideoCommon/TextureCacheBase.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <cstring>
 #include <memory>
@@ -15,6 +16,7 @@
 #endif
 
 #include <fmt/format.h>
+#include <xxhash.h>
 
 #include "Common/Align.h"
 #include "Common/Assert.h"
@@ -39,6 +41,7 @@
 #include "VideoCommon/Assets/CustomTextureData.h"
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/FramebufferManager.h"
+#include "VideoCommon/FrontendTimers.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/FBInfo.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModActionData.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModManager.h"
@@ -61,6 +64,13 @@ static const u64 TEXHASH_INVALID = 0;
 static const int TEXTURE_KILL_THRESHOLD = 64;
 static const int TEXTURE_POOL_KILL_THRESHOLD = 3;
 
+// Textures are only split up for decoding on multiple threads in bands of at least this many
+// texels, so that the handoff doesn't cost more than it saves.
+static const u32 MIN_TEXELS_PER_DECODE_BAND = 256 * 256;
+
+// Smaller textures decode faster than they can be hashed and read back from the disk cache.
+static const u32 MIN_TEXELS_FOR_DISK_CACHE = 128 * 128;
+
 static int xfb_count = 0;
 
 std::unique_ptr<TextureCacheBase> g_texture_cache;
@@ -89,6 +99,130 @@ void TextureCacheBase::CheckTempSize(size_t required_size)
   m_temp = static_cast<u8*>(Common::AllocateAlignedMemory(m_temp_size, 16));
 }
 
+void TextureCacheBase::DecodeTexturesOnCPU(std::span<const CPUDecodeJob> jobs, TextureFormat format,
+                                           const u8* tlut, TLUTFormat tlut_format)
+{
+  // Textures are stored as rows of blocks, so a band of block rows can be decoded on its own. The
+  // texture format overlay is drawn per call, so those textures are only split by level.
+  const u32 block_height = TexDecoder_GetBlockHeightInTexels(format);
+  const bool split_levels = !m_decode_threads.empty() && !m_backup_config.texfmt_overlay;
+
+  std::vector<CPUDecodeJob> bands;
+  for (const CPUDecodeJob& job : jobs)
+  {
+    u32 band_height = job.expanded_height;
+    if (split_levels)
+    {
+      band_height = Common::AlignUp(std::max(MIN_TEXELS_PER_DECODE_BAND / job.expanded_width, 1u),
+                                    block_height);
+    }
+
+    for (u32 y = 0; y < job.expanded_height; y += band_height)
+    {
+      bands.push_back({job.dst + y * job.expanded_width * sizeof(u32),
+                       job.src + TexDecoder_GetTextureSizeInBytes(job.expanded_width, y, format),
+                       job.expanded_width, std::min(band_height, job.expanded_height - y)});
+    }
+  }
+
+  if (bands.empty())
+    return;
+
+  std::atomic<size_t> next_band = 0;
+  const auto decode_bands = [&] {
+    for (size_t i = next_band++; i < bands.size(); i = next_band++)
+    {
+      TexDecoder_Decode(bands[i].dst, bands[i].src, bands[i].expanded_width,
+                        bands[i].expanded_height, format, tlut, tlut_format);
+    }
+  };
+
+  // The GPU thread decodes as well, so one band doesn't need any help.
+  const size_t num_helpers = std::min(m_decode_threads.size(), bands.size() - 1);
+  for (size_t i = 0; i < num_helpers; ++i)
+    m_decode_threads[i]->Push(decode_bands);
+  decode_bands();
+  for (size_t i = 0; i < num_helpers; ++i)
+    m_decode_threads[i]->WaitForCompletion();
+}
+
+void TextureCacheBase::DecodeTexturesOnCPUWithDiskCache(std::span<const CPUDecodeJob> jobs,
+                                                        const TextureInfo& texture_info)
+{
+  const TextureFormat format = texture_info.GetTextureFormat();
+  const u8* const tlut = texture_info.GetTlutAddress();
+  const TLUTFormat tlut_format = texture_info.GetTlutFormat();
+
+  // The levels are decoded to consecutive parts of the temporary buffer, which are stored as one
+  // entry. The texture format overlay changes the decoded data, so those textures are skipped.
+  u8* const dst = jobs.empty() ? nullptr : jobs.front().dst;
+  size_t size = 0;
+  bool use_disk_cache = m_disk_cache.IsOpen() && !m_backup_config.texfmt_overlay;
+  for (const CPUDecodeJob& job : jobs)
+  {
+    use_disk_cache &= job.dst == dst + size;
+    size += job.expanded_width * job.expanded_height * sizeof(u32);
+  }
+  use_disk_cache &= size >= MIN_TEXELS_FOR_DISK_CACHE * sizeof(u32);
+
+  if (!use_disk_cache)
+  {
+    DecodeTexturesOnCPU(jobs, format, tlut, tlut_format);
+    return;
+  }
+
+  // The key covers everything the decoded data depends on.
+  std::unique_ptr<XXH3_state_t, decltype(&XXH3_freeState)> state(XXH3_createState(),
+                                                                  &XXH3_freeState);
+  XXH3_128bits_reset(state.get());
+  const u32 formats[] = {static_cast<u32>(format), static_cast<u32>(tlut_format)};
+  XXH3_128bits_update(state.get(), formats, sizeof(formats));
+  for (const CPUDecodeJob& job : jobs)
+  {
+    const u32 dimensions[] = {job.expanded_width, job.expanded_height};
+    XXH3_128bits_update(state.get(), dimensions, sizeof(dimensions));
+    XXH3_128bits_update(
+        state.get(), job.src,
+        TexDecoder_GetTextureSizeInBytes(job.expanded_width, job.expanded_height, format));
+  }
+  if (texture_info.GetPaletteSize())
+    XXH3_128bits_update(state.get(), tlut, *texture_info.GetPaletteSize());
+  const XXH128_hash_t hash = XXH3_128bits_digest(state.get());
+  const VideoCommon::DecodedTextureDiskCache::Key key{hash.low64, hash.high64};
+
+  if (m_disk_cache.Read(key, {dst, size}))
+    return;
+
+  DecodeTexturesOnCPU(jobs, format, tlut, tlut_format);
+  m_disk_cache.Write(key, {dst, size});
+}
+
+void TextureCacheBase::OpenDiskCache()
+{
+  m_disk_cache.Close();
+  if (!m_backup_config.texture_disk_cache)
+    return;
+
+  const std::string filename =
+      File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID() + ".texcache";
+  const u64 size_budget = static_cast<u64>(std::max(m_backup_config.texture_disk_cache_size, 0))
+                          << 20;
+  m_disk_cache.Open(filename, size_budget);
+}
+
+void TextureCacheBase::ResizeDecodeThreads(u32 num_threads)
+{
+  m_decode_threads.resize(num_threads);
+  for (auto& thread : m_decode_threads)
+  {
+    if (!thread)
+    {
+      thread = std::make_unique<Common::WorkQueueThread<std::function<void()>>>(
+          "Texture Decoding", [](std::function<void()> work) { work(); });
+    }
+  }
+}
+
 TextureCacheBase::TextureCacheBase()
 {
   SetBackupConfig(g_ActiveConfig);
@@ -98,6 +232,7 @@ TextureCacheBase::TextureCacheBase()
 
   TexDecoder_SetTexFmtOverlayOptions(m_backup_config.texfmt_overlay,
                                      m_backup_config.texfmt_overlay_center);
+  ResizeDecodeThreads(m_backup_config.texture_decoding_threads);
 
   TMEM::InvalidateAll();
 }
@@ -111,6 +246,8 @@ void TextureCacheBase::Shutdown()
 
   // For correctness, we need to invalidate textures before the gpu context starts shutting down.
   Invalidate();
+
+  m_disk_cache.Close();
 }
 
 TextureCacheBase::~TextureCacheBase()
@@ -127,6 +264,7 @@ bool TextureCacheBase::Initialize()
     return false;
   }
 
+  OpenDiskCache();
   return true;
 }
 
@@ -169,7 +307,17 @@ void TextureCacheBase::OnConfigChanged(const VideoConfig& config)
     TexDecoder_SetTexFmtOverlayOptions(config.bTexFmtOverlayEnable, config.bTexFmtOverlayCenter);
   }
 
+  if (config.GetTextureDecodingThreads() != m_backup_config.texture_decoding_threads)
+    ResizeDecodeThreads(config.GetTextureDecodingThreads());
+
+  const bool disk_cache_changed =
+      config.bTextureDiskCache != m_backup_config.texture_disk_cache ||
+      config.iTextureDiskCacheSize != m_backup_config.texture_disk_cache_size;
+
   SetBackupConfig(config);
+
+  if (disk_cache_changed)
+    OpenDiskCache();
 }
 
 void TextureCacheBase::Cleanup(int _frameCount)
@@ -257,6 +405,9 @@ void TextureCacheBase::SetBackupConfig(const VideoConfig& config)
   m_backup_config.graphics_mods = config.bGraphicMods;
   m_backup_config.graphics_mod_change_count =
       config.graphics_mod_config ? config.graphics_mod_config->GetChangeCount() : 0;
+  m_backup_config.texture_decoding_threads = config.GetTextureDecodingThreads();
+  m_backup_config.texture_disk_cache = config.bTextureDiskCache;
+  m_backup_config.texture_disk_cache_size = config.iTextureDiskCacheSize;
 }
 
 bool TextureCacheBase::DidLinkedAssetsChange(const TCacheEntry& entry)
@@ -1243,6 +1394,8 @@ private:
 
 TCacheEntry* TextureCacheBase::Load(const TextureInfo& texture_info)
 {
+  FrontendTimers::ScopedTimer timer(FrontendTimers::Timer::TextureCache);
+
   if (auto entry = LoadImpl(texture_info, false))
   {
     if (!DidLinkedAssetsChange(*entry))
@@ -1347,10 +1500,39 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
                                                             MemoryUpdate::Type::TextureMap);
   }
 
+  // With dirty page tracking, textures whose memory hasn't been written to since they were last
+  // hashed can reuse the old hash. Start watching for writes before hashing, so that a write racing
+  // with the hashing changes the generation.
+  std::optional<u64> write_generation;
+  bool reused_hash = false;
+  auto& memory = Core::System::GetInstance().GetMemory();
+  if (!texture_info.IsFromTmem() && memory.IsDirtyPageTrackingEnabled())
+  {
+    write_generation =
+        memory.GetWriteGeneration(texture_info.GetData(), texture_info.GetTextureSize());
+    const auto [begin, end] = m_textures_by_address.equal_range(texture_info.GetRawAddress());
+    for (auto it = begin; it != end && write_generation; ++it)
+    {
+      const TCacheEntry& entry = *it->second;
+      if (!entry.IsCopy() && entry.write_generation == write_generation &&
+          entry.size_in_bytes == texture_info.GetTextureSize())
+      {
+        base_hash = entry.base_hash;
+        reused_hash = true;
+        break;
+      }
+    }
+    if (!reused_hash)
+      write_generation = memory.WatchWrites(texture_info.GetData(), texture_info.GetTextureSize());
+  }
+
   // TODO: This doesn't hash GB tiles for preloaded RGBA8 textures (instead, it's hashing more data
   // from the low tmem bank than it should)
-  base_hash = Common::GetHash64(texture_info.GetData(), texture_info.GetTextureSize(),
-                                textureCacheSafetyColorSampleSize);
+  if (!reused_hash)
+  {
+    base_hash = Common::GetHash64(texture_info.GetData(), texture_info.GetTextureSize(),
+                                  textureCacheSafetyColorSampleSize);
+  }
   u32 palette_size = 0;
   if (texture_info.GetPaletteSize())
   {
@@ -1478,6 +1660,7 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
           entry->native_width == texture_info.GetRawWidth() &&
           entry->native_height == texture_info.GetRawHeight())
       {
+        entry->write_generation = write_generation;
         entry = DoPartialTextureUpdates(iter->second, texture_info.GetTlutAddress(),
                                         texture_info.GetTlutFormat());
         if (entry)
@@ -1637,7 +1820,8 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
   }
 
   auto entry =
-      CreateTextureEntry(TextureCreationInfo{base_hash, full_hash, bytes_per_block, palette_size},
+      CreateTextureEntry(TextureCreationInfo{base_hash, full_hash, bytes_per_block, palette_size,
+                                             write_generation},
                          texture_info, textureCacheSafetyColorSampleSize,
                          std::move(data_for_assets), has_arbitrary_mipmaps, skip_texture_dump);
   entry->linked_game_texture_assets = std::move(cached_game_assets);
@@ -1726,6 +1910,20 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
     // Initialized to null because only software loading uses this buffer
     u8* dst_buffer = nullptr;
 
+    // Levels that aren't decoded on the GPU are all decoded at once, so that the work can be
+    // spread across threads, and are uploaded afterwards.
+    struct CPUDecodedLevel
+    {
+      u32 level;
+      u32 width;
+      u32 height;
+      u32 expanded_width;
+      u8* data;
+      size_t size;
+    };
+    std::vector<CPUDecodeJob> decode_jobs;
+    std::vector<CPUDecodedLevel> decoded_levels;
+
     if (!decode_on_gpu ||
         !DecodeTextureOnGPU(
             entry, 0, texture_info.GetData(), texture_info.GetTextureSize(),
@@ -1755,9 +1953,8 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
       dst_buffer = m_temp;
       if (!(texture_info.GetTextureFormat() == TextureFormat::RGBA8 && texture_info.IsFromTmem()))
       {
-        TexDecoder_Decode(dst_buffer, texture_info.GetData(), expanded_width, expanded_height,
-                          texture_info.GetTextureFormat(), texture_info.GetTlutAddress(),
-                          texture_info.GetTlutFormat());
+        decode_jobs.push_back(
+            {dst_buffer, texture_info.GetData(), expanded_width, expanded_height});
       }
       else
       {
@@ -1766,9 +1963,8 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
                                        expanded_height);
       }
 
-      entry->texture->Load(0, width, height, expanded_width, dst_buffer, decoded_texture_size);
-
-      arbitrary_mip_detector.AddLevel(width, height, expanded_width, dst_buffer);
+      decoded_levels.push_back(
+          {0, width, height, expanded_width, dst_buffer, decoded_texture_size});
 
       dst_buffer += decoded_texture_size;
     }
@@ -1791,19 +1987,24 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
         // No need to call CheckTempSize here, as the whole buffer is preallocated at the beginning
         const u32 decoded_mip_size =
             mip_level->GetExpandedWidth() * sizeof(u32) * mip_level->GetExpandedHeight();
-        TexDecoder_Decode(dst_buffer, mip_level->GetData(), mip_level->GetExpandedWidth(),
-                          mip_level->GetExpandedHeight(), texture_info.GetTextureFormat(),
-                          texture_info.GetTlutAddress(), texture_info.GetTlutFormat());
-        entry->texture->Load(level, mip_level->GetRawWidth(), mip_level->GetRawHeight(),
-                             mip_level->GetExpandedWidth(), dst_buffer, decoded_mip_size);
-
-        arbitrary_mip_detector.AddLevel(mip_level->GetRawWidth(), mip_level->GetRawHeight(),
-                                        mip_level->GetExpandedWidth(), dst_buffer);
+        decode_jobs.push_back({dst_buffer, mip_level->GetData(), mip_level->GetExpandedWidth(),
+                               mip_level->GetExpandedHeight()});
+        decoded_levels.push_back({level, mip_level->GetRawWidth(), mip_level->GetRawHeight(),
+                                  mip_level->GetExpandedWidth(), dst_buffer, decoded_mip_size});
 
         dst_buffer += decoded_mip_size;
       }
     }
 
+    DecodeTexturesOnCPUWithDiskCache(decode_jobs, texture_info);
+
+    for (const CPUDecodedLevel& level : decoded_levels)
+    {
+      entry->texture->Load(level.level, level.width, level.height, level.expanded_width, level.data,
+                           level.size);
+      arbitrary_mip_detector.AddLevel(level.width, level.height, level.expanded_width, level.data);
+    }
+
     entry->has_arbitrary_mips = arbitrary_mip_detector.HasArbitraryMipmaps(dst_buffer);
 
     if (g_ActiveConfig.bDumpTextures && !skip_texture_dump && texLevels > 0)
@@ -1838,6 +2039,7 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
   entry->SetDimensions(texture_info.GetRawWidth(), texture_info.GetRawHeight(),
                        texture_info.GetLevelCount());
   entry->SetHashes(creation_info.base_hash, creation_info.full_hash);
+  entry->write_generation = creation_info.write_generation;
   entry->memory_stride = entry->BytesPerRow();
   entry->SetNotCopy();
 
@@ -6,9 +6,11 @@
 #include <array>
 #include <filesystem>
 #include <fmt/format.h>
+#include <functional>
 #include <map>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
 #include <tuple>
@@ -20,10 +22,12 @@
 #include "Common/CommonTypes.h"
 #include "Common/Flag.h"
 #include "Common/MathUtil.h"
+#include "Common/WorkQueueThread.h"
 
 #include "VideoCommon/AbstractTexture.h"
 #include "VideoCommon/Assets/CustomAsset.h"
 #include "VideoCommon/BPMemory.h"
+#include "VideoCommon/DecodedTextureDiskCache.h"
 #include "VideoCommon/TextureConfig.h"
 #include "VideoCommon/TextureDecoder.h"
 #include "VideoCommon/TextureInfo.h"
@@ -125,6 +129,9 @@ struct TCacheEntry
   u32 size_in_bytes = 0;
   u64 base_hash = 0;
   u64 hash = 0;  // for paletted textures, hash = base_hash ^ palette_hash
+  // Write generation of the memory base_hash was computed from, if it is being watched for writes.
+  // See MemoryManager::WatchWrites.
+  std::optional<u64> write_generation;
   TextureAndTLUTFormat format;
   u32 memory_stride = 0;
   bool is_efb_copy = false;
@@ -259,6 +266,7 @@ public:
     u64 full_hash;
     u32 bytes_per_block;
     u32 palette_size;
+    std::optional<u64> write_generation;
   };
 
   TextureCacheBase();
@@ -369,6 +377,26 @@ private:
 
   void CheckTempSize(size_t required_size);
 
+  // One texture level to be decoded by DecodeTexturesOnCPU.
+  struct CPUDecodeJob
+  {
+    u8* dst;
+    const u8* src;
+    u32 expanded_width;
+    u32 expanded_height;
+  };
+
+  // Decodes all the given levels of a texture. Large levels are split into bands of block rows,
+  // and the bands and levels are spread across m_decode_threads and the calling thread.
+  void DecodeTexturesOnCPU(std::span<const CPUDecodeJob> jobs, TextureFormat format, const u8* tlut,
+                           TLUTFormat tlut_format);
+  void ResizeDecodeThreads(u32 num_threads);
+  // Like DecodeTexturesOnCPU, but reads the decoded data from the disk cache if possible, and
+  // writes it to the disk cache otherwise.
+  void DecodeTexturesOnCPUWithDiskCache(std::span<const CPUDecodeJob> jobs,
+                                        const TextureInfo& texture_info);
+  void OpenDiskCache();
+
   RcTcacheEntry AllocateCacheEntry(const TextureConfig& config);
   std::optional<TexPoolEntry> AllocateTexture(const TextureConfig& config);
   TexPool::iterator FindMatchingTextureFromPool(const TextureConfig& config);
@@ -438,6 +466,9 @@ private:
     bool arbitrary_mipmap_detection;
     bool graphics_mods;
     u32 graphics_mod_change_count;
+    u32 texture_decoding_threads;
+    bool texture_disk_cache;
+    int texture_disk_cache_size;
   };
   BackupConfig m_backup_config = {};
 
@@ -467,6 +498,11 @@ private:
       AfterFrameEvent::Register([this](Core::System&) { OnFrameEnd(); }, "TextureCache");
 
   VideoCommon::TextureUtils::TextureDumper m_texture_dumper;
+
+  // Threads that help the GPU thread decode large textures.
+  std::vector<std::unique_ptr<Common::WorkQueueThread<std::function<void()>>>> m_decode_threads;
+
+  VideoCommon::DecodedTextureDiskCache m_disk_cache;
 };
 
 extern std::unique_ptr<TextureCacheBase> g_texture_cache;
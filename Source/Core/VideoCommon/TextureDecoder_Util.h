@@ -3,7 +3,14 @@
 
 #pragma once
 
+#include <array>
+#include <cstddef>
+#include <cstring>
+
 #include "Common/CommonTypes.h"
+#include "Common/Swap.h"
+#include "VideoCommon/LookUpTables.h"
+#include "VideoCommon/TextureDecoder.h"
 
 struct DXTBlock
 {
@@ -22,3 +29,77 @@ constexpr int DXTBlend(int v1, int v2)
   // 3/8 blend, which is close to 1/3
   return ((v1 * 3 + v2 * 5) >> 3);
 }
+
+// Texture data, including TLUT entries, is stored big-endian.
+inline u16 ReadBE16(const u8* src)
+{
+  u16 val;
+  std::memcpy(&val, src, sizeof(u16));
+  return Common::swap16(val);
+}
+
+// These decode one 16-bit texel, as returned by ReadBE16. They have no branches, so that loops
+// over them can be vectorized.
+inline u32 DecodeIA8(u16 val)
+{
+  const u32 a = val >> 8;
+  const u32 i = val & 0xFF;
+  return i | (i << 8) | (i << 16) | (a << 24);
+}
+
+inline u32 DecodeRGB565(u16 val)
+{
+  const u32 r = Convert5To8((val >> 11) & 0x1f);
+  const u32 g = Convert6To8((val >> 5) & 0x3f);
+  const u32 b = Convert5To8(val & 0x1f);
+  return MakeRGBA(r, g, b, 0xFF);
+}
+
+inline u32 DecodeRGB5A3(u16 val)
+{
+  // Decode both layouts and pick one with a mask rather than a branch.
+  const u32 rgb555 = MakeRGBA(Convert5To8((val >> 10) & 0x1f), Convert5To8((val >> 5) & 0x1f),
+                              Convert5To8(val & 0x1f), 0xFF);
+  const u32 argb3444 = MakeRGBA(Convert4To8((val >> 8) & 0xf), Convert4To8((val >> 4) & 0xf),
+                                Convert4To8(val & 0xf), Convert3To8((val >> 12) & 0x7));
+  const u32 mask = 0u - (val >> 15);
+  return (rgb555 & mask) | (argb3444 & ~mask);
+}
+
+template <TLUTFormat tlutfmt>
+inline u32 DecodeTLUTEntry(const u8* tlut, u32 index)
+{
+  const u16 val = ReadBE16(tlut + 2 * index);
+  if constexpr (tlutfmt == TLUTFormat::IA8)
+    return DecodeIA8(val);
+  else if constexpr (tlutfmt == TLUTFormat::RGB565)
+    return DecodeRGB565(val);
+  else
+    return DecodeRGB5A3(val);
+}
+
+// C4 and C8 textures can only address 16 and 256 palette entries, so it is cheaper to decode the
+// palette once up front than to decode an entry for every texel.
+template <size_t N>
+std::array<u32, N> DecodePalette(const u8* tlut, TLUTFormat tlutfmt)
+{
+  std::array<u32, N> palette{};
+  switch (tlutfmt)
+  {
+  case TLUTFormat::IA8:
+    for (u32 i = 0; i < N; i++)
+      palette[i] = DecodeTLUTEntry<TLUTFormat::IA8>(tlut, i);
+    break;
+  case TLUTFormat::RGB565:
+    for (u32 i = 0; i < N; i++)
+      palette[i] = DecodeTLUTEntry<TLUTFormat::RGB565>(tlut, i);
+    break;
+  case TLUTFormat::RGB5A3:
+    for (u32 i = 0; i < N; i++)
+      palette[i] = DecodeTLUTEntry<TLUTFormat::RGB5A3>(tlut, i);
+    break;
+  default:
+    break;
+  }
+  return palette;
+}
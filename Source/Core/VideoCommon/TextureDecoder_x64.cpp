@@ -62,68 +62,6 @@ static inline u32 DecodePixel_RGB5A3(u16 val)
   return r | (g << 8) | (b << 16) | (a << 24);
 }
 
-static inline void DecodeBytes_C4_IA8(u32* dst, const u8* src, const u8* tlut_)
-{
-  const u16* tlut = (u16*)tlut_;
-  for (int x = 0; x < 4; x++)
-  {
-    u8 val = src[x];
-    *dst++ = DecodePixel_IA8(tlut[val >> 4]);
-    *dst++ = DecodePixel_IA8(tlut[val & 0xF]);
-  }
-}
-
-static inline void DecodeBytes_C4_RGB565(u32* dst, const u8* src, const u8* tlut_)
-{
-  const u16* tlut = (u16*)tlut_;
-  for (int x = 0; x < 4; x++)
-  {
-    u8 val = src[x];
-    *dst++ = DecodePixel_RGB565(Common::swap16(tlut[val >> 4]));
-    *dst++ = DecodePixel_RGB565(Common::swap16(tlut[val & 0xF]));
-  }
-}
-
-static inline void DecodeBytes_C4_RGB5A3(u32* dst, const u8* src, const u8* tlut_)
-{
-  const u16* tlut = (u16*)tlut_;
-  for (int x = 0; x < 4; x++)
-  {
-    u8 val = src[x];
-    *dst++ = DecodePixel_RGB5A3(Common::swap16(tlut[val >> 4]));
-    *dst++ = DecodePixel_RGB5A3(Common::swap16(tlut[val & 0xF]));
-  }
-}
-
-static inline void DecodeBytes_C8_IA8(u32* dst, const u8* src, const u8* tlut_)
-{
-  const u16* tlut = (u16*)tlut_;
-  for (int x = 0; x < 8; x++)
-  {
-    *dst++ = DecodePixel_IA8(tlut[src[x]]);
-  }
-}
-
-static inline void DecodeBytes_C8_RGB565(u32* dst, const u8* src, const u8* tlut_)
-{
-  const u16* tlut = (u16*)tlut_;
-  for (int x = 0; x < 8; x++)
-  {
-    u8 val = src[x];
-    *dst++ = DecodePixel_RGB565(Common::swap16(tlut[val]));
-  }
-}
-
-static inline void DecodeBytes_C8_RGB5A3(u32* dst, const u8* src, const u8* tlut_)
-{
-  const u16* tlut = (u16*)tlut_;
-  for (int x = 0; x < 8; x++)
-  {
-    u8 val = src[x];
-    *dst++ = DecodePixel_RGB5A3(Common::swap16(tlut[val]));
-  }
-}
-
 static inline void DecodeBytes_C14X2_IA8(u32* dst, const u16* src, const u8* tlut_)
 {
   const u16* tlut = (u16*)tlut_;
@@ -154,17 +92,6 @@ static inline void DecodeBytes_C14X2_RGB5A3(u32* dst, const u16* src, const u8*
   }
 }
 
-static inline void DecodeBytes_IA4(u32* dst, const u8* src)
-{
-  for (int x = 0; x < 8; x++)
-  {
-    const u8 val = src[x];
-    u8 a = Convert4To8(val >> 4);
-    u8 l = Convert4To8(val & 0xF);
-    dst[x] = (a << 24) | l << 16 | l << 8 | l;
-  }
-}
-
 #ifdef CHECK
 static void DecodeDXTBlock(u32* dst, const DXTBlock* src, int pitch)
 {
@@ -220,37 +147,23 @@ static void TexDecoder_DecodeImpl_C4(u32* dst, const u8* src, int width, int hei
                                      TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt,
                                      int Wsteps4, int Wsteps8)
 {
-  switch (tlutfmt)
-  {
-  case TLUTFormat::RGB5A3:
-  {
-    for (int y = 0; y < height; y += 8)
-      for (int x = 0, yStep = (y / 8) * Wsteps8; x < width; x += 8, yStep++)
-        for (int iy = 0, xStep = 8 * yStep; iy < 8; iy++, xStep++)
-          DecodeBytes_C4_RGB5A3(dst + (y + iy) * width + x, src + 4 * xStep, tlut);
-  }
-  break;
-
-  case TLUTFormat::IA8:
-  {
-    for (int y = 0; y < height; y += 8)
-      for (int x = 0, yStep = (y / 8) * Wsteps8; x < width; x += 8, yStep++)
-        for (int iy = 0, xStep = 8 * yStep; iy < 8; iy++, xStep++)
-          DecodeBytes_C4_IA8(dst + (y + iy) * width + x, src + 4 * xStep, tlut);
-  }
-  break;
+  const auto palette = DecodePalette<16>(tlut, tlutfmt);
 
-  case TLUTFormat::RGB565:
+  for (int y = 0; y < height; y += 8)
   {
-    for (int y = 0; y < height; y += 8)
-      for (int x = 0, yStep = (y / 8) * Wsteps8; x < width; x += 8, yStep++)
-        for (int iy = 0, xStep = 8 * yStep; iy < 8; iy++, xStep++)
-          DecodeBytes_C4_RGB565(dst + (y + iy) * width + x, src + 4 * xStep, tlut);
-  }
-  break;
-
-  default:
-    break;
+    for (int x = 0, yStep = (y / 8) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int iy = 0, xStep = 8 * yStep; iy < 8; iy++, xStep++)
+      {
+        u32* ptr = dst + (y + iy) * width + x;
+        const u8* s = src + 4 * xStep;
+        for (int ix = 0; ix < 4; ix++)
+        {
+          ptr[2 * ix] = palette[s[ix] >> 4];
+          ptr[2 * ix + 1] = palette[s[ix] & 0xF];
+        }
+      }
+    }
   }
 }
 
@@ -529,37 +442,20 @@ static void TexDecoder_DecodeImpl_C8(u32* dst, const u8* src, int width, int hei
                                      TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt,
                                      int Wsteps4, int Wsteps8)
 {
-  switch (tlutfmt)
-  {
-  case TLUTFormat::RGB5A3:
-  {
-    for (int y = 0; y < height; y += 4)
-      for (int x = 0, yStep = (y / 4) * Wsteps8; x < width; x += 8, yStep++)
-        for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
-          DecodeBytes_C8_RGB5A3((u32*)dst + (y + iy) * width + x, src + 8 * xStep, tlut);
-  }
-  break;
-
-  case TLUTFormat::IA8:
-  {
-    for (int y = 0; y < height; y += 4)
-      for (int x = 0, yStep = (y / 4) * Wsteps8; x < width; x += 8, yStep++)
-        for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
-          DecodeBytes_C8_IA8(dst + (y + iy) * width + x, src + 8 * xStep, tlut);
-  }
-  break;
+  const auto palette = DecodePalette<256>(tlut, tlutfmt);
 
-  case TLUTFormat::RGB565:
+  for (int y = 0; y < height; y += 4)
   {
-    for (int y = 0; y < height; y += 4)
-      for (int x = 0, yStep = (y / 4) * Wsteps8; x < width; x += 8, yStep++)
-        for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
-          DecodeBytes_C8_RGB565(dst + (y + iy) * width + x, src + 8 * xStep, tlut);
-  }
-  break;
-
-  default:
-    break;
+    for (int x = 0, yStep = (y / 4) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
+      {
+        u32* ptr = dst + (y + iy) * width + x;
+        const u8* s = src + 8 * xStep;
+        for (int ix = 0; ix < 8; ix++)
+          ptr[ix] = palette[s[ix]];
+      }
+    }
   }
 }
 
@@ -567,13 +463,30 @@ static void TexDecoder_DecodeImpl_IA4(u32* dst, const u8* src, int width, int he
                                       TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt,
                                       int Wsteps4, int Wsteps8)
 {
+  const __m128i kMask_x0f = _mm_set1_epi32(0x0f0f0f0fL);
   for (int y = 0; y < height; y += 4)
   {
     for (int x = 0, yStep = (y / 4) * Wsteps8; x < width; x += 8, yStep++)
     {
       for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
       {
-        DecodeBytes_IA4(dst + (y + iy) * width + x, src + 8 * xStep);
+        // Load 8x 8-bit IA4 samples, each holding alpha in the high nibble and intensity in the
+        // low nibble.
+        const __m128i r0 = _mm_loadl_epi64((const __m128i*)(src + 8 * xStep));
+
+        // Expand each nibble to 8 bits by copying it into the upper half of its byte. Shifting
+        // whole 16-bit lanes is fine since the masked values can't carry into the next byte.
+        const __m128i i4 = _mm_and_si128(r0, kMask_x0f);
+        const __m128i a4 = _mm_and_si128(_mm_srli_epi16(r0, 4), kMask_x0f);
+        const __m128i i8 = _mm_or_si128(i4, _mm_slli_epi16(i4, 4));
+        const __m128i a8 = _mm_or_si128(a4, _mm_slli_epi16(a4, 4));
+
+        // Interleave into (i, i, i, a) for each texel.
+        const __m128i ii = _mm_unpacklo_epi8(i8, i8);
+        const __m128i ia = _mm_unpacklo_epi8(i8, a8);
+        __m128i* ptr = (__m128i*)(dst + (y + iy) * width + x);
+        _mm_storeu_si128(ptr, _mm_unpacklo_epi16(ii, ia));
+        _mm_storeu_si128(ptr + 1, _mm_unpackhi_epi16(ii, ia));
       }
     }
   }
@@ -4,6 +4,7 @@
 #include "VideoCommon/VertexLoaderManager.h"
 
 #include <algorithm>
+#include <atomic>
 #include <iterator>
 #include <memory>
 #include <mutex>
@@ -15,8 +16,11 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/EnumMap.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
 #include "Common/Logging/Log.h"
 
+#include "Core/ConfigManager.h"
 #include "Core/DolphinAnalytics.h"
 #include "Core/HW/Memmap.h"
 #include "Core/System.h"
@@ -25,6 +29,7 @@
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/CPMemory.h"
 #include "VideoCommon/DataReader.h"
+#include "VideoCommon/FrontendTimers.h"
 #include "VideoCommon/IndexGenerator.h"
 #include "VideoCommon/NativeVertexFormat.h"
 #include "VideoCommon/Statistics.h"
@@ -51,7 +56,28 @@ u32 g_current_components;
 typedef std::unordered_map<VertexLoaderUID, std::unique_ptr<VertexLoaderBase>> VertexLoaderMap;
 static std::mutex s_vertex_loader_map_lock;
 static VertexLoaderMap s_vertex_loader_map;
-// TODO - change into array of pointers. Keep a map of all seen so far.
+
+// Loaders are looked up from both the CPU thread (preprocessing) and the GPU thread, but they are
+// only removed on shutdown. So lookups go through an open addressing table of pointers to the map
+// entries, which never move, without taking s_vertex_loader_map_lock. The lock is only needed to
+// add loaders, or to find them in the map if the table is full.
+constexpr size_t VERTEX_LOADER_TABLE_SIZE = 1024;
+static std::array<std::atomic<const VertexLoaderMap::value_type*>, VERTEX_LOADER_TABLE_SIZE>
+    s_vertex_loader_table;
+
+// The UIDs of all loaders a game has used are saved, so that the loaders can be created before
+// they are needed the next time it is started.
+constexpr u32 VERTEX_LOADER_CACHE_MAGIC = 0x52444C56;  // VLDR
+constexpr u32 VERTEX_LOADER_CACHE_VERSION = 1;
+struct SerializedVertexLoaderUID
+{
+  u32 vtx_desc_low;
+  u32 vtx_desc_high;
+  u32 vat_g0;
+  u32 vat_g1;
+  u32 vat_g2;
+};
+static File::IOFile s_vertex_loader_cache_file;
 
 Common::EnumMap<u8*, CPArray::TexCoord7> cached_arraybases;
 
@@ -62,6 +88,115 @@ std::array<VertexLoaderBase*, CP_NUM_VAT_REG> g_main_vertex_loaders;
 std::array<VertexLoaderBase*, CP_NUM_VAT_REG> g_preprocess_vertex_loaders;
 bool g_needs_cp_xf_consistency_check;
 
+static VertexLoaderBase* FindLoader(const VertexLoaderUID& uid)
+{
+  for (size_t i = 0; i < VERTEX_LOADER_TABLE_SIZE; ++i)
+  {
+    const size_t index = (uid.GetHash() + i) % VERTEX_LOADER_TABLE_SIZE;
+    const VertexLoaderMap::value_type* entry =
+        s_vertex_loader_table[index].load(std::memory_order_acquire);
+    if (!entry)
+      return nullptr;
+    if (entry->first == uid)
+      return entry->second.get();
+  }
+  return nullptr;
+}
+
+static void AppendLoaderUIDLocked(const VertexLoaderUID& uid)
+{
+  if (!s_vertex_loader_cache_file.IsOpen())
+    return;
+
+  const TVtxDesc vtx_desc = uid.GetVertexDesc();
+  const VAT vat = uid.GetVAT();
+  const SerializedVertexLoaderUID serialized{vtx_desc.low.Hex, vtx_desc.high.Hex, vat.g0.Hex,
+                                             vat.g1.Hex, vat.g2.Hex};
+  s_vertex_loader_cache_file.WriteBytes(&serialized, sizeof(serialized));
+}
+
+static VertexLoaderBase* CreateLoaderLocked(const VertexLoaderUID& uid)
+{
+  const auto iter =
+      s_vertex_loader_map
+          .emplace(uid, VertexLoaderBase::CreateVertexLoader(uid.GetVertexDesc(), uid.GetVAT()))
+          .first;
+  INCSTAT(g_stats.num_vertex_loaders);
+
+  // If the table is full, the loader can still be found in the map.
+  for (size_t i = 0; i < VERTEX_LOADER_TABLE_SIZE; ++i)
+  {
+    auto& slot = s_vertex_loader_table[(uid.GetHash() + i) % VERTEX_LOADER_TABLE_SIZE];
+    if (!slot.load(std::memory_order_relaxed))
+    {
+      slot.store(&*iter, std::memory_order_release);
+      break;
+    }
+  }
+  return iter->second.get();
+}
+
+static void LoadLoaderCacheLocked()
+{
+  const std::string filename =
+      File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID() + ".vtxloadercache";
+
+  std::vector<SerializedVertexLoaderUID> uids;
+  if (s_vertex_loader_cache_file.Open(filename, "rb+"))
+  {
+    // Ignore a partially written UID at the end, but keep the rest of the file.
+    u32 magic = 0;
+    u32 version = 0;
+    const u64 header_size = sizeof(magic) + sizeof(version);
+    const u64 file_size = s_vertex_loader_cache_file.GetSize();
+    bool valid = s_vertex_loader_cache_file.ReadBytes(&magic, sizeof(magic)) &&
+                 s_vertex_loader_cache_file.ReadBytes(&version, sizeof(version)) &&
+                 magic == VERTEX_LOADER_CACHE_MAGIC && version == VERTEX_LOADER_CACHE_VERSION;
+    if (valid)
+    {
+      uids.resize((file_size - header_size) / sizeof(SerializedVertexLoaderUID));
+      const u64 expected_size = header_size + uids.size() * sizeof(SerializedVertexLoaderUID);
+      valid = s_vertex_loader_cache_file.ReadArray(uids.data(), uids.size()) &&
+              s_vertex_loader_cache_file.Resize(expected_size) &&
+              s_vertex_loader_cache_file.Seek(expected_size, File::SeekOrigin::Begin);
+    }
+
+    if (!valid)
+    {
+      uids.clear();
+      s_vertex_loader_cache_file.Close();
+    }
+  }
+
+  if (!s_vertex_loader_cache_file.IsOpen() && s_vertex_loader_cache_file.Open(filename, "wb"))
+  {
+    s_vertex_loader_cache_file.WriteBytes(&VERTEX_LOADER_CACHE_MAGIC,
+                                          sizeof(VERTEX_LOADER_CACHE_MAGIC));
+    s_vertex_loader_cache_file.WriteBytes(&VERTEX_LOADER_CACHE_VERSION,
+                                          sizeof(VERTEX_LOADER_CACHE_VERSION));
+    for (const auto& entry : s_vertex_loader_map)
+      AppendLoaderUIDLocked(entry.first);
+  }
+
+  // Create the loaders now, rather than while the game is running. Native vertex formats are only
+  // created once a loader is first used, since that has to happen on the GPU thread.
+  for (const SerializedVertexLoaderUID& serialized : uids)
+  {
+    TVtxDesc vtx_desc;
+    vtx_desc.low.Hex = serialized.vtx_desc_low;
+    vtx_desc.high.Hex = serialized.vtx_desc_high;
+    VAT vat;
+    vat.g0.Hex = serialized.vat_g0;
+    vat.g1.Hex = serialized.vat_g1;
+    vat.g2.Hex = serialized.vat_g2;
+    const VertexLoaderUID uid(vtx_desc, vat);
+    if (!s_vertex_loader_map.contains(uid))
+      CreateLoaderLocked(uid);
+  }
+
+  INFO_LOG_FMT(VIDEO, "Created {} vertex loaders from {}", uids.size(), filename);
+}
+
 void Init()
 {
   MarkAllDirty();
@@ -70,9 +205,21 @@ void Init()
   SETSTAT(g_stats.num_vertex_loaders, 0);
 }
 
+void LoadLoaderCache()
+{
+  if (!g_ActiveConfig.bShaderCache)
+    return;
+
+  std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
+  LoadLoaderCacheLocked();
+}
+
 void Clear()
 {
   std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
+  s_vertex_loader_cache_file.Close();
+  for (auto& slot : s_vertex_loader_table)
+    slot.store(nullptr, std::memory_order_relaxed);
   s_vertex_loader_map.clear();
   s_native_vertex_map.clear();
 }
@@ -215,29 +362,26 @@ VertexLoaderBase* GetOrCreateLoader(int vtx_attr_group)
   constexpr auto& vertex_loaders =
       IsPreprocess ? g_preprocess_vertex_loaders : g_main_vertex_loaders;
 
-  VertexLoaderBase* loader;
-
-  // We are not allowed to create a native vertex format on preprocessing as this is on the wrong
-  // thread
-  bool check_for_native_format = !IsPreprocess;
-
   VertexLoaderUID uid(state->vtx_desc, state->vtx_attr[vtx_attr_group]);
-  std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
-  VertexLoaderMap::iterator iter = s_vertex_loader_map.find(uid);
-  if (iter != s_vertex_loader_map.end())
-  {
-    loader = iter->second.get();
-    check_for_native_format &= !loader->m_native_vertex_format;
-  }
-  else
+  VertexLoaderBase* loader = FindLoader(uid);
+  if (!loader) [[unlikely]]
   {
-    auto [it, added] = s_vertex_loader_map.try_emplace(
-        uid,
-        VertexLoaderBase::CreateVertexLoader(state->vtx_desc, state->vtx_attr[vtx_attr_group]));
-    loader = it->second.get();
-    INCSTAT(g_stats.num_vertex_loaders);
+    std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
+    const auto iter = s_vertex_loader_map.find(uid);
+    if (iter != s_vertex_loader_map.end())
+    {
+      loader = iter->second.get();
+    }
+    else
+    {
+      loader = CreateLoaderLocked(uid);
+      AppendLoaderUIDLocked(uid);
+    }
   }
-  if (check_for_native_format)
+
+  // We are not allowed to create a native vertex format on preprocessing as this is on the wrong
+  // thread
+  if (!IsPreprocess && !loader->m_native_vertex_format)
   {
     // search for a cached native vertex format
     loader->m_native_vertex_format = GetOrCreateMatchingFormat(loader->m_native_vtx_decl);
@@ -399,6 +543,8 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
     return 0;
   ASSERT(count > 0);
 
+  FrontendTimers::ScopedTimer timer(FrontendTimers::Timer::VertexLoading, !IsPreprocess);
+
   VertexLoaderBase* loader = RefreshLoader<IsPreprocess>(vtx_attr_group);
 
   int size = count * loader->m_vertex_size;
@@ -28,6 +28,10 @@ using NativeVertexFormatMap =
 void Init();
 void Clear();
 
+// Creates the vertex loaders used by previous sessions of the current game, and records new ones
+// from now on. Has to be called after the active config has been updated.
+void LoadLoaderCache();
+
 void MarkAllDirty();
 
 // Creates or obtains a pointer to a VertexFormat representing decl.
@@ -24,6 +24,7 @@
 #include "VideoCommon/BoundingBox.h"
 #include "VideoCommon/DataReader.h"
 #include "VideoCommon/FramebufferManager.h"
+#include "VideoCommon/FrontendTimers.h"
 #include "VideoCommon/GeometryShaderManager.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/CustomShaderCache.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModActionData.h"
@@ -438,6 +439,8 @@ void VertexManagerBase::Flush()
   if (m_is_flushed)
     return;
 
+  FrontendTimers::ScopedTimer timer(FrontendTimers::Timer::VertexManagerFlush);
+
   m_is_flushed = true;
 
   if (m_draw_counter == 0)
@@ -403,6 +403,7 @@ bool VideoBackendBase::InitializeShared(std::unique_ptr<AbstractGfx> gfx,
   }
 
   g_shader_cache->InitializeShaderCache();
+  VertexLoaderManager::LoadLoaderCache();
 
   return true;
 }
@@ -276,6 +276,15 @@ struct VideoConfig final
   int iShaderCompilerThreads = 0;
   int iShaderPrecompilerThreads = 0;
 
+  // Number of threads that help decode large textures on the CPU.
+  // 0 decodes on the GPU thread only.
+  // -1 uses an automatic number based on the CPU threads.
+  int iTextureDecodingThreads = 0;
+
+  // Keep textures decoded on the CPU in a per-game file, limited to the given size in MiB.
+  bool bTextureDiskCache = false;
+  int iTextureDiskCacheSize = 0;
+
   // Loading custom drivers on Android
   std::string customDriverLibraryName;
 
@@ -382,6 +391,7 @@ struct VideoConfig final
   bool UsingUberShaders() const;
   u32 GetShaderCompilerThreads() const;
   u32 GetShaderPrecompilerThreads() const;
+  u32 GetTextureDecodingThreads() const;
 
   float GetCustomAspectRatio() const { return (float)custom_aspect_width / custom_aspect_height; }
 };
@@ -0,0 +1,127 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Crypto/AES.h"
+#include "Common/Timer.h"
+
+using Common::AES::Context;
+
+namespace
+{
+// NIST SP 800-38A, F.2.1 CBC-AES128.Encrypt
+constexpr std::array<u8, 16> KEY{0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+                                 0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c};
+constexpr std::array<u8, 16> IV{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+                                0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f};
+constexpr std::array<u8, 32> PLAINTEXT{
+    0x6b, 0xc1, 0xbe, 0xe2, 0x2e, 0x40, 0x9f, 0x96, 0xe9, 0x3d, 0x7e, 0x11, 0x73, 0x93, 0x17, 0x2a,
+    0xae, 0x2d, 0x8a, 0x57, 0x1e, 0x03, 0xac, 0x9c, 0x9e, 0xb7, 0x6f, 0xac, 0x45, 0xaf, 0x8e, 0x51};
+constexpr std::array<u8, 32> CIPHERTEXT{
+    0x76, 0x49, 0xab, 0xac, 0x81, 0x19, 0xb2, 0x46, 0xce, 0xe9, 0x8e, 0x9b, 0x12, 0xe9, 0x19, 0x7d,
+    0x50, 0x86, 0xcb, 0x9b, 0x50, 0x72, 0x19, 0xee, 0x95, 0xdb, 0x11, 0x3a, 0x91, 0x76, 0x78, 0xb2};
+
+// Same layout as the data of a Wii disc group
+constexpr size_t BLOCK_SIZE = 0x7C00;
+constexpr size_t BLOCKS = 64;
+
+std::vector<u8> MakeData(size_t size)
+{
+  std::vector<u8> data(size);
+  for (size_t i = 0; i < size; ++i)
+    data[i] = static_cast<u8>(i * 31 + (i >> 8));
+  return data;
+}
+}  // namespace
+
+TEST(AES, Vectors)
+{
+  std::array<u8, 32> out;
+  std::array<u8, 16> iv_out;
+
+  ASSERT_TRUE(Common::AES::CreateContextEncrypt(KEY.data())
+                  ->Crypt(IV.data(), iv_out.data(), PLAINTEXT.data(), out.data(), out.size()));
+  EXPECT_EQ(CIPHERTEXT, out);
+
+  ASSERT_TRUE(Common::AES::CreateContextDecrypt(KEY.data())
+                  ->Crypt(IV.data(), iv_out.data(), CIPHERTEXT.data(), out.data(), out.size()));
+  EXPECT_EQ(PLAINTEXT, out);
+}
+
+TEST(AES, BatchMatchesCrypt)
+{
+  // Not a multiple of the batch size, so that both the batched and the remaining items are tested
+  constexpr size_t count = 19;
+  constexpr size_t len = 0x40;
+  const std::vector<u8> in = MakeData(count * len);
+
+  for (auto* create : {&Common::AES::CreateContextEncrypt, &Common::AES::CreateContextDecrypt})
+  {
+    const auto context = create(KEY.data());
+
+    std::vector<u8> expected(in.size());
+    std::vector<u8> actual(in.size());
+    std::vector<Context::BatchItem> items(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+      const u8* iv = i % 3 == 0 ? nullptr : &in[i * len + 1];
+      ASSERT_TRUE(context->Crypt(iv, nullptr, &in[i * len], &expected[i * len], len));
+      items[i] = {iv, &in[i * len], &actual[i * len]};
+    }
+
+    ASSERT_TRUE(context->CryptBatch(items, len));
+    EXPECT_EQ(expected, actual);
+  }
+}
+
+// Measures how much batching helps. The throughput is recorded in the test results instead of
+// being checked, as it depends on the machine.
+TEST(AES, Throughput)
+{
+  const std::vector<u8> in = MakeData(BLOCKS * BLOCK_SIZE);
+
+  const auto measure = [&](const std::string& name, std::vector<u8>& out, const auto& function) {
+    constexpr int iterations = 50;
+    out.resize(in.size());
+    const u64 start = Common::Timer::NowUs();
+    for (int i = 0; i < iterations; ++i)
+      ASSERT_TRUE(function(out));
+    const u64 elapsed = std::max<u64>(Common::Timer::NowUs() - start, 1);
+    RecordProperty(name + "_mb_per_second",
+                   std::to_string(static_cast<u64>(double(in.size()) * iterations / elapsed)));
+  };
+
+  for (auto* create : {&Common::AES::CreateContextEncrypt, &Common::AES::CreateContextDecrypt})
+  {
+    const auto context = create(KEY.data());
+    const std::string mode = create == &Common::AES::CreateContextEncrypt ? "encrypt" : "decrypt";
+
+    std::vector<u8> single_out;
+    measure(mode + "_single", single_out, [&](std::vector<u8>& out) {
+      for (size_t i = 0; i < BLOCKS; ++i)
+      {
+        if (!context->CryptIvZero(&in[i * BLOCK_SIZE], &out[i * BLOCK_SIZE], BLOCK_SIZE))
+          return false;
+      }
+      return true;
+    });
+
+    std::vector<u8> batched_out;
+    measure(mode + "_batched", batched_out, [&](std::vector<u8>& out) {
+      std::vector<Context::BatchItem> items(BLOCKS);
+      for (size_t i = 0; i < BLOCKS; ++i)
+        items[i] = {nullptr, &in[i * BLOCK_SIZE], &out[i * BLOCK_SIZE]};
+      return context->CryptBatch(items, BLOCK_SIZE);
+    });
+
+    EXPECT_EQ(single_out, batched_out) << mode;
+  }
+}
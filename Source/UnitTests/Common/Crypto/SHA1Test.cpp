@@ -1,6 +1,13 @@
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <vector>
+
 #include <gtest/gtest.h>
 
+#include "Common/CommonTypes.h"
 #include "Common/Crypto/SHA1.h"
+#include "Common/Timer.h"
 
 // Just a few quick sanity checks
 TEST(SHA1, Vectors)
@@ -28,3 +35,40 @@ TEST(SHA1, Vectors)
     EXPECT_EQ(test.expected, actual);
   }
 }
+
+TEST(SHA1, CalculateDigests)
+{
+  // The H0 hashes of a Wii disc block
+  constexpr size_t len = 0x400;
+  constexpr size_t count = 31;
+  std::vector<u8> msgs(len * count);
+  for (size_t i = 0; i < msgs.size(); ++i)
+    msgs[i] = static_cast<u8>(i * 7 + (i >> 10));
+
+  std::vector<Common::SHA1::Digest> digests(count);
+  Common::SHA1::CalculateDigests(msgs.data(), len, count, digests.data());
+  for (size_t i = 0; i < count; ++i)
+    EXPECT_EQ(Common::SHA1::CalculateDigest(&msgs[i * len], len), digests[i]);
+}
+
+// The throughput is recorded in the test results instead of being checked, as it depends on the
+// machine.
+TEST(SHA1, Throughput)
+{
+  constexpr size_t len = 0x400;
+  constexpr size_t count = 0x800;
+  constexpr int iterations = 50;
+  const std::vector<u8> msgs(len * count, 0xa5);
+  std::vector<Common::SHA1::Digest> digests(count);
+
+  const u64 start = Common::Timer::NowUs();
+  for (int i = 0; i < iterations; ++i)
+    Common::SHA1::CalculateDigests(msgs.data(), len, count, digests.data());
+  const u64 elapsed = std::max<u64>(Common::Timer::NowUs() - start, 1);
+  RecordProperty("mb_per_second",
+                 std::to_string(static_cast<u64>(double(msgs.size()) * iterations / elapsed)));
+
+  const Common::SHA1::Digest expected = Common::SHA1::CalculateDigest(msgs.data(), len);
+  for (const Common::SHA1::Digest& digest : digests)
+    EXPECT_EQ(expected, digest);
+}
@@ -0,0 +1,114 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+#include "Core/HW/DSPHLE/UCodes/AXMixing.h"
+
+using namespace DSP::HLE;
+
+namespace
+{
+// Frame sizes used by the ucodes (1 ms GC, 3 ms Wii, Wii Remote) and a few odd ones for the
+// scalar tails.
+constexpr std::array<u32, 9> COUNTS = {0, 1, 3, 5, 6, 18, 32, 95, 96};
+
+// Volumes and deltas chosen to hit clamping and 16-bit wraparound during a frame.
+constexpr std::array<u16, 6> VOLUMES = {0x0000, 0x7FFF, 0x8000, 0xFFFF, 0xFFF0, 0x1234};
+constexpr std::array<u16, 6> DELTAS = {0x0000, 0x0001, 0xFFFF, 0x0800, 0xF800, 0x7FFF};
+
+std::vector<s16> RandomSamples(std::mt19937& rng, u32 count)
+{
+  std::uniform_int_distribution<int> dist(-0x8000, 0x7FFF);
+  std::vector<s16> samples(count);
+  for (s16& sample : samples)
+  {
+    // Bias towards full scale so that the products overflow 16 bits.
+    const int value = dist(rng);
+    sample = static_cast<s16>((value & 3) == 0 ? (value < 0 ? -0x8000 : 0x7FFF) : value);
+  }
+  return samples;
+}
+}  // namespace
+
+TEST(AXMixing, MixAddSSE41MatchesScalar)
+{
+#ifdef _M_X86_64
+  if (!cpu_info.bSSE4_1)
+    GTEST_SKIP() << "SSE4.1 is not supported";
+
+  std::mt19937 rng(1234);
+  std::uniform_int_distribution<int> out_dist(-0x100000, 0x100000);
+
+  for (u32 count : COUNTS)
+  {
+    for (u16 initial_volume : VOLUMES)
+    {
+      for (u16 delta : DELTAS)
+      {
+        const std::vector<s16> input = RandomSamples(rng, count);
+        std::vector<int> expected_out(count);
+        for (int& value : expected_out)
+          value = out_dist(rng);
+        std::vector<int> out = expected_out;
+
+        u16 expected_volume = initial_volume;
+        u16 volume = initial_volume;
+        s16 expected_dpop = 0x1111;
+        s16 dpop = 0x1111;
+        AXMixing::MixAddScalar(expected_out.data(), input.data(), count, expected_volume, delta,
+                               expected_dpop);
+        AXMixing::MixAddSSE41(out.data(), input.data(), count, volume, delta, dpop);
+
+        EXPECT_EQ(out, expected_out) << count << " " << initial_volume << " " << delta;
+        EXPECT_EQ(volume, expected_volume);
+        EXPECT_EQ(dpop, expected_dpop);
+      }
+    }
+  }
+#else
+  GTEST_SKIP() << "No SIMD implementation on this architecture";
+#endif
+}
+
+TEST(AXMixing, ApplyVolumeEnvelopeSSE41MatchesScalar)
+{
+#ifdef _M_X86_64
+  if (!cpu_info.bSSE4_1)
+    GTEST_SKIP() << "SSE4.1 is not supported";
+
+  std::mt19937 rng(5678);
+
+  for (bool signed_volume : {true, false})
+  {
+    for (u32 count : COUNTS)
+    {
+      for (u16 initial_volume : VOLUMES)
+      {
+        for (u16 delta : DELTAS)
+        {
+          std::vector<s16> expected = RandomSamples(rng, count);
+          std::vector<s16> samples = expected;
+
+          u16 expected_volume = initial_volume;
+          u16 volume = initial_volume;
+          AXMixing::ApplyVolumeEnvelopeScalar(expected.data(), count, expected_volume, delta,
+                                              signed_volume);
+          AXMixing::ApplyVolumeEnvelopeSSE41(samples.data(), count, volume, delta, signed_volume);
+
+          EXPECT_EQ(samples, expected) << count << " " << initial_volume << " " << delta;
+          EXPECT_EQ(volume, expected_volume);
+        }
+      }
+    }
+  }
+#else
+  GTEST_SKIP() << "No SIMD implementation on this architecture";
+#endif
+}
@@ -0,0 +1,192 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Core/HW/DSP.h"
+#include "Core/System.h"
+
+#define AX_GC
+#include "Core/HW/DSPHLE/UCodes/AXVoice.h"
+
+using namespace DSP::HLE;
+
+namespace
+{
+constexpr u32 SPMS = 32;
+constexpr u32 NUM_SUBFRAMES = 5;
+constexpr u32 BUFFER_SIZE = NUM_SUBFRAMES * SPMS;
+constexpr u32 NUM_BUFFERS = 9;
+
+constexpr u32 MIX_CONTROLS =
+    MIX_MAIN_L | MIX_MAIN_L_RAMP | MIX_MAIN_R | MIX_MAIN_S | MIX_MAIN_S_RAMP | MIX_AUXA_L |
+    MIX_AUXA_R | MIX_AUXA_R_RAMP | MIX_AUXA_S | MIX_AUXB_L | MIX_AUXB_L_RAMP | MIX_AUXB_R |
+    MIX_AUXB_S | MIX_AUXB_S_RAMP;
+
+struct Voice
+{
+  AXPB pb;
+  PBUpdateData updates;
+};
+
+std::vector<Voice> MakeVoices(std::mt19937& rng)
+{
+  std::uniform_int_distribution<u32> dist;
+  const auto random16 = [&] { return static_cast<u16>(dist(rng)); };
+
+  constexpr std::array<u16, 3> SAMPLE_FORMATS = {0x00, 0x0A, 0x19};
+  constexpr std::array<u16, 3> SRC_TYPES = {SRCTYPE_LINEAR, SRCTYPE_NEAREST, SRCTYPE_POLYPHASE};
+
+  std::vector<Voice> voices;
+  for (u32 i = 0; i < 12; ++i)
+  {
+    Voice& voice = voices.emplace_back();
+    auto pb_mem = Common::BitCastToArray<u16>(voice.pb);
+    for (u16& value : pb_mem)
+      value = random16();
+    voice.pb = std::bit_cast<AXPB>(pb_mem);
+
+    AXPB& pb = voice.pb;
+    pb.running = 1;
+    pb.is_stream = i % 2;
+    pb.initial_time_delay.on = 0;
+    pb.src_type = SRC_TYPES[i % SRC_TYPES.size()];
+    // Between a quarter and four times the output rate
+    pb.src.ratio_hi = static_cast<u16>(dist(rng) % 4);
+    pb.src.ratio_lo = random16();
+    if (pb.src.ratio_hi == 0)
+      pb.src.ratio_lo |= 0x4000;
+
+    // Short looping samples, so that the end of the sample is reached within a frame
+    const u32 start = 0x1000 + i * 0x400;
+    pb.audio_addr.looping = i % 3 != 0;
+    pb.audio_addr.sample_format = SAMPLE_FORMATS[i % SAMPLE_FORMATS.size()];
+    pb.audio_addr.loop_addr_hi = static_cast<u16>(start >> 16);
+    pb.audio_addr.loop_addr_lo = static_cast<u16>(start);
+    pb.audio_addr.end_addr_hi = static_cast<u16>((start + 0x80) >> 16);
+    pb.audio_addr.end_addr_lo = static_cast<u16>(start + 0x80);
+    pb.audio_addr.cur_addr_hi = static_cast<u16>((start + 0x10) >> 16);
+    pb.audio_addr.cur_addr_lo = static_cast<u16>(start + 0x10);
+    pb.adpcm.pred_scale &= 0x7f;
+    pb.adpcm_loop_info.pred_scale &= 0x7f;
+
+    pb.lpf.on = i % 2;
+
+    // Updates change the volumes between subframes, which both halves of the split have to see
+    u32 num_updates = 0;
+    for (u16& subframe_updates : pb.updates.num_updates)
+    {
+      subframe_updates = static_cast<u16>(dist(rng) % 3);
+      for (u32 j = 0; j < subframe_updates; ++j)
+      {
+        voice.updates[num_updates].pb_offset =
+            static_cast<u16>(offsetof(AXPB, mixer) / 2 + dist(rng) % (sizeof(PBMixer) / 2));
+        voice.updates[num_updates].new_value = random16();
+        ++num_updates;
+      }
+    }
+  }
+  return voices;
+}
+
+void FillARAM(DSP::DSPManager& dsp, const std::vector<u8>& contents)
+{
+  for (u32 address = 0; address < contents.size(); ++address)
+    dsp.WriteARAM(contents[address], address);
+}
+
+AXBuffers MakeBuffers(std::vector<int>& samples)
+{
+  AXBuffers buffers{};
+  for (u32 i = 0; i < NUM_BUFFERS; ++i)
+    buffers.ptrs[i] = &samples[i * BUFFER_SIZE];
+  return buffers;
+}
+}  // namespace
+
+// Asynchronous mixing splits each voice into DecodeVoice on the CPU thread and MixVoice on a
+// worker, which mixes into zeroed buffers that are then added to the real ones. This has to give
+// exactly the same samples and PBs as ProcessVoice mixing in place.
+TEST(AXVoice, AsyncMixingMatchesSyncMixing)
+{
+  auto& dsp = Core::System::GetInstance().GetDSP();
+  dsp.Reinit(true);
+
+  std::mt19937 rng(0xa5);
+  const std::vector<Voice> voices = MakeVoices(rng);
+
+  std::vector<int> initial_samples(NUM_BUFFERS * BUFFER_SIZE);
+  std::uniform_int_distribution<int> sample_dist(-0x100000, 0x100000);
+  for (int& sample : initial_samples)
+    sample = sample_dist(rng);
+
+  std::vector<u8> aram(0x10000);
+  std::uniform_int_distribution<u32> byte_dist(0, 255);
+  for (u8& byte : aram)
+    byte = static_cast<u8>(byte_dist(rng));
+
+  const auto mixer_control = [](const AXPB&) { return static_cast<AXMixControl>(MIX_CONTROLS); };
+
+  // Synchronous: decode and mix each subframe in place
+  FillARAM(dsp, aram);
+  HLEAccelerator sync_accelerator(dsp);
+  std::vector<int> sync_samples = initial_samples;
+  std::vector<AXPB> sync_pbs;
+  for (const Voice& voice : voices)
+  {
+    AXBuffers buffers = MakeBuffers(sync_samples);
+    AXPB pb = voice.pb;
+    for (u32 curr_ms = 0; curr_ms < NUM_SUBFRAMES; ++curr_ms)
+    {
+      ApplyUpdatesForMs(curr_ms, pb, pb.updates.num_updates, voice.updates);
+      ProcessVoice(&sync_accelerator, pb, buffers, SPMS, mixer_control(pb), nullptr, false);
+      for (auto& ptr : buffers.ptrs)
+        ptr += SPMS;
+    }
+    sync_pbs.push_back(pb);
+  }
+
+  // Asynchronous: decode everything first, then mix on another thread
+  FillARAM(dsp, aram);
+  HLEAccelerator async_accelerator(dsp);
+  std::vector<AsyncVoice> async_voices(voices.size());
+  for (size_t i = 0; i < voices.size(); ++i)
+  {
+    AsyncVoice& async_voice = async_voices[i];
+    async_voice.initial_pb = voices[i].pb;
+    async_voice.updates = voices[i].updates;
+    async_voice.apply_updates = true;
+    async_voice.num_subframes = NUM_SUBFRAMES;
+    async_voice.samples_per_subframe = SPMS;
+    DecodeAsyncVoice(&async_accelerator, async_voice, nullptr, false, mixer_control);
+  }
+
+  std::vector<int> mixed_samples(NUM_BUFFERS * BUFFER_SIZE, 0);
+  std::thread mix_thread([&] {
+    const AXBuffers buffers = MakeBuffers(mixed_samples);
+    for (AsyncVoice& async_voice : async_voices)
+      MixAsyncVoice(async_voice, buffers, nullptr, false);
+  });
+  mix_thread.join();
+
+  std::vector<int> async_samples = initial_samples;
+  for (size_t i = 0; i < async_samples.size(); ++i)
+    async_samples[i] += mixed_samples[i];
+
+  EXPECT_EQ(async_samples, sync_samples);
+  for (size_t i = 0; i < voices.size(); ++i)
+  {
+    EXPECT_EQ(std::memcmp(&async_voices[i].decoded_pb, &sync_pbs[i], sizeof(AXPB)), 0)
+        << "PB " << i;
+  }
+
+  dsp.Shutdown();
+}
@@ -0,0 +1,293 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#ifdef _M_X86_64
+// gtest's TEST macro conflicts with the TEST method of the x64 emitter used by the DSP JIT. Only
+// TEST_F is used in this file.
+#undef TEST
+#endif
+
+#include "Common/CommonTypes.h"
+#include "Core/DSP/DSPAnalyzer.h"
+#include "Core/DSP/DSPCodeUtil.h"
+#include "Core/DSP/DSPCore.h"
+#include "Core/DSP/DSPTables.h"
+#ifdef _M_X86_64
+#include "Core/DSP/Jit/x64/DSPEmitter.h"
+#endif
+
+class DSPAnalyzerTest : public testing::Test
+{
+protected:
+  static void SetUpTestSuite() { DSP::InitInstructionTable(); }
+
+  void SetUp() override
+  {
+    m_iram.fill(0x0021);  // HALT
+    m_irom.fill(0x0021);
+    m_core.DSPState().iram = m_iram.data();
+    m_core.DSPState().irom = m_irom.data();
+    m_core.DSPState().dram = m_dram.data();
+  }
+
+  void TearDown() override
+  {
+    m_core.DSPState().iram = nullptr;
+    m_core.DSPState().irom = nullptr;
+    m_core.DSPState().dram = nullptr;
+  }
+
+  void Analyze(const char* text)
+  {
+    std::vector<u16> code;
+    ASSERT_TRUE(DSP::Assemble(text, code));
+    ASSERT_LE(code.size(), m_iram.size());
+    std::ranges::copy(code, m_iram.begin());
+    m_analyzer.Analyze(m_core.DSPState());
+  }
+
+  std::array<u16, DSP::DSP_IRAM_SIZE> m_iram{};
+  std::array<u16, DSP::DSP_IROM_SIZE> m_irom{};
+  std::array<u16, DSP::DSP_DRAM_SIZE> m_dram{};
+  DSP::DSPCore m_core;
+  DSP::Analyzer m_analyzer;
+};
+
+constexpr char MAILBOX_EQUS[] = R"(
+DSCR:	equ	0xffc9
+DMBH:	equ	0xfffc
+CMBH:	equ	0xfffe
+CMBL:	equ	0xffff
+)";
+
+TEST_F(DSPAnalyzerTest, FindsMailboxPollingLoops)
+{
+  const std::string text = std::string(MAILBOX_EQUS) + R"(
+	nop
+wait_cmbh:                  ; 0x0001
+	lr	$AC0.M, @CMBH
+	andf	$AC0.M, #0x8000
+	jlz	wait_cmbh
+wait_dmbh:                  ; 0x0007
+	lrs	$AC1.M, @DMBH
+	nop
+	cmpi	$AC1.M, #0x8000
+	jge	wait_dmbh
+	halt
+)";
+  Analyze(text.c_str());
+
+  EXPECT_TRUE(m_analyzer.IsIdleSkip(0x0001));
+  EXPECT_TRUE(m_analyzer.IsIdleSkip(0x0007));
+  EXPECT_FALSE(m_analyzer.IsIdleSkip(0x0000));
+  EXPECT_FALSE(m_analyzer.IsIdleSkip(0x0003));
+}
+
+TEST_F(DSPAnalyzerTest, IgnoresLoopsWithSideEffects)
+{
+  const std::string text = std::string(MAILBOX_EQUS) + R"(
+wait_cmbl:                  ; 0x0000: reading CMBL acknowledges the mail
+	lrs	$AC0.M, @CMBL
+	andf	$AC0.M, #0x8000
+	jlz	wait_cmbl
+count:                      ; 0x0005: the loop modifies state on every iteration
+	lrs	$AC0.M, @CMBH
+	addi	$AC1.M, #1
+	andcf	$AC0.M, #0x8000
+	jlnz	count
+wait_dma:                   ; 0x000c: not a mailbox
+	lrs	$AC1.M, @DSCR
+	andcf	$AC1.M, #0x4
+	jlz	wait_dma
+stack:                      ; 0x0011: loading into a stack register pushes it
+	lr	$ST0, @CMBH
+	andcf	$AC0.M, #0x8000
+	jlz	stack
+	halt
+)";
+  Analyze(text.c_str());
+
+  EXPECT_FALSE(m_analyzer.IsIdleSkip(0x0000));
+  EXPECT_FALSE(m_analyzer.IsIdleSkip(0x0005));
+  EXPECT_FALSE(m_analyzer.IsIdleSkip(0x000c));
+  EXPECT_FALSE(m_analyzer.IsIdleSkip(0x0011));
+}
+
+TEST_F(DSPAnalyzerTest, StillMatchesSignatures)
+{
+  // From AX: LRS $30, @DMBH / ANDCF $30, #0x8000 / JLZ
+  const std::string text = std::string(MAILBOX_EQUS) + R"(
+	nop
+wait:                       ; 0x0001
+	lrs	$AC0.M, @DMBH
+	andcf	$AC0.M, #0x8000
+	jlz	wait
+	ret
+)";
+  Analyze(text.c_str());
+
+  EXPECT_TRUE(m_analyzer.IsIdleSkip(0x0001));
+}
+
+#ifdef _M_X86_64
+class DSPBlockLinkingTest : public DSPAnalyzerTest
+{
+protected:
+  void Load(const std::string& text)
+  {
+    Analyze(text.c_str());
+    m_core.DSPState().GetAnalyzer().Analyze(m_core.DSPState());
+  }
+
+  // Runs the code from address 0 until it halts and returns the number of cycles it took.
+  u64 Run(DSP::JIT::x64::DSPEmitter& emitter)
+  {
+    DSP::SDSP& state = m_core.DSPState();
+    std::memset(&state.r, 0, sizeof(state.r));
+    std::ranges::fill(state.r.wr, 0xffff);
+    state.r.sr = DSP::SR_INT_ENABLE | DSP::SR_EXT_INT_ENABLE;
+    std::ranges::fill(state.reg_stack_ptrs, 0);
+    state.pc = 0;
+    state.control_reg = 0;
+    m_dram.fill(0);
+
+    constexpr u16 SLICE_CYCLES = 1000;
+    u64 cycles = 0;
+    for (int i = 0; i < 100000 && !(state.control_reg & DSP::CR_HALT); ++i)
+    {
+      // Blocks can overrun the slice, which leaves a negative number of cycles
+      cycles += SLICE_CYCLES - static_cast<s16>(emitter.RunCycles(SLICE_CYCLES));
+    }
+    EXPECT_TRUE(state.control_reg & DSP::CR_HALT);
+    return cycles;
+  }
+};
+
+// Counts the Collatz steps of every number below LIMIT into DRAM 0x0100, then the number of odd
+// step counts. This mixes forward and backward conditional jumps, conditional calls and a loop
+// which jumps back to the start of its own block.
+static std::string CollatzText(u16 limit)
+{
+  return "LIMIT:\tequ\t" + std::to_string(limit) + R"(
+	lri	$AR0, #0x0100
+	lri	$AR2, #0
+	lri	$AR3, #1
+next_number:
+	clr	$ACC0
+	mrr	$AC0.M, $AR3
+	lri	$AR1, #0
+step:
+	cmpi	$AC0.M, #1
+	jz	store
+	iar	$AR1
+	andcf	$AC0.M, #1
+	jlz	odd
+	lsr	$ACC0, #-1
+	jmp	step
+odd:
+	call	triple
+	jmp	step
+store:
+	srri	@$AR0, $AR1
+	clr	$ACC1
+	mrr	$AC1.M, $AR1
+	andcf	$AC1.M, #1
+	calllz	count_odd
+	clr	$ACC1
+	mrr	$AC1.M, $AR3
+delay:
+	decm	$AC1.M
+	jnz	delay
+	iar	$AR3
+	clr	$ACC1
+	mrr	$AC1.M, $AR3
+	cmpi	$AC1.M, #LIMIT
+	jnz	next_number
+	srri	@$AR0, $AR2
+	halt
+triple:
+	mov	$ACC1, $ACC0
+	add	$ACC0, $ACC1
+	add	$ACC0, $ACC1
+	incm	$AC0.M
+	ret
+count_odd:
+	iar	$AR2
+	ret
+)";
+}
+
+static std::vector<u16> CollatzResults(u16 limit)
+{
+  std::vector<u16> results;
+  u16 odd_step_counts = 0;
+  for (u32 n = 1; n < limit; ++n)
+  {
+    u16 steps = 0;
+    for (u32 value = n; value != 1; value = value % 2 ? value * 3 + 1 : value / 2)
+      ++steps;
+    results.push_back(steps);
+    odd_step_counts += steps % 2;
+  }
+  results.push_back(odd_step_counts);
+  return results;
+}
+
+TEST_F(DSPBlockLinkingTest, LinkedBranchesMatchUnlinkedBranches)
+{
+  constexpr u16 LIMIT = 28;
+  Load(CollatzText(LIMIT));
+  const std::vector<u16> expected = CollatzResults(LIMIT);
+
+  DSP::JIT::x64::DSPEmitter unlinked_emitter(m_core);
+  unlinked_emitter.SetBlockLinkingEnabled(false);
+  const u64 unlinked_cycles = Run(unlinked_emitter);
+  const DSP::DSP_Regs unlinked_regs = m_core.DSPState().r;
+  const auto unlinked_dram = m_dram;
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), m_dram.begin() + 0x100));
+
+  DSP::JIT::x64::DSPEmitter linked_emitter(m_core);
+  const u64 linked_cycles = Run(linked_emitter);
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), m_dram.begin() + 0x100));
+
+  EXPECT_EQ(linked_cycles, unlinked_cycles);
+  EXPECT_EQ(std::memcmp(&m_core.DSPState().r, &unlinked_regs, sizeof(unlinked_regs)), 0);
+  EXPECT_EQ(m_dram, unlinked_dram);
+}
+
+// Not a pass/fail check on speed: the DSP cycles per second with and without block linking are
+// recorded as test properties, which show up in the output of --gtest_output=xml.
+TEST_F(DSPBlockLinkingTest, Benchmark)
+{
+  constexpr u16 LIMIT = 256;
+  Load(CollatzText(LIMIT));
+  const std::vector<u16> expected = CollatzResults(LIMIT);
+
+  for (const bool link_blocks : {false, true})
+  {
+    DSP::JIT::x64::DSPEmitter emitter(m_core);
+    emitter.SetBlockLinkingEnabled(link_blocks);
+    // Compile everything before timing
+    Run(emitter);
+
+    u64 cycles = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 20; ++i)
+      cycles += Run(emitter);
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    EXPECT_TRUE(std::equal(expected.begin(), expected.end(), m_dram.begin() + 0x100));
+
+    RecordProperty(link_blocks ? "linked_cycles_per_second" : "unlinked_cycles_per_second",
+                   std::to_string(static_cast<u64>(cycles / elapsed.count())));
+  }
+}
+#endif
@@ -0,0 +1,229 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <optional>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Core/HW/DVD/DVDReadPlanner.h"
+#include "DiscIO/Volume.h"
+
+using DVD::ReadPlanner;
+
+namespace
+{
+constexpr DiscIO::Partition PARTITION_A(0x50000);
+constexpr DiscIO::Partition PARTITION_B(0xF800000);
+constexpr u64 BLOCK_SIZE = 0x8000;
+
+// A single file in PARTITION_A
+constexpr u64 FILE_START = 0x100000;
+constexpr u64 FILE_END = FILE_START + 4 * ReadPlanner::PREFETCH_SIZE + BLOCK_SIZE;
+
+class DVDReadPlannerTest : public testing::Test
+{
+protected:
+  DVDReadPlannerTest()
+      : m_planner([this](const DiscIO::Partition& partition, u64 offset) -> std::optional<u64> {
+          ++m_file_lookups;
+          if (partition == PARTITION_A && offset >= FILE_START && offset < FILE_END)
+            return FILE_END;
+          return std::nullopt;
+        })
+  {
+  }
+
+  // Reads the given range as a single run and returns what would be prefetched afterwards
+  std::optional<ReadPlanner::Range> Read(u64 dvd_offset, u64 length,
+                                         const DiscIO::Partition& partition = PARTITION_A)
+  {
+    return m_planner.PlanPrefetch({MakeRun(dvd_offset, length, partition)});
+  }
+
+  static ReadPlanner::Run MakeRun(u64 dvd_offset, u64 length,
+                                  const DiscIO::Partition& partition = PARTITION_A)
+  {
+    return {dvd_offset, length, partition, 0, 1};
+  }
+
+  ReadPlanner m_planner;
+  int m_file_lookups = 0;
+};
+
+void ExpectRun(const ReadPlanner::Run& run, u64 dvd_offset, u64 length, size_t first_request,
+               size_t end_request)
+{
+  EXPECT_EQ(run.dvd_offset, dvd_offset);
+  EXPECT_EQ(run.length, length);
+  EXPECT_EQ(run.first_request, first_request);
+  EXPECT_EQ(run.end_request, end_request);
+}
+}  // namespace
+
+TEST(DVDReadPlanner, AdjacentRequestsAreMerged)
+{
+  const std::vector<ReadPlanner::Range> requests{{0x10000, BLOCK_SIZE, PARTITION_A},
+                                                 {0x18000, BLOCK_SIZE, PARTITION_A},
+                                                 {0x20000, 0x20, PARTITION_A},
+                                                 {0x20020, 0x40, PARTITION_A}};
+
+  const std::vector<ReadPlanner::Run> runs = ReadPlanner::GetRuns(requests, 1);
+  ASSERT_EQ(runs.size(), 1u);
+  ExpectRun(runs[0], 0x10000, 2 * BLOCK_SIZE + 0x60, 0, 4);
+  EXPECT_EQ(runs[0].partition, PARTITION_A);
+}
+
+TEST(DVDReadPlanner, NonAdjacentRequestsAreNotMerged)
+{
+  const std::vector<ReadPlanner::Range> requests{
+      {0x10000, BLOCK_SIZE, PARTITION_A},
+      // Gap
+      {0x20000, BLOCK_SIZE, PARTITION_A},
+      // Adjacent, but in another partition
+      {0x28000, BLOCK_SIZE, PARTITION_B},
+      // Precedes the previous request instead of following it
+      {0x20000, BLOCK_SIZE, PARTITION_B},
+      // Overlaps the previous request
+      {0x24000, BLOCK_SIZE, PARTITION_B},
+  };
+
+  const std::vector<ReadPlanner::Run> runs = ReadPlanner::GetRuns(requests, 3);
+  ASSERT_EQ(runs.size(), requests.size());
+  for (size_t i = 0; i < runs.size(); ++i)
+  {
+    ExpectRun(runs[i], requests[i].dvd_offset, requests[i].length, i, i + 1);
+    EXPECT_EQ(runs[i].partition, requests[i].partition);
+  }
+}
+
+TEST(DVDReadPlanner, LargeRunsAreSplitAtRequestBoundaries)
+{
+  constexpr size_t NUM_REQUESTS = 3 * ReadPlanner::MIN_SPLIT_READ_SIZE / BLOCK_SIZE;
+  std::vector<ReadPlanner::Range> requests;
+  for (size_t i = 0; i < NUM_REQUESTS; ++i)
+    requests.push_back({0x10000 + i * BLOCK_SIZE, BLOCK_SIZE, PARTITION_A});
+  // A small run is never split
+  requests.push_back({0x800000, BLOCK_SIZE, PARTITION_A});
+  requests.push_back({0x808000, BLOCK_SIZE, PARTITION_A});
+
+  // With a single reader, nothing is split
+  const std::vector<ReadPlanner::Run> unsplit_runs = ReadPlanner::GetRuns(requests, 1);
+  ASSERT_EQ(unsplit_runs.size(), 2u);
+  ExpectRun(unsplit_runs[0], 0x10000, NUM_REQUESTS * BLOCK_SIZE, 0, NUM_REQUESTS);
+  ExpectRun(unsplit_runs[1], 0x800000, 2 * BLOCK_SIZE, NUM_REQUESTS, NUM_REQUESTS + 2);
+
+  const std::vector<ReadPlanner::Run> runs = ReadPlanner::GetRuns(requests, 3);
+  ASSERT_EQ(runs.size(), 4u);
+  for (size_t i = 0; i < 3; ++i)
+  {
+    ExpectRun(runs[i], 0x10000 + i * ReadPlanner::MIN_SPLIT_READ_SIZE,
+              ReadPlanner::MIN_SPLIT_READ_SIZE, i * NUM_REQUESTS / 3, (i + 1) * NUM_REQUESTS / 3);
+  }
+  ExpectRun(runs[3], 0x800000, 2 * BLOCK_SIZE, NUM_REQUESTS, NUM_REQUESTS + 2);
+}
+
+TEST_F(DVDReadPlannerTest, SequentialReadsArePrefetched)
+{
+  // A single read doesn't show which way the game is going
+  EXPECT_FALSE(Read(FILE_START, BLOCK_SIZE));
+  EXPECT_FALSE(m_planner.IsPrefetched(MakeRun(FILE_START + BLOCK_SIZE, BLOCK_SIZE)));
+
+  const std::optional<ReadPlanner::Range> prefetch = Read(FILE_START + BLOCK_SIZE, BLOCK_SIZE);
+  ASSERT_TRUE(prefetch);
+  EXPECT_EQ(prefetch->dvd_offset, FILE_START + 2 * BLOCK_SIZE);
+  EXPECT_EQ(prefetch->length, ReadPlanner::PREFETCH_SIZE);
+  EXPECT_EQ(prefetch->partition, PARTITION_A);
+
+  EXPECT_TRUE(m_planner.IsPrefetched(MakeRun(FILE_START + 2 * BLOCK_SIZE, BLOCK_SIZE)));
+  EXPECT_TRUE(m_planner.IsPrefetched(
+      MakeRun(FILE_START + 2 * BLOCK_SIZE + ReadPlanner::PREFETCH_SIZE - 0x20, 0x20)));
+  EXPECT_FALSE(m_planner.IsPrefetched(MakeRun(FILE_START + BLOCK_SIZE, 2 * BLOCK_SIZE)));
+  EXPECT_FALSE(m_planner.IsPrefetched(
+      MakeRun(FILE_START + 2 * BLOCK_SIZE + ReadPlanner::PREFETCH_SIZE - 0x20, 0x40)));
+  EXPECT_FALSE(m_planner.IsPrefetched(MakeRun(FILE_START + 2 * BLOCK_SIZE, BLOCK_SIZE,
+                                              PARTITION_B)));
+
+  // Reads within the prefetched data don't start another prefetch
+  EXPECT_FALSE(Read(FILE_START + 2 * BLOCK_SIZE, BLOCK_SIZE));
+}
+
+TEST_F(DVDReadPlannerTest, PrefetchStopsAtFileEnd)
+{
+  Read(FILE_END - 3 * BLOCK_SIZE, BLOCK_SIZE);
+  const std::optional<ReadPlanner::Range> prefetch = Read(FILE_END - 2 * BLOCK_SIZE, BLOCK_SIZE);
+  ASSERT_TRUE(prefetch);
+  EXPECT_EQ(prefetch->dvd_offset, FILE_END - BLOCK_SIZE);
+  EXPECT_EQ(prefetch->length, BLOCK_SIZE);
+
+  // Nothing is read past the end of the file, or outside of files
+  EXPECT_FALSE(Read(FILE_END - BLOCK_SIZE, BLOCK_SIZE));
+  EXPECT_FALSE(Read(FILE_END, BLOCK_SIZE));
+  Read(0x10000, BLOCK_SIZE, PARTITION_B);
+  EXPECT_FALSE(Read(0x18000, BLOCK_SIZE, PARTITION_B));
+}
+
+TEST_F(DVDReadPlannerTest, FileIsLookedUpOnce)
+{
+  const u64 size = ReadPlanner::PREFETCH_SIZE;
+  Read(FILE_START, size);
+  for (u64 offset = FILE_START + size; offset + size < FILE_END; offset += size)
+  {
+    const std::optional<ReadPlanner::Range> prefetch = Read(offset, size);
+    ASSERT_TRUE(prefetch);
+    EXPECT_EQ(prefetch->dvd_offset, offset + size);
+  }
+  EXPECT_EQ(m_file_lookups, 1);
+
+  // The file system can't be assumed to be the same after the disc changes
+  m_planner.Reset();
+  Read(FILE_START, size);
+  EXPECT_TRUE(Read(FILE_START + size, size));
+  EXPECT_EQ(m_file_lookups, 2);
+}
+
+// Only one run of a batch has to continue the previous read for the file to be read ahead.
+TEST_F(DVDReadPlannerTest, SequentialRunFollowedByOtherRun)
+{
+  Read(FILE_START, BLOCK_SIZE);
+
+  const std::optional<ReadPlanner::Range> prefetch = m_planner.PlanPrefetch(
+      {MakeRun(FILE_START + BLOCK_SIZE, BLOCK_SIZE), MakeRun(0x10000, BLOCK_SIZE, PARTITION_B)});
+  ASSERT_TRUE(prefetch);
+  EXPECT_EQ(prefetch->dvd_offset, FILE_START + 2 * BLOCK_SIZE);
+
+  // A run that was prefetched continues the file, even if another run was read in between
+  const u64 next_offset = FILE_START + 2 * BLOCK_SIZE + ReadPlanner::PREFETCH_SIZE - BLOCK_SIZE;
+  Read(0x20000, BLOCK_SIZE, PARTITION_B);
+  const std::optional<ReadPlanner::Range> next_prefetch = Read(next_offset, BLOCK_SIZE);
+  ASSERT_TRUE(next_prefetch);
+  EXPECT_EQ(next_prefetch->dvd_offset, next_offset + BLOCK_SIZE);
+}
+
+TEST_F(DVDReadPlannerTest, PrefetchIsInvalidated)
+{
+  const ReadPlanner::Run prefetched_run = MakeRun(FILE_START + 2 * BLOCK_SIZE, BLOCK_SIZE);
+
+  Read(FILE_START, BLOCK_SIZE);
+  ASSERT_TRUE(Read(FILE_START + BLOCK_SIZE, BLOCK_SIZE));
+  EXPECT_TRUE(m_planner.IsPrefetched(prefetched_run));
+
+  // A failed prefetch isn't used again
+  m_planner.DropPrefetch();
+  EXPECT_FALSE(m_planner.IsPrefetched(prefetched_run));
+
+  // A new prefetch replaces the previous one
+  ASSERT_TRUE(Read(FILE_START + 2 * BLOCK_SIZE, BLOCK_SIZE));
+  const u64 skipped_offset = FILE_START + 3 * ReadPlanner::PREFETCH_SIZE;
+  Read(skipped_offset, BLOCK_SIZE);
+  ASSERT_TRUE(Read(skipped_offset + BLOCK_SIZE, BLOCK_SIZE));
+  EXPECT_FALSE(m_planner.IsPrefetched(MakeRun(FILE_START + 3 * BLOCK_SIZE, BLOCK_SIZE)));
+  EXPECT_TRUE(m_planner.IsPrefetched(MakeRun(skipped_offset + 2 * BLOCK_SIZE, BLOCK_SIZE)));
+
+  // Nothing is prefetched after the disc changes, and a read at the offset where the last read
+  // ended doesn't count as sequential anymore
+  m_planner.Reset();
+  EXPECT_FALSE(m_planner.IsPrefetched(MakeRun(skipped_offset + 2 * BLOCK_SIZE, BLOCK_SIZE)));
+  EXPECT_FALSE(Read(skipped_offset + 2 * BLOCK_SIZE, BLOCK_SIZE));
+}
@@ -0,0 +1,163 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Core/FifoPlayer/FifoDataFile.h"
+
+static std::vector<u8> MakeData(size_t size, u32 seed)
+{
+  // Not compressible, so that deduplication is what keeps the file small
+  std::vector<u8> data(size);
+  u32 state = seed;
+  for (u8& byte : data)
+  {
+    state = state * 1103515245 + 12345;
+    byte = static_cast<u8>(state >> 16);
+  }
+  return data;
+}
+
+static FifoFrameInfo MakeFrame(u32 seed, const std::vector<u8>& texture)
+{
+  FifoFrameInfo frame;
+  frame.fifoData = MakeData(1000 + seed, seed);
+  frame.fifoStart = 0x00100000;
+  frame.fifoEnd = 0x00200000 + seed;
+
+  MemoryUpdate texture_update;
+  texture_update.fifoPosition = 10;
+  texture_update.address = 0x00300000 + seed * 0x1000;
+  texture_update.data = texture;
+  texture_update.type = MemoryUpdate::Type::TextureMap;
+  frame.memoryUpdates.push_back(texture_update);
+
+  MemoryUpdate vertex_update;
+  vertex_update.fifoPosition = 500;
+  vertex_update.address = 0x10000000 + seed;
+  vertex_update.data = MakeData(64, seed + 100);
+  vertex_update.type = MemoryUpdate::Type::VertexStream;
+  frame.memoryUpdates.push_back(vertex_update);
+
+  return frame;
+}
+
+static void ExpectFramesEqual(const FifoFrameInfo& expected, const FifoFrameInfo& actual)
+{
+  EXPECT_EQ(expected.fifoData, actual.fifoData);
+  EXPECT_EQ(expected.fifoStart, actual.fifoStart);
+  EXPECT_EQ(expected.fifoEnd, actual.fifoEnd);
+  ASSERT_EQ(expected.memoryUpdates.size(), actual.memoryUpdates.size());
+  for (size_t i = 0; i < expected.memoryUpdates.size(); ++i)
+  {
+    EXPECT_EQ(expected.memoryUpdates[i].fifoPosition, actual.memoryUpdates[i].fifoPosition);
+    EXPECT_EQ(expected.memoryUpdates[i].address, actual.memoryUpdates[i].address);
+    EXPECT_EQ(expected.memoryUpdates[i].data, actual.memoryUpdates[i].data);
+    EXPECT_EQ(expected.memoryUpdates[i].type, actual.memoryUpdates[i].type);
+  }
+}
+
+static u64 SaveAndGetSize(const std::vector<FifoFrameInfo>& frames, const std::string& path)
+{
+  auto file = std::make_unique<FifoDataFile>();
+  for (const FifoFrameInfo& frame : frames)
+    file->AddFrame(frame);
+  EXPECT_TRUE(file->Save(path));
+  return File::GetSize(path);
+}
+
+TEST(FifoDataFile, RoundTrip)
+{
+  const std::string dir = File::CreateTempDir();
+  ASSERT_FALSE(dir.empty());
+  const std::string path = dir + "/test.dff";
+
+  const std::vector<u8> texture = MakeData(0x4000, 1);
+  std::vector<FifoFrameInfo> frames;
+  for (u32 i = 0; i < 10; ++i)
+    frames.push_back(MakeFrame(i, texture));
+
+  auto recorded = std::make_unique<FifoDataFile>();
+  recorded->SetIsWii(true);
+  recorded->GetBPMem()[5] = 0x12345678;
+  for (const FifoFrameInfo& frame : frames)
+    recorded->AddFrame(frame);
+
+  ASSERT_EQ(recorded->GetFrameCount(), frames.size());
+  for (u32 i = 0; i < frames.size(); ++i)
+    ExpectFramesEqual(frames[i], *recorded->GetFrame(i));
+
+  ASSERT_TRUE(recorded->Save(path));
+
+  const auto loaded = FifoDataFile::Load(path, false);
+  ASSERT_NE(loaded, nullptr);
+  EXPECT_TRUE(loaded->GetIsWii());
+  EXPECT_EQ(loaded->GetBPMem()[5], 0x12345678u);
+  ASSERT_EQ(loaded->GetFrameCount(), frames.size());
+
+  // Out of order, to exercise seeking and the frame cache
+  for (u32 i : {7u, 2u, 9u, 0u, 2u, 5u, 1u, 3u, 4u, 6u, 8u})
+    ExpectFramesEqual(frames[i], *loaded->GetFrame(i));
+
+  File::DeleteDirRecursively(dir);
+}
+
+TEST(FifoDataFile, DeduplicatesMemoryUpdates)
+{
+  const std::string dir = File::CreateTempDir();
+  ASSERT_FALSE(dir.empty());
+
+  const std::vector<u8> texture = MakeData(0x10000, 1);
+  const u64 one_frame_size = SaveAndGetSize({MakeFrame(0, texture)}, dir + "/one.dff");
+  const u64 two_frames_size =
+      SaveAndGetSize({MakeFrame(0, texture), MakeFrame(1, texture)}, dir + "/two.dff");
+
+  // The second frame's texture upload must not be stored again
+  EXPECT_LT(two_frames_size - one_frame_size, texture.size() / 4);
+
+  File::DeleteDirRecursively(dir);
+}
+
+TEST(FifoDataFile, MovesLongRecordingsToTemporaryFile)
+{
+  const std::string dir = File::CreateTempDir();
+  ASSERT_FALSE(dir.empty());
+  const std::string path = dir + "/test.dff";
+
+  std::vector<FifoFrameInfo> frames;
+  for (u32 i = 0; i < 10; ++i)
+    frames.push_back(MakeFrame(i, MakeData(0x4000, i)));
+
+  // Small enough that every few frames are moved out of memory
+  auto recorded = std::make_unique<FifoDataFile>();
+  recorded->SetMaxBufferedDataSize(0x8000);
+  for (const FifoFrameInfo& frame : frames)
+    recorded->AddFrame(frame);
+
+  for (u32 i = 0; i < frames.size(); ++i)
+  {
+    ExpectFramesEqual(frames[i], *recorded->GetFrame(i));
+    const auto [fifo_bytes, mem_bytes] = recorded->GetFrameDataSizes(i);
+    EXPECT_EQ(fifo_bytes, frames[i].fifoData.size());
+    EXPECT_EQ(mem_bytes, 0x4000u + 64u);
+  }
+
+  ASSERT_TRUE(recorded->Save(path));
+
+  const auto loaded = FifoDataFile::Load(path, false);
+  ASSERT_NE(loaded, nullptr);
+  ASSERT_EQ(loaded->GetFrameCount(), frames.size());
+  for (u32 i = 0; i < frames.size(); ++i)
+  {
+    ExpectFramesEqual(frames[i], *loaded->GetFrame(i));
+    EXPECT_EQ(loaded->GetFrameDataSizes(i), recorded->GetFrameDataSizes(i));
+  }
+
+  File::DeleteDirRecursively(dir);
+}
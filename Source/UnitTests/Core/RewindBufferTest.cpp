@@ -0,0 +1,136 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Core/RewindBuffer.h"
+
+static std::vector<u8> MakeState(size_t size, u8 seed)
+{
+  std::vector<u8> state(size);
+  for (size_t i = 0; i < size; ++i)
+    state[i] = static_cast<u8>(i * 7 + seed);
+  return state;
+}
+
+TEST(RewindBuffer, DeltaRoundTrip)
+{
+  const std::vector<u8> older = MakeState(1000, 1);
+  std::vector<u8> newer = older;
+  newer[3] ^= 0xff;
+  newer[500] ^= 0x01;
+  newer[999] ^= 0x80;
+
+  const std::vector<u8> delta = State::RewindBuffer::EncodeDelta(older, {}, newer, {});
+  EXPECT_LT(delta.size(), older.size() / 10);
+
+  EXPECT_EQ(State::RewindBuffer::ApplyDelta(newer, {}, delta, older.size(), {}), older);
+}
+
+TEST(RewindBuffer, DeltaRoundTripDifferentSizes)
+{
+  const std::vector<u8> small = MakeState(13, 2);
+  const std::vector<u8> large = MakeState(70, 3);
+
+  const std::vector<u8> to_small = State::RewindBuffer::EncodeDelta(small, {}, large, {});
+  EXPECT_EQ(State::RewindBuffer::ApplyDelta(large, {}, to_small, small.size(), {}), small);
+
+  const std::vector<u8> to_large = State::RewindBuffer::EncodeDelta(large, {}, small, {});
+  EXPECT_EQ(State::RewindBuffer::ApplyDelta(small, {}, to_large, large.size(), {}), large);
+}
+
+TEST(RewindBuffer, SectionsStayAlignedWhenEarlierSectionGrows)
+{
+  // Like a savestate where something before RAM (the movie, the CoreTiming event queue, ...)
+  // changed size between two snapshots.
+  const std::vector<u8> ram = MakeState(64 * 1024, 4);
+  std::vector<u8> older = MakeState(100, 5);
+  const std::vector<size_t> older_sections{older.size()};
+  older.insert(older.end(), ram.begin(), ram.end());
+
+  std::vector<u8> newer = MakeState(137, 6);
+  const std::vector<size_t> newer_sections{newer.size()};
+  newer.insert(newer.end(), ram.begin(), ram.end());
+  newer[newer_sections[0] + 1000] ^= 0x55;
+
+  const std::vector<u8> delta =
+      State::RewindBuffer::EncodeDelta(older, older_sections, newer, newer_sections);
+  EXPECT_LT(delta.size(), 512u);
+  EXPECT_EQ(
+      State::RewindBuffer::ApplyDelta(newer, newer_sections, delta, older.size(), older_sections),
+      older);
+
+  // Without sections, the inserted bytes shift all of RAM and almost every word differs.
+  EXPECT_GT(State::RewindBuffer::EncodeDelta(older, {}, newer, {}).size(), ram.size() / 2);
+}
+
+TEST(RewindBuffer, PopsSectionedSnapshots)
+{
+  State::RewindBuffer buffer;
+  buffer.SetBudget(1024 * 1024);
+
+  std::vector<std::vector<u8>> states;
+  for (u8 i = 0; i < 4; ++i)
+  {
+    std::vector<u8> state = MakeState(10 + i * 3, i);
+    const std::vector<size_t> sections{state.size(), state.size() + 4096};
+    const std::vector<u8> ram = MakeState(4096, 0);
+    state.insert(state.end(), ram.begin(), ram.end());
+    state.resize(state.size() + i, i);
+    states.push_back(state);
+    buffer.Push(std::move(state), sections);
+  }
+
+  std::vector<u8> popped;
+  for (size_t i = states.size(); i-- > 0;)
+  {
+    ASSERT_TRUE(buffer.Pop(&popped));
+    EXPECT_EQ(popped, states[i]);
+  }
+  EXPECT_TRUE(buffer.IsEmpty());
+}
+
+TEST(RewindBuffer, PopsNewestFirst)
+{
+  State::RewindBuffer buffer;
+  buffer.SetBudget(1024 * 1024);
+
+  std::vector<std::vector<u8>> states;
+  for (u8 i = 0; i < 5; ++i)
+  {
+    std::vector<u8> state = MakeState(4096, 0);
+    state[i * 100] = 0xaa;
+    states.push_back(state);
+    buffer.Push(std::move(state));
+  }
+  EXPECT_EQ(buffer.GetSnapshotCount(), 5u);
+
+  std::vector<u8> popped;
+  for (size_t i = states.size(); i-- > 0;)
+  {
+    ASSERT_TRUE(buffer.Pop(&popped));
+    EXPECT_EQ(popped, states[i]);
+  }
+  EXPECT_TRUE(buffer.IsEmpty());
+  EXPECT_FALSE(buffer.Pop(&popped));
+}
+
+TEST(RewindBuffer, DropsOldestOverBudget)
+{
+  State::RewindBuffer buffer;
+  buffer.SetBudget(4096);
+
+  for (u8 i = 0; i < 10; ++i)
+    buffer.Push(MakeState(1024, i));
+
+  // Every byte changes between these states, so only a few fit within the budget.
+  EXPECT_LE(buffer.GetUsedBytes(), 4096u);
+  EXPECT_LT(buffer.GetSnapshotCount(), 10u);
+
+  std::vector<u8> popped;
+  ASSERT_TRUE(buffer.Pop(&popped));
+  EXPECT_EQ(popped, MakeState(1024, 9));
+}
@@ -0,0 +1,222 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/Align.h"
+#include "Common/CommonTypes.h"
+#include "Common/Crypto/SHA1.h"
+#include "Common/FileUtil.h"
+#include "Common/Hash.h"
+#include "Common/IOFile.h"
+#include "Common/Swap.h"
+#include "Core/IOS/ES/Formats.h"
+#include "DiscIO/Blob.h"
+#include "DiscIO/Enums.h"
+#include "DiscIO/FileBlob.h"
+#include "DiscIO/Volume.h"
+#include "DiscIO/VolumeVerifier.h"
+#include "UICommon/UICommon.h"
+
+using namespace DiscIO;
+
+namespace
+{
+constexpr u64 TITLE_ID = 0x00010001'48414445;  // HADE
+constexpr u32 FIRST_CONTENT_OFFSET = 0x1000;
+constexpr u32 FIRST_CONTENT_ID = 0x10;
+constexpr u16 NUM_CONTENTS = 8;
+constexpr u16 CORRUPT_CONTENT = 3;
+
+// A WAD whose contents are stored unencrypted, so that the integrity of a content can be checked
+// by just hashing it. There are enough contents to keep several check threads busy at once.
+class SyntheticWAD final : public Volume
+{
+public:
+  SyntheticWAD(const std::string& filename, std::vector<u8> data,
+               const std::vector<IOS::ES::Content>& contents)
+      : m_data(std::move(data))
+  {
+    std::vector<u8> tmd(sizeof(IOS::ES::TMDHeader) + contents.size() * sizeof(IOS::ES::Content));
+    IOS::ES::TMDHeader header{};
+    header.signature.type = static_cast<IOS::SignatureType>(
+        Common::swap32(static_cast<u32>(IOS::SignatureType::RSA2048)));
+    header.ios_id = Common::swap64(0x00000001'00000038);
+    header.title_id = Common::swap64(TITLE_ID);
+    header.num_contents = Common::swap16(static_cast<u16>(contents.size()));
+    std::memcpy(tmd.data(), &header, sizeof(header));
+    for (size_t i = 0; i < contents.size(); ++i)
+    {
+      IOS::ES::Content content = contents[i];
+      content.id = Common::swap32(content.id);
+      content.index = Common::swap16(content.index);
+      content.size = Common::swap64(content.size);
+      std::memcpy(tmd.data() + sizeof(header) + i * sizeof(content), &content, sizeof(content));
+    }
+    m_tmd = IOS::ES::TMDReader(std::move(tmd));
+
+    IOS::ES::Ticket ticket{};
+    ticket.signature.type = header.signature.type;
+    ticket.title_id = header.title_id;
+    std::vector<u8> ticket_bytes(sizeof(ticket));
+    std::memcpy(ticket_bytes.data(), &ticket, sizeof(ticket));
+    m_ticket = IOS::ES::TicketReader(std::move(ticket_bytes));
+
+    u64 offset = FIRST_CONTENT_OFFSET;
+    for (const IOS::ES::Content& content : contents)
+    {
+      m_content_offsets.push_back(offset);
+      offset += Common::AlignUp(content.size, 0x40);
+    }
+
+    {
+      File::IOFile file(filename, "wb");
+      file.WriteBytes(m_data.data(), m_data.size());
+    }
+    m_reader = PlainFileReader::Create(File::IOFile(filename, "rb"));
+  }
+
+  bool Read(u64 offset, u64 length, u8* buffer, const Partition& partition) const override
+  {
+    return partition == PARTITION_NONE && m_reader->Read(offset, length, buffer);
+  }
+
+  std::optional<u64> GetTitleID(const Partition& partition) const override { return TITLE_ID; }
+  const IOS::ES::TicketReader& GetTicket(const Partition& partition) const override
+  {
+    return m_ticket;
+  }
+  const IOS::ES::TMDReader& GetTMD(const Partition& partition) const override { return m_tmd; }
+  std::vector<u64> GetContentOffsets() const override { return m_content_offsets; }
+  bool CheckContentIntegrity(const IOS::ES::Content& content,
+                             const std::vector<u8>& encrypted_data,
+                             const IOS::ES::TicketReader& ticket) const override
+  {
+    return encrypted_data.size() >= content.size &&
+           Common::SHA1::CalculateDigest(encrypted_data.data(), content.size) == content.sha1;
+  }
+  IOS::ES::TicketReader GetTicketWithFixedCommonKey() const override { return m_ticket; }
+
+  const FileSystem* GetFileSystem(const Partition& partition) const override { return nullptr; }
+  std::string GetGameID(const Partition& partition) const override { return "HADE"; }
+  std::string GetGameTDBID(const Partition& partition) const override { return "HADE"; }
+  std::string GetMakerID(const Partition& partition) const override { return "01"; }
+  std::optional<u16> GetRevision(const Partition& partition) const override { return 0; }
+  std::string GetInternalName(const Partition& partition) const override { return ""; }
+  std::vector<u32> GetBanner(u32* width, u32* height) const override
+  {
+    *width = 0;
+    *height = 0;
+    return {};
+  }
+  std::string GetApploaderDate(const Partition& partition) const override { return ""; }
+  Platform GetVolumeType() const override { return Platform::WiiWAD; }
+  bool IsDatelDisc() const override { return false; }
+  bool IsNKit() const override { return false; }
+  Region GetRegion() const override { return Region::NTSC_U; }
+  Country GetCountry(const Partition& partition) const override { return Country::USA; }
+  BlobType GetBlobType() const override { return m_reader->GetBlobType(); }
+  u64 GetDataSize() const override { return m_reader->GetDataSize(); }
+  DataSizeType GetDataSizeType() const override { return m_reader->GetDataSizeType(); }
+  u64 GetRawSize() const override { return m_reader->GetRawSize(); }
+  const BlobReader& GetBlobReader() const override { return *m_reader; }
+  std::array<u8, 20> GetSyncHash() const override { return {}; }
+
+private:
+  std::vector<u8> m_data;
+  std::unique_ptr<BlobReader> m_reader;
+  IOS::ES::TMDReader m_tmd;
+  IOS::ES::TicketReader m_ticket;
+  std::vector<u64> m_content_offsets;
+};
+
+class VolumeVerifierTest : public testing::Test
+{
+protected:
+  VolumeVerifierTest() : m_profile_path{File::CreateTempDir()}
+  {
+    // Verifying a WAD checks its signatures using a NAND in the user directory
+    if (!m_profile_path.empty())
+      UICommon::SetUserDirectory(m_profile_path);
+  }
+
+  ~VolumeVerifierTest() override
+  {
+    if (!m_profile_path.empty())
+      File::DeleteDirRecursively(m_profile_path);
+  }
+
+  void SetUp() override { ASSERT_FALSE(m_profile_path.empty()); }
+
+  std::string GetFilename() const { return m_profile_path + "/test.wad"; }
+
+private:
+  std::string m_profile_path;
+};
+}  // namespace
+
+// Runs the whole verification with different numbers of check threads. The hashes have to match
+// the hashes of the data, and exactly the content that was corrupted has to be reported.
+TEST_F(VolumeVerifierTest, ProcessCompletesWithSeveralThreads)
+{
+  std::vector<IOS::ES::Content> contents(NUM_CONTENTS);
+  u64 size = FIRST_CONTENT_OFFSET;
+  for (u16 i = 0; i < NUM_CONTENTS; ++i)
+  {
+    contents[i].id = FIRST_CONTENT_ID + i;
+    contents[i].index = i;
+    contents[i].size = 0x20000 + i * 0x1111;
+    size += Common::AlignUp(contents[i].size, 0x40);
+  }
+
+  std::vector<u8> data(size);
+  for (size_t i = 0; i < data.size(); ++i)
+    data[i] = static_cast<u8>(i * 13 + (i >> 9));
+
+  u64 offset = FIRST_CONTENT_OFFSET;
+  for (IOS::ES::Content& content : contents)
+  {
+    content.sha1 = Common::SHA1::CalculateDigest(&data[offset], content.size);
+    if (content.index == CORRUPT_CONTENT)
+      data[offset + content.size / 2] ^= 1;
+    offset += Common::AlignUp(content.size, 0x40);
+  }
+
+  const u32 crc32 = Common::swap32(Common::UpdateCRC32(Common::StartCRC32(), data.data(),
+                                                       data.size()));
+  const std::vector<u8> expected_crc32(reinterpret_cast<const u8*>(&crc32),
+                                       reinterpret_cast<const u8*>(&crc32) + sizeof(crc32));
+  const Common::SHA1::Digest sha1 = Common::SHA1::CalculateDigest(data.data(), data.size());
+  const std::vector<u8> expected_sha1(sha1.begin(), sha1.end());
+
+  const SyntheticWAD volume(GetFilename(), data, contents);
+  for (unsigned int threads : {1u, 2u, 5u})
+  {
+    VolumeVerifier verifier(volume, false, {.crc32 = true, .md5 = false, .sha1 = true}, threads);
+    verifier.Start();
+    while (verifier.GetBytesProcessed() != verifier.GetTotalBytes())
+      verifier.Process();
+    verifier.Finish();
+
+    const VolumeVerifier::Result& result = verifier.GetResult();
+    EXPECT_EQ(result.hashes.crc32, expected_crc32) << threads << " threads";
+    EXPECT_EQ(result.hashes.sha1, expected_sha1) << threads << " threads";
+    EXPECT_TRUE(result.hashes.md5.empty()) << threads << " threads";
+
+    std::vector<std::string> corrupt_contents;
+    for (const VolumeVerifier::Problem& problem : result.problems)
+    {
+      if (problem.text.find("corrupt") != std::string::npos)
+        corrupt_contents.push_back(problem.text);
+    }
+    EXPECT_EQ(corrupt_contents, std::vector<std::string>{"Content 00000013 is corrupt."})
+        << threads << " threads";
+  }
+}
@@ -0,0 +1,119 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Crypto/SHA1.h"
+#include "DiscIO/VolumeWii.h"
+
+using DiscIO::VolumeWii;
+
+namespace
+{
+using BlockData = std::array<u8, VolumeWii::BLOCK_DATA_SIZE>;
+using HashBlock = VolumeWii::HashBlock;
+
+std::unique_ptr<BlockData[]> MakeGroup()
+{
+  auto in = std::make_unique<BlockData[]>(VolumeWii::BLOCKS_PER_GROUP);
+  for (size_t i = 0; i < VolumeWii::BLOCKS_PER_GROUP; ++i)
+  {
+    for (size_t j = 0; j < in[i].size(); ++j)
+      in[i][j] = static_cast<u8>(i * 13 + j * 7 + (j >> 10));
+  }
+  return in;
+}
+
+std::unique_ptr<HashBlock[]> MakeHashBlocks()
+{
+  // Garbage, so that the padding has to be cleared
+  auto out = std::make_unique<HashBlock[]>(VolumeWii::BLOCKS_PER_GROUP);
+  std::memset(out.get(), 0xcc, sizeof(HashBlock) * VolumeWii::BLOCKS_PER_GROUP);
+  return out;
+}
+
+// Hashes a group one block after the other on the calling thread
+void HashGroupSequentially(const BlockData in[VolumeWii::BLOCKS_PER_GROUP],
+                           HashBlock out[VolumeWii::BLOCKS_PER_GROUP])
+{
+  for (size_t i = 0; i < VolumeWii::BLOCKS_PER_GROUP; ++i)
+  {
+    for (size_t j = 0; j < out[i].h0.size(); ++j)
+      out[i].h0[j] = Common::SHA1::CalculateDigest(&in[i][j * 0x400], 0x400);
+    out[i].padding_0 = {};
+
+    const size_t h1_base = i / 8 * 8;
+    out[h1_base].h1[i - h1_base] = Common::SHA1::CalculateDigest(out[i].h0);
+  }
+
+  for (size_t i = 0; i < VolumeWii::BLOCKS_PER_GROUP; i += 8)
+  {
+    out[i].padding_1 = {};
+    for (size_t j = 1; j < 8; ++j)
+      out[i + j].h1 = out[i].h1;
+    out[0].h2[i / 8] = Common::SHA1::CalculateDigest(out[i].h1);
+  }
+
+  out[0].padding_2 = {};
+  for (size_t i = 1; i < VolumeWii::BLOCKS_PER_GROUP; ++i)
+    out[i].h2 = out[0].h2;
+}
+
+void ExpectSameHashBlocks(const HashBlock expected[VolumeWii::BLOCKS_PER_GROUP],
+                          const HashBlock actual[VolumeWii::BLOCKS_PER_GROUP])
+{
+  for (size_t i = 0; i < VolumeWii::BLOCKS_PER_GROUP; ++i)
+    EXPECT_EQ(std::memcmp(&expected[i], &actual[i], sizeof(HashBlock)), 0) << "block " << i;
+}
+}  // namespace
+
+TEST(VolumeWii, HashGroupMatchesSequentialHashing)
+{
+  const auto in = MakeGroup();
+  const auto expected = MakeHashBlocks();
+  HashGroupSequentially(in.get(), expected.get());
+
+  const auto actual = MakeHashBlocks();
+  ASSERT_TRUE(VolumeWii::HashGroup(in.get(), actual.get()));
+  ExpectSameHashBlocks(expected.get(), actual.get());
+}
+
+TEST(VolumeWii, HashGroupHashesBlocksAsTheyAreRead)
+{
+  const auto data = MakeGroup();
+  const auto expected = MakeHashBlocks();
+  HashGroupSequentially(data.get(), expected.get());
+
+  const auto in = std::make_unique<BlockData[]>(VolumeWii::BLOCKS_PER_GROUP);
+  const auto actual = MakeHashBlocks();
+  std::vector<size_t> read_blocks;
+  ASSERT_TRUE(VolumeWii::HashGroup(in.get(), actual.get(), [&](size_t block) {
+    read_blocks.push_back(block);
+    in[block] = data[block];
+    return true;
+  }));
+
+  ExpectSameHashBlocks(expected.get(), actual.get());
+  ASSERT_EQ(read_blocks.size(), VolumeWii::BLOCKS_PER_GROUP);
+  for (size_t i = 0; i < read_blocks.size(); ++i)
+    EXPECT_EQ(read_blocks[i], i);
+}
+
+TEST(VolumeWii, HashGroupStopsWhenReadingFails)
+{
+  const auto in = MakeGroup();
+  const auto out = MakeHashBlocks();
+  size_t reads = 0;
+  EXPECT_FALSE(VolumeWii::HashGroup(in.get(), out.get(), [&](size_t block) {
+    ++reads;
+    return block != 20;
+  }));
+  EXPECT_EQ(reads, 21u);
+}
@@ -0,0 +1,145 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "VideoBackends/Software/EfbInterface.h"
+#include "VideoBackends/Software/NativeVertexFormat.h"
+#include "VideoBackends/Software/Rasterizer.h"
+#include "VideoCommon/BPMemory.h"
+#include "VideoCommon/VideoCommon.h"
+
+namespace
+{
+struct EFBContents
+{
+  std::vector<u32> color;
+  std::vector<u32> depth;
+};
+
+void SetUpPipeline()
+{
+  std::memset(reinterpret_cast<u8*>(&bpmem), 0, sizeof(bpmem));
+
+  bpmem.scissorTL.x = 0;
+  bpmem.scissorTL.y = 0;
+  bpmem.scissorBR.x = EFB_WIDTH - 1;
+  bpmem.scissorBR.y = EFB_HEIGHT - 1;
+
+  // One TEV stage which outputs the rasterized vertex color
+  bpmem.genMode.numcolchans = 1;
+  bpmem.genMode.numtevstages = 0;
+  bpmem.tevorders[0].colorchan_even = RasColorChan::Color0;
+  bpmem.tevksel.ksel[0].swap_rb = ColorChannel::Red;
+  bpmem.tevksel.ksel[0].swap_ga = ColorChannel::Green;
+  bpmem.tevksel.ksel[1].swap_rb = ColorChannel::Blue;
+  bpmem.tevksel.ksel[1].swap_ga = ColorChannel::Alpha;
+  auto& combiner = bpmem.combiners[0];
+  combiner.colorC.a = TevColorArg::Zero;
+  combiner.colorC.b = TevColorArg::Zero;
+  combiner.colorC.c = TevColorArg::Zero;
+  combiner.colorC.d = TevColorArg::RasColor;
+  combiner.colorC.clamp = true;
+  combiner.alphaC.a = TevAlphaArg::Zero;
+  combiner.alphaC.b = TevAlphaArg::Zero;
+  combiner.alphaC.c = TevAlphaArg::Zero;
+  combiner.alphaC.d = TevAlphaArg::RasAlpha;
+  combiner.alphaC.clamp = true;
+
+  bpmem.alpha_test.comp0 = CompareMode::Always;
+  bpmem.alpha_test.comp1 = CompareMode::Always;
+
+  // Blending and depth testing make the result depend on the order in which the triangles are
+  // drawn, which has to be preserved within each pixel no matter how many threads are used.
+  bpmem.zmode.testenable = true;
+  bpmem.zmode.updateenable = true;
+  bpmem.zmode.func = CompareMode::LEqual;
+  bpmem.blendmode.blendenable = true;
+  bpmem.blendmode.colorupdate = true;
+  bpmem.blendmode.alphaupdate = true;
+  bpmem.blendmode.srcfactor = SrcBlendFactor::SrcAlpha;
+  bpmem.blendmode.dstfactor = DstBlendFactor::InvSrcAlpha;
+  bpmem.zcontrol.pixel_format = PixelFormat::RGBA6_Z24;
+
+  Rasterizer::ScissorChanged();
+}
+
+EFBContents DrawScene(u32 num_workers)
+{
+  Rasterizer::Init(num_workers);
+
+  u8 clear_color[4] = {0xff, 0x40, 0x80, 0xc0};
+  for (u16 y = 0; y < EFB_HEIGHT; y++)
+  {
+    for (u16 x = 0; x < EFB_WIDTH; x++)
+    {
+      EfbInterface::SetColor(x, y, clear_color);
+      EfbInterface::SetDepth(x, y, 0xffffff);
+    }
+  }
+
+  std::mt19937 rng(0x5eed);
+  std::uniform_real_distribution<float> x_dist(-32.0f, EFB_WIDTH + 32.0f);
+  std::uniform_real_distribution<float> y_dist(-32.0f, EFB_HEIGHT + 32.0f);
+  std::uniform_real_distribution<float> z_dist(0.0f, 16777215.0f);
+  std::uniform_int_distribution<u32> color_dist(0, 255);
+
+  // Several batches of overlapping triangles, most of them spanning many bins, so that every
+  // thread draws next to pixels drawn by the others.
+  for (int batch = 0; batch < 3; batch++)
+  {
+    for (int i = 0; i < 32; i++)
+    {
+      OutputVertexData vertices[3];
+      for (OutputVertexData& vertex : vertices)
+      {
+        vertex.projectedPosition.w = 1.0f;
+        vertex.screenPosition = Vec3(x_dist(rng), y_dist(rng), z_dist(rng));
+        for (u8& component : vertex.color[0])
+          component = static_cast<u8>(color_dist(rng));
+      }
+      Rasterizer::DrawTriangleFrontFace(&vertices[0], &vertices[1], &vertices[2]);
+      Rasterizer::DrawTriangleFrontFace(&vertices[0], &vertices[2], &vertices[1]);
+    }
+    Rasterizer::Flush();
+  }
+
+  EFBContents contents;
+  for (u16 y = 0; y < EFB_HEIGHT; y++)
+  {
+    for (u16 x = 0; x < EFB_WIDTH; x++)
+    {
+      contents.color.push_back(EfbInterface::GetColor(x, y));
+      contents.depth.push_back(EfbInterface::GetDepth(x, y));
+    }
+  }
+
+  Rasterizer::Shutdown();
+  return contents;
+}
+}  // namespace
+
+TEST(SoftwareRasterizer, MultithreadedMatchesSingleThreaded)
+{
+  SetUpPipeline();
+
+  const EFBContents expected = DrawScene(0);
+  for (u32 num_workers : {1u, 3u, 7u})
+  {
+    const EFBContents actual = DrawScene(num_workers);
+    for (u32 i = 0; i < EFB_WIDTH * EFB_HEIGHT; i++)
+    {
+      ASSERT_EQ(expected.color[i], actual.color[i])
+          << "color at " << i % EFB_WIDTH << "," << i / EFB_WIDTH << " with " << num_workers
+          << " workers";
+      ASSERT_EQ(expected.depth[i], actual.depth[i])
+          << "depth at " << i % EFB_WIDTH << "," << i / EFB_WIDTH << " with " << num_workers
+          << " workers";
+    }
+  }
+}
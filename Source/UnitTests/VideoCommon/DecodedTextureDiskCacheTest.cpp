@@ -0,0 +1,145 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "VideoCommon/DecodedTextureDiskCache.h"
+
+using VideoCommon::DecodedTextureDiskCache;
+
+class DecodedTextureDiskCacheTest : public testing::Test
+{
+protected:
+  DecodedTextureDiskCacheTest() : m_temp_dir{File::CreateTempDir()} {}
+
+  ~DecodedTextureDiskCacheTest() override
+  {
+    if (!m_temp_dir.empty())
+      File::DeleteDirRecursively(m_temp_dir);
+  }
+
+  void SetUp() override { ASSERT_FALSE(m_temp_dir.empty()); }
+
+  std::string GetFilename() const { return m_temp_dir + "/test.texcache"; }
+
+  static std::vector<u8> MakeData(size_t size, u8 seed)
+  {
+    std::vector<u8> data(size);
+    for (size_t i = 0; i < size; ++i)
+      data[i] = static_cast<u8>(i * 7 + seed);
+    return data;
+  }
+
+private:
+  std::string m_temp_dir;
+};
+
+TEST_F(DecodedTextureDiskCacheTest, EntriesPersist)
+{
+  const DecodedTextureDiskCache::Key key{1, 2};
+  const std::vector<u8> data = MakeData(1000, 3);
+
+  {
+    DecodedTextureDiskCache cache;
+    ASSERT_TRUE(cache.Open(GetFilename(), 1 << 20));
+    cache.Write(key, data);
+  }
+
+  DecodedTextureDiskCache cache;
+  ASSERT_TRUE(cache.Open(GetFilename(), 1 << 20));
+  std::vector<u8> read(data.size());
+  ASSERT_TRUE(cache.Read(key, read));
+  EXPECT_EQ(data, read);
+
+  // Lookups need both the key and the size to match.
+  std::vector<u8> wrong_size(data.size() - 1);
+  EXPECT_FALSE(cache.Read(key, wrong_size));
+  EXPECT_FALSE(cache.Read({1, 3}, read));
+}
+
+TEST_F(DecodedTextureDiskCacheTest, PartialEntryIsDropped)
+{
+  {
+    DecodedTextureDiskCache cache;
+    ASSERT_TRUE(cache.Open(GetFilename(), 1 << 20));
+    cache.Write({1, 1}, MakeData(100, 1));
+    cache.Write({2, 2}, MakeData(100, 2));
+  }
+
+  // Simulate a write that was interrupted.
+  {
+    File::IOFile file(GetFilename(), "r+b");
+    ASSERT_TRUE(file.Resize(file.GetSize() - 10));
+  }
+
+  DecodedTextureDiskCache cache;
+  ASSERT_TRUE(cache.Open(GetFilename(), 1 << 20));
+  std::vector<u8> read(100);
+  EXPECT_TRUE(cache.Read({1, 1}, read));
+  EXPECT_FALSE(cache.Read({2, 2}, read));
+}
+
+TEST_F(DecodedTextureDiskCacheTest, RepeatedWritesAreStoredOnce)
+{
+  const std::vector<u8> data = MakeData(1000, 1);
+
+  {
+    DecodedTextureDiskCache cache;
+    ASSERT_TRUE(cache.Open(GetFilename(), 1 << 20));
+    cache.Write({1, 1}, data);
+  }
+  const u64 size_with_one_entry = File::GetSize(GetFilename());
+  ASSERT_TRUE(File::Delete(GetFilename()));
+
+  // Most of these are added before the writer thread gets to the first one.
+  {
+    DecodedTextureDiskCache cache;
+    ASSERT_TRUE(cache.Open(GetFilename(), 1 << 20));
+    for (int i = 0; i < 100; ++i)
+      cache.Write({1, 1}, data);
+  }
+  EXPECT_EQ(size_with_one_entry, File::GetSize(GetFilename()));
+}
+
+TEST_F(DecodedTextureDiskCacheTest, LeastRecentlyUsedEntriesAreEvicted)
+{
+  constexpr size_t size = 10000;
+  constexpr u64 budget = 5 * size;
+  std::vector<u8> read(size);
+
+  {
+    DecodedTextureDiskCache cache;
+    ASSERT_TRUE(cache.Open(GetFilename(), budget));
+    for (u8 i = 0; i < 4; ++i)
+      cache.Write({i, 0}, MakeData(size, i));
+  }
+
+  // Use the first entry again, and add entries until the budget is exceeded.
+  {
+    DecodedTextureDiskCache cache;
+    ASSERT_TRUE(cache.Open(GetFilename(), budget * 2));
+    ASSERT_TRUE(cache.Read({0, 0}, read));
+    for (u8 i = 4; i < 6; ++i)
+      cache.Write({i, 0}, MakeData(size, i));
+  }
+
+  // Only three entries fit into three quarters of the budget. The ones used most recently are
+  // kept.
+  DecodedTextureDiskCache cache;
+  ASSERT_TRUE(cache.Open(GetFilename(), budget));
+  EXPECT_TRUE(cache.Read({0, 0}, read));
+  EXPECT_EQ(MakeData(size, 0), read);
+  EXPECT_FALSE(cache.Read({1, 0}, read));
+  EXPECT_FALSE(cache.Read({2, 0}, read));
+  EXPECT_FALSE(cache.Read({3, 0}, read));
+  EXPECT_TRUE(cache.Read({4, 0}, read));
+  EXPECT_TRUE(cache.Read({5, 0}, read));
+  EXPECT_EQ(MakeData(size, 5), read);
+  EXPECT_FALSE(File::Exists(GetFilename() + ".tmp"));
+}
@@ -0,0 +1,176 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "VideoCommon/PipelineUIDCacheFile.h"
+
+namespace
+{
+struct TestUid
+{
+  u32 value;
+  u32 extra;
+};
+
+using TestUIDCacheFile = VideoCommon::PipelineUIDCacheFile<TestUid>;
+
+constexpr u32 UID_VERSION = 7;
+constexpr u32 UNKNOWN_FRAME = TestUIDCacheFile::UNKNOWN_FIRST_USE_FRAME;
+
+class PipelineUIDCacheFileTest : public testing::Test
+{
+protected:
+  PipelineUIDCacheFileTest() : m_temp_dir{File::CreateTempDir()} {}
+
+  ~PipelineUIDCacheFileTest() override
+  {
+    if (!m_temp_dir.empty())
+      File::DeleteDirRecursively(m_temp_dir);
+  }
+
+  void SetUp() override { ASSERT_FALSE(m_temp_dir.empty()); }
+
+  std::string GetUIDFilename() const { return m_temp_dir + "/test.uidcache"; }
+  std::string GetTraceFilename() const { return m_temp_dir + "/test.pipelinetrace"; }
+
+  std::vector<TestUIDCacheFile::Entry> Open(TestUIDCacheFile& cache) const
+  {
+    return cache.Open(GetUIDFilename(), GetTraceFilename(), UID_VERSION);
+  }
+
+  // Returns the UIDs and frames a new session would read.
+  std::vector<std::pair<u32, u32>> Reload() const
+  {
+    TestUIDCacheFile cache;
+    std::vector<std::pair<u32, u32>> result;
+    for (const TestUIDCacheFile::Entry& entry : Open(cache))
+      result.emplace_back(entry.uid.value, entry.first_use_frame);
+    return result;
+  }
+
+private:
+  std::string m_temp_dir;
+};
+}  // namespace
+
+TEST_F(PipelineUIDCacheFileTest, EntriesPersist)
+{
+  {
+    TestUIDCacheFile cache;
+    EXPECT_TRUE(Open(cache).empty());
+    EXPECT_TRUE(cache.IsOpen());
+    cache.Append({1, 0}, 0);
+    cache.Append({2, 0}, 5);
+  }
+
+  {
+    TestUIDCacheFile cache;
+    EXPECT_EQ(Open(cache).size(), 2u);
+    cache.Append({3, 0}, 9);
+  }
+
+  const std::vector<std::pair<u32, u32>> expected{{1, 0}, {2, 5}, {3, 9}};
+  EXPECT_EQ(Reload(), expected);
+}
+
+TEST_F(PipelineUIDCacheFileTest, DuplicatesAreStoredOnce)
+{
+  {
+    TestUIDCacheFile cache;
+    Open(cache);
+    cache.Append({1, 0}, 0);
+    cache.Append({1, 0}, 3);
+    cache.Append({1, 1}, 4);
+  }
+
+  {
+    // UIDs loaded from the file count as saved.
+    TestUIDCacheFile cache;
+    Open(cache);
+    cache.Append({1, 0}, 8);
+  }
+
+  const std::vector<std::pair<u32, u32>> expected{{1, 0}, {1, 4}};
+  EXPECT_EQ(Reload(), expected);
+}
+
+// A UID cache without a matching trace, e.g. one written before the trace existed, is rewritten.
+// This has to keep all of its UIDs, including the ones whose pipelines are already in the pipeline
+// cache, which the shader cache appends again after loading.
+TEST_F(PipelineUIDCacheFileTest, RewriteKeepsUIDsAlreadyInPipelineCache)
+{
+  {
+    TestUIDCacheFile cache;
+    Open(cache);
+    cache.Append({1, 0}, 0);
+    cache.Append({2, 0}, 1);
+    cache.Append({3, 0}, 2);
+  }
+  ASSERT_TRUE(File::Delete(GetTraceFilename()));
+
+  {
+    TestUIDCacheFile cache;
+    const auto entries = Open(cache);
+    ASSERT_EQ(entries.size(), 3u);
+    for (const TestUIDCacheFile::Entry& entry : entries)
+      EXPECT_EQ(entry.first_use_frame, UNKNOWN_FRAME);
+
+    // The pipeline cache contains two of the UIDs and one that wasn't saved yet.
+    cache.Append({2, 0}, UNKNOWN_FRAME);
+    cache.Append({3, 0}, UNKNOWN_FRAME);
+    cache.Append({4, 0}, UNKNOWN_FRAME);
+  }
+
+  const std::vector<std::pair<u32, u32>> expected{
+      {1, UNKNOWN_FRAME}, {2, UNKNOWN_FRAME}, {3, UNKNOWN_FRAME}, {4, UNKNOWN_FRAME}};
+  EXPECT_EQ(Reload(), expected);
+
+  // The rewritten trace lines up with the UIDs again, so new frames are kept.
+  {
+    TestUIDCacheFile cache;
+    Open(cache);
+    cache.Append({5, 0}, 6);
+  }
+  EXPECT_EQ(Reload().back(), std::make_pair(5u, 6u));
+}
+
+TEST_F(PipelineUIDCacheFileTest, PartialUIDIsDropped)
+{
+  {
+    TestUIDCacheFile cache;
+    Open(cache);
+    cache.Append({1, 0}, 0);
+    cache.Append({2, 0}, 1);
+  }
+
+  // Simulate a write that was interrupted.
+  {
+    File::IOFile file(GetUIDFilename(), "r+b");
+    ASSERT_TRUE(file.Resize(file.GetSize() - 1));
+  }
+
+  const std::vector<std::pair<u32, u32>> expected{{1, 0}};
+  EXPECT_EQ(Reload(), expected);
+  EXPECT_EQ(Reload(), expected);
+}
+
+TEST_F(PipelineUIDCacheFileTest, VersionMismatchDiscardsUIDs)
+{
+  {
+    TestUIDCacheFile cache;
+    Open(cache);
+    cache.Append({1, 0}, 0);
+  }
+
+  TestUIDCacheFile cache;
+  EXPECT_TRUE(cache.Open(GetUIDFilename(), GetTraceFilename(), UID_VERSION + 1).empty());
+  EXPECT_TRUE(cache.IsOpen());
+}
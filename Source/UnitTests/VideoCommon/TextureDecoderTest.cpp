@@ -0,0 +1,127 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Timer.h"
+#include "VideoCommon/TextureDecoder.h"
+
+// Compares the whole-texture decoders against the per-texel decoder used by the software renderer,
+// which is simple enough to serve as a reference.
+static void CheckDecodeMatchesTexels(TextureFormat format, TLUTFormat tlut_format)
+{
+  const int block_width = TexDecoder_GetBlockWidthInTexels(format);
+  const int block_height = TexDecoder_GetBlockHeightInTexels(format);
+
+  std::mt19937 rng(static_cast<u32>(format) * 4 + static_cast<u32>(tlut_format));
+  std::uniform_int_distribution<int> byte(0, 0xFF);
+
+  std::vector<u8> tlut(2 * 16384);
+  for (u8& b : tlut)
+    b = static_cast<u8>(byte(rng));
+
+  for (const int width_blocks : {1, 3})
+  {
+    for (const int height_blocks : {1, 2})
+    {
+      const int width = width_blocks * block_width;
+      const int height = height_blocks * block_height;
+      SCOPED_TRACE(fmt::format("format {} tlut {} size {}x{}", static_cast<int>(format),
+                               static_cast<int>(tlut_format), width, height));
+
+      std::vector<u8> src(TexDecoder_GetTextureSizeInBytes(width, height, format));
+      for (u8& b : src)
+        b = static_cast<u8>(byte(rng));
+
+      std::vector<u32> decoded(width * height);
+      TexDecoder_Decode(reinterpret_cast<u8*>(decoded.data()), src.data(), width, height, format,
+                        tlut.data(), tlut_format);
+
+      for (int t = 0; t < height; t++)
+      {
+        for (int s = 0; s < width; s++)
+        {
+          u32 texel;
+          TexDecoder_DecodeTexel(reinterpret_cast<u8*>(&texel), src, s, t, width - 1, format, tlut,
+                                 tlut_format);
+          ASSERT_EQ(texel, decoded[t * width + s]) << "at " << s << ", " << t;
+        }
+      }
+    }
+  }
+}
+
+TEST(TextureDecoder, DirectFormatsMatchTexelDecoder)
+{
+  for (const TextureFormat format :
+       {TextureFormat::I4, TextureFormat::I8, TextureFormat::IA4, TextureFormat::IA8,
+        TextureFormat::RGB565, TextureFormat::RGB5A3, TextureFormat::RGBA8, TextureFormat::CMPR})
+  {
+    CheckDecodeMatchesTexels(format, TLUTFormat::IA8);
+  }
+}
+
+TEST(TextureDecoder, PalettedFormatsMatchTexelDecoder)
+{
+  for (const TextureFormat format : {TextureFormat::C4, TextureFormat::C8, TextureFormat::C14X2})
+  {
+    for (const TLUTFormat tlut_format :
+         {TLUTFormat::IA8, TLUTFormat::RGB565, TLUTFormat::RGB5A3})
+    {
+      CheckDecodeMatchesTexels(format, tlut_format);
+    }
+  }
+}
+
+// The throughput of TexDecoder_Decode for each format is recorded in the test results instead of
+// being checked, as it depends on the machine.
+TEST(TextureDecoder, Throughput)
+{
+  constexpr int width = 512;
+  constexpr int height = 512;
+  constexpr int iterations = 20;
+
+  std::mt19937 rng(0);
+  std::uniform_int_distribution<int> byte(0, 0xFF);
+  std::vector<u8> tlut(2 * 16384);
+  for (u8& b : tlut)
+    b = static_cast<u8>(byte(rng));
+  std::vector<u8> src(TexDecoder_GetTextureSizeInBytes(width, height, TextureFormat::RGBA8));
+  for (u8& b : src)
+    b = static_cast<u8>(byte(rng));
+  std::vector<u32> decoded(width * height);
+
+  const auto measure = [&](const std::string& name, TextureFormat format, TLUTFormat tlut_format) {
+    const u64 start = Common::Timer::NowUs();
+    for (int i = 0; i < iterations; ++i)
+    {
+      TexDecoder_Decode(reinterpret_cast<u8*>(decoded.data()), src.data(), width, height, format,
+                        tlut.data(), tlut_format);
+    }
+    const u64 elapsed = std::max<u64>(Common::Timer::NowUs() - start, 1);
+    RecordProperty(name + "_mtexels_per_second",
+                   std::to_string(static_cast<u64>(double(width) * height * iterations / elapsed)));
+  };
+
+  for (const TextureFormat format :
+       {TextureFormat::I4, TextureFormat::I8, TextureFormat::IA4, TextureFormat::IA8,
+        TextureFormat::RGB565, TextureFormat::RGB5A3, TextureFormat::RGBA8, TextureFormat::CMPR})
+  {
+    measure(fmt::format("{:n}", format), format, TLUTFormat::IA8);
+  }
+  for (const TextureFormat format : {TextureFormat::C4, TextureFormat::C8, TextureFormat::C14X2})
+  {
+    for (const TLUTFormat tlut_format :
+         {TLUTFormat::IA8, TLUTFormat::RGB565, TLUTFormat::RGB5A3})
+    {
+      measure(fmt::format("{:n}_{:n}", format, tlut_format), format, tlut_format);
+    }
+  }
+}
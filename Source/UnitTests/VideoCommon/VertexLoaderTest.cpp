@@ -1,6 +1,7 @@
 // Copyright 2014 Dolphin Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <array>
 #include <bit>
 #include <limits>
 #include <memory>
@@ -377,6 +378,120 @@ TEST_F(VertexLoaderTest, LargeFloatVertexSpeed)
     RunVertices(100000);
 }
 
+TEST_F(VertexLoaderTest, ManagerReusesLoaders)
+{
+  VertexLoaderManager::Init();
+  g_preprocess_cp_state.vtx_desc.low.Hex = 0;
+  g_preprocess_cp_state.vtx_desc.high.Hex = 0;
+  g_preprocess_cp_state.vtx_desc.low.Position = VertexComponentFormat::Direct;
+  for (VAT& vat : g_preprocess_cp_state.vtx_attr)
+  {
+    vat.g0.Hex = 0;
+    vat.g1.Hex = 0;
+    vat.g2.Hex = 0;
+  }
+  g_preprocess_cp_state.vtx_attr[0].g0.PosFormat = ComponentFormat::Float;
+  g_preprocess_cp_state.vtx_attr[1].g0.PosFormat = ComponentFormat::Float;
+  g_preprocess_cp_state.vtx_attr[2].g0.PosFormat = ComponentFormat::Short;
+
+  VertexLoaderBase* loader = VertexLoaderManager::detail::GetOrCreateLoader<true>(0);
+  ASSERT_NE(nullptr, loader);
+  EXPECT_EQ(loader, VertexLoaderManager::detail::GetOrCreateLoader<true>(1));
+  EXPECT_NE(loader, VertexLoaderManager::detail::GetOrCreateLoader<true>(2));
+  EXPECT_EQ(loader, VertexLoaderManager::detail::GetOrCreateLoader<true>(0));
+
+  VertexLoaderManager::Clear();
+}
+
+TEST_F(VertexLoaderTest, RealisticDrawsSpeed)
+{
+  // Unlike the tests above, this mimics what games do: switch between a handful of vertex formats
+  // for draws of a few to a few hundred vertices each, so that finding the loader matters as much
+  // as running it.
+  struct Format
+  {
+    TVtxDesc vtx_desc;
+    VAT vtx_attr;
+  };
+  std::array<Format, 4> formats{};
+
+  // Skinned model: matrix index, indexed float position and normal, indexed color and texcoord.
+  formats[0].vtx_desc.low.PosMatIdx = true;
+  formats[0].vtx_desc.low.Position = VertexComponentFormat::Index16;
+  formats[0].vtx_desc.low.Normal = VertexComponentFormat::Index16;
+  formats[0].vtx_desc.low.Color0 = VertexComponentFormat::Index16;
+  formats[0].vtx_desc.high.Tex0Coord = VertexComponentFormat::Index16;
+  formats[0].vtx_attr.g0.PosElements = CoordComponentCount::XYZ;
+  formats[0].vtx_attr.g0.PosFormat = ComponentFormat::Float;
+  formats[0].vtx_attr.g0.NormalFormat = ComponentFormat::Float;
+  formats[0].vtx_attr.g0.Color0Elements = ColorComponentCount::RGBA;
+  formats[0].vtx_attr.g0.Color0Comp = ColorFormat::RGBA8888;
+  formats[0].vtx_attr.g0.Tex0CoordElements = TexComponentCount::ST;
+  formats[0].vtx_attr.g0.Tex0CoordFormat = ComponentFormat::Float;
+
+  // Level geometry: indexed fixed point position and texcoords.
+  formats[1].vtx_desc.low.Position = VertexComponentFormat::Index16;
+  formats[1].vtx_desc.low.Color0 = VertexComponentFormat::Index8;
+  formats[1].vtx_desc.high.Tex0Coord = VertexComponentFormat::Index16;
+  formats[1].vtx_desc.high.Tex1Coord = VertexComponentFormat::Index16;
+  formats[1].vtx_attr.g0.PosElements = CoordComponentCount::XYZ;
+  formats[1].vtx_attr.g0.PosFormat = ComponentFormat::Short;
+  formats[1].vtx_attr.g0.PosFrac = 4;
+  formats[1].vtx_attr.g0.Color0Elements = ColorComponentCount::RGBA;
+  formats[1].vtx_attr.g0.Color0Comp = ColorFormat::RGBA4444;
+  formats[1].vtx_attr.g0.Tex0CoordElements = TexComponentCount::ST;
+  formats[1].vtx_attr.g0.Tex0CoordFormat = ComponentFormat::Short;
+  formats[1].vtx_attr.g0.Tex0Frac = 8;
+  formats[1].vtx_attr.g1.Tex1CoordElements = TexComponentCount::ST;
+  formats[1].vtx_attr.g1.Tex1CoordFormat = ComponentFormat::Short;
+  formats[1].vtx_attr.g1.Tex1Frac = 8;
+
+  // 2D interface: direct position, color and texcoord.
+  formats[2].vtx_desc.low.Position = VertexComponentFormat::Direct;
+  formats[2].vtx_desc.low.Color0 = VertexComponentFormat::Direct;
+  formats[2].vtx_desc.high.Tex0Coord = VertexComponentFormat::Direct;
+  formats[2].vtx_attr.g0.PosElements = CoordComponentCount::XY;
+  formats[2].vtx_attr.g0.PosFormat = ComponentFormat::Short;
+  formats[2].vtx_attr.g0.Color0Elements = ColorComponentCount::RGBA;
+  formats[2].vtx_attr.g0.Color0Comp = ColorFormat::RGBA8888;
+  formats[2].vtx_attr.g0.Tex0CoordElements = TexComponentCount::ST;
+  formats[2].vtx_attr.g0.Tex0CoordFormat = ComponentFormat::UByte;
+
+  // Particles: direct float position and color.
+  formats[3].vtx_desc.low.Position = VertexComponentFormat::Direct;
+  formats[3].vtx_desc.low.Color0 = VertexComponentFormat::Direct;
+  formats[3].vtx_attr.g0.PosElements = CoordComponentCount::XYZ;
+  formats[3].vtx_attr.g0.PosFormat = ComponentFormat::Float;
+  formats[3].vtx_attr.g0.Color0Elements = ColorComponentCount::RGBA;
+  formats[3].vtx_attr.g0.Color0Comp = ColorFormat::RGBA8888;
+
+  for (int i = 0; i < NUM_VERTEX_COMPONENT_ARRAYS; i++)
+  {
+    VertexLoaderManager::cached_arraybases[static_cast<CPArray>(i)] = m_src.GetPointer();
+    g_main_cp_state.array_strides[static_cast<CPArray>(i)] = 16;
+  }
+
+  VertexLoaderManager::Init();
+  for (int draw = 0; draw < 100000; ++draw)
+  {
+    // Games usually switch the vertex description along with the format, which makes every VAT
+    // group look up its loader again.
+    const Format& format = formats[(draw / 3) % formats.size()];
+    const int vtx_attr_group = draw % 3;
+    g_preprocess_cp_state.vtx_desc.low.Hex = format.vtx_desc.low.Hex;
+    g_preprocess_cp_state.vtx_desc.high.Hex = format.vtx_desc.high.Hex;
+    g_preprocess_cp_state.vtx_attr[vtx_attr_group].g0.Hex = format.vtx_attr.g0.Hex;
+    g_preprocess_cp_state.vtx_attr[vtx_attr_group].g1.Hex = format.vtx_attr.g1.Hex;
+    g_preprocess_cp_state.vtx_attr[vtx_attr_group].g2.Hex = format.vtx_attr.g2.Hex;
+    VertexLoaderManager::g_preprocess_vat_dirty[vtx_attr_group] = true;
+
+    VertexLoaderBase* loader = VertexLoaderManager::RefreshLoader<true>(vtx_attr_group);
+    const int count = 3 + (draw * 37) % 300;
+    ASSERT_EQ(count, loader->RunVertices(m_src.GetPointer(), m_dst.GetPointer(), count));
+  }
+  VertexLoaderManager::Clear();
+}
+
 TEST_F(VertexLoaderTest, DirectAllComponents)
 {
   m_vtx_desc.low.PosMatIdx = true;